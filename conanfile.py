@@ -11,6 +11,7 @@ class ChocoChip8(ConanFile):
 	generators = "CMakeDeps", "CMakeToolchain"
 
 	def requirements(self):
+		self.requires("benchmark/1.9.1")
 		self.requires("cxxopts/3.2.0")
 		self.requires("fmt/11.2.0")
 		self.requires("catch2/3.8.1")
@@ -0,0 +1,302 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <cxxopts.hpp>
+#include <fmt/format.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+#include <spdlog/spdlog.h>
+
+#include "chocboy/config.hpp"
+#include "chocboy/headless.hpp"
+#include "cocoa/thread_pool.hpp"
+
+/// @brief One line of batch manifest.
+struct BatchEntry final {
+    cocoboy::HeadlessOptions options;
+
+    /// Framebuffer hash required to pass, if any.
+    std::optional<uint64_t> hash;
+
+    /// Audio hash required to pass, if any.
+    std::optional<uint64_t> audio;
+};
+
+/// @brief Outcome of one batch entry.
+struct BatchResult final {
+    std::string status;
+    std::string message;
+    cocoboy::HeadlessResult run;
+    double wall_ms;
+};
+
+/// @brief Parse hex address of manifest.
+///
+/// @throws `std::invalid_argument` if value is not hex.
+/// @throws `std::out_of_range` if value does not fit in 16 bits.
+static uint16_t
+parse_address(const std::string& value)
+{
+    const unsigned long address = std::stoul(value, nullptr, 16);
+    if (address > 0xFFFF)
+        throw std::out_of_range("address past 0xFFFF");
+    return static_cast<uint16_t>(address);
+}
+
+/// @brief Parse batch manifest.
+///
+/// Each line names a ROM followed by optional `key=value` run conditions separated by
+/// whitespace:
+///
+/// - `frames=N` frame budget, defaults to given frame count.
+/// - `serial=TEXT` pass once serial output contains text.
+/// - `break=ADDR` pass once PC reaches hex address.
+/// - `watch=ADDR` pass once hex address is written.
+/// - `hash=HEX` pass only if final framebuffer has this FNV-1a hash.
+/// - `audio=HEX` pass only if audio of whole run has this FNV-1a hash.
+/// - `load=PATH` resume from save state, e.g., one past a slow boot sequence.
+/// - `save=PATH` write save state once run stops.
+/// - `dispatch=NAME` CPU dispatch strategy, defaults to given dispatch strategy.
+///
+/// Blank lines and lines starting with `#` are skipped. Relative ROM and save state paths are
+/// resolved against directory of manifest.
+///
+/// @param [in] path Path to manifest.
+/// @param [in] frames Default frame budget.
+/// @param [in] dispatch Default dispatch strategy, if any.
+/// @return Entries of manifest in order.
+///
+/// @throws `std::runtime_error` if manifest cannot be read, or holds unknown keys or bad values.
+static std::vector<BatchEntry>
+parse_manifest(const std::filesystem::path& path, const size_t frames,
+    const std::optional<cocoa::gb::Sm83Dispatch> dispatch)
+{
+    std::ifstream file(path);
+    if (!file)
+        throw std::runtime_error(fmt::format("Cannot open manifest {}", path.string()));
+
+    std::vector<BatchEntry> entries;
+    std::string line;
+    for (size_t number = 1; std::getline(file, line); ++number) {
+        std::istringstream fields(line);
+        std::string rom;
+        if (!(fields >> rom) || rom[0] == '#')
+            continue;
+
+        BatchEntry entry = {};
+        entry.options.rom = path.parent_path() / rom;
+        entry.options.frames = frames;
+        entry.options.dispatch = dispatch;
+        for (std::string field; fields >> field;) {
+            const size_t split = field.find('=');
+            const std::string key = field.substr(0, split);
+            const std::string value = (split == std::string::npos) ? "" : field.substr(split + 1);
+            try {
+                if (key == "frames")
+                    entry.options.frames = std::stoul(value);
+                else if (key == "serial")
+                    entry.options.serial = value;
+                else if (key == "break")
+                    entry.options.breakpoint = parse_address(value);
+                else if (key == "watch")
+                    entry.options.watch = parse_address(value);
+                else if (key == "hash")
+                    entry.hash = std::stoull(value, nullptr, 16);
+                else if (key == "audio")
+                    entry.audio = std::stoull(value, nullptr, 16);
+                else if (key == "load")
+                    entry.options.load_state = path.parent_path() / value;
+                else if (key == "save")
+                    entry.options.save_state = path.parent_path() / value;
+                else if (key == "dispatch")
+                    entry.options.dispatch = cocoboy::parse_dispatch(value);
+                else
+                    throw std::runtime_error(
+                        fmt::format("{}:{}: unknown key '{}'", path.string(), number, key));
+            } catch (const std::invalid_argument&) {
+                throw std::runtime_error(
+                    fmt::format("{}:{}: bad value for '{}'", path.string(), number, key));
+            } catch (const std::out_of_range&) {
+                throw std::runtime_error(
+                    fmt::format("{}:{}: bad value for '{}'", path.string(), number, key));
+            }
+        }
+        entries.push_back(entry);
+    }
+
+    return entries;
+}
+
+/// @brief Run one manifest entry and judge it.
+///
+/// A run passes if it reached its serial text, breakpoint, or watchpoint when one is given, and
+/// its framebuffer and audio hashes match when they are given. Runs without any condition pass by
+/// finishing their frames without error.
+static BatchResult
+run_entry(const BatchEntry& entry, std::shared_ptr<spdlog::logger> log)
+{
+    BatchResult result = {};
+    const auto start = std::chrono::steady_clock::now();
+    try {
+        result.run = cocoboy::run_headless(entry.options, log);
+        bool pass = true;
+        if (!entry.options.serial.empty() && result.run.stop != cocoboy::StopReason::Serial) {
+            pass = false;
+            result.message = "serial text not seen";
+        } else if (entry.options.breakpoint
+            && result.run.stop != cocoboy::StopReason::Breakpoint) {
+            pass = false;
+            result.message = "breakpoint not reached";
+        } else if (entry.options.watch && result.run.stop != cocoboy::StopReason::Watchpoint) {
+            pass = false;
+            result.message = "watched address not written";
+        } else if (entry.hash && *entry.hash != result.run.framebuffer_hash) {
+            pass = false;
+            result.message = fmt::format("framebuffer hash {:016x}", result.run.framebuffer_hash);
+        } else if (entry.audio && *entry.audio != result.run.audio_hash) {
+            pass = false;
+            result.message = fmt::format("audio hash {:016x}", result.run.audio_hash);
+        }
+        result.status = pass ? "pass" : "fail";
+    } catch (const std::exception& error) {
+        result.status = "error";
+        result.message = error.what();
+    }
+    result.wall_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+/// @brief Quote field for CSV.
+static std::string
+quote_csv(std::string_view text)
+{
+    std::string quoted = "\"";
+    for (const char c : text) {
+        if (c == '"')
+            quoted += '"';
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+static std::string
+format_json(const std::vector<BatchEntry>& entries, const std::vector<BatchResult>& results)
+{
+    std::string out = "[\n";
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const BatchResult& result = results[i];
+        out += fmt::format("  {{\"rom\": \"{}\", \"status\": \"{}\", \"stop\": \"{}\", "
+                           "\"frames\": {}, \"tstates\": {}, \"wall_ms\": {:.3f}, "
+                           "\"framebuffer\": \"{:016x}\", \"audio\": \"{:016x}\", "
+                           "\"message\": \"{}\"}}{}\n",
+            cocoboy::escape(entries[i].options.rom.string()), result.status,
+            cocoboy::to_string(result.run.stop), result.run.frames, result.run.tstates,
+            result.wall_ms, result.run.framebuffer_hash, result.run.audio_hash,
+            cocoboy::escape(result.message),
+            (i + 1 < entries.size()) ? "," : "");
+    }
+    return out + "]\n";
+}
+
+static std::string
+format_csv(const std::vector<BatchEntry>& entries, const std::vector<BatchResult>& results)
+{
+    std::string out = "rom,status,stop,frames,tstates,wall_ms,framebuffer,audio,message\n";
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const BatchResult& result = results[i];
+        out += fmt::format("{},{},{},{},{},{:.3f},{:016x},{:016x},{}\n",
+            quote_csv(entries[i].options.rom.string()), result.status,
+            cocoboy::to_string(result.run.stop), result.run.frames, result.run.tstates,
+            result.wall_ms, result.run.framebuffer_hash, result.run.audio_hash,
+            quote_csv(result.message));
+    }
+    return out;
+}
+
+int
+main(int argc, char** argv)
+try {
+    cxxopts::Options options(argv[0], "- run many ROMs headless across all cores");
+    constexpr size_t max_width = 90;
+    options.set_width(max_width).set_tab_expansion().add_options()(
+        "j,jobs", "worker threads, 0 for one per core",
+        cxxopts::value<size_t>()->default_value("0"))(
+        "f,frames", "default frame budget of each ROM",
+        cxxopts::value<size_t>()->default_value("600"))(
+        "format", "summary format, json or csv",
+        cxxopts::value<std::string>()->default_value("json"))(
+        "d,dispatch", "default CPU dispatch, table, threaded, block, or jit",
+        cxxopts::value<std::string>())(
+        "o,output", "write summary to file instead of stdout", cxxopts::value<std::string>())(
+        "manifest", "manifest of ROMs and run conditions", cxxopts::value<std::string>());
+    options.parse_positional({ "manifest" });
+    options.positional_help("MANIFEST");
+    auto result = options.parse(argc, argv);
+
+    if (result.count("manifest") == 0U) {
+        fmt::print(stderr, "{}\n", options.help());
+        return 1;
+    }
+
+    const std::string format = result["format"].as<std::string>();
+    if (format != "json" && format != "csv") {
+        fmt::print(stderr, "Unknown summary format '{}'\n", format);
+        return 1;
+    }
+
+    std::optional<cocoa::gb::Sm83Dispatch> dispatch;
+    if (result.count("dispatch") != 0U)
+        dispatch = cocoboy::parse_dispatch(result["dispatch"].as<std::string>());
+
+    const std::vector<BatchEntry> entries = parse_manifest(
+        result["manifest"].as<std::string>(), result["frames"].as<size_t>(), dispatch);
+
+    // NOTE: Shared by every worker, hence multi-threaded sink.
+    std::shared_ptr<spdlog::logger> logger = std::make_shared<spdlog::logger>(
+        cocoboy::PROGRAM_NAME.data(), std::make_shared<spdlog::sinks::stderr_color_sink_mt>());
+    logger->set_level(spdlog::level::warn);
+
+    // INVARIANT: Each job writes only its own slot, so results need no locking.
+    std::vector<BatchResult> results(entries.size());
+    {
+        cocoa::ThreadPool pool(result["jobs"].as<size_t>());
+        for (size_t i = 0; i < entries.size(); ++i)
+            pool.submit([&, i] { results[i] = run_entry(entries[i], logger); });
+        pool.wait();
+    }
+
+    const std::string summary
+        = (format == "json") ? format_json(entries, results) : format_csv(entries, results);
+    if (result.count("output") != 0U) {
+        std::ofstream file(result["output"].as<std::string>());
+        file << summary;
+    } else {
+        fmt::print("{}", summary);
+    }
+
+    const size_t passed = static_cast<size_t>(std::count_if(results.begin(), results.end(),
+        [](const BatchResult& entry) { return entry.status == "pass"; }));
+    fmt::print(stderr, "{}/{} passed\n", passed, results.size());
+    return (passed == results.size()) ? 0 : 1;
+} catch (const cxxopts::exceptions::exception& error) {
+    fmt::print(stderr, "{}\n", error.what());
+    return 1;
+} catch (const std::exception& error) {
+    fmt::print(stderr, "{}\n", error.what());
+    return 1;
+}
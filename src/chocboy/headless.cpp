@@ -0,0 +1,175 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+#include <spdlog/logger.h>
+
+#include "chocboy/headless.hpp"
+#include "cocoa/gb/apu.hpp"
+#include "cocoa/gb/debugger.hpp"
+#include "cocoa/gb/gameboy.hpp"
+#include "cocoa/gb/ppu.hpp"
+#include "cocoa/gb/sm83.hpp"
+#include "cocoa/utility.hpp"
+
+namespace cocoboy {
+HeadlessResult
+run_headless(const HeadlessOptions& options, std::shared_ptr<spdlog::logger> log)
+{
+    cocoa::gb::GameBoy gameboy(log, options.rom);
+    if (options.dispatch)
+        gameboy.cpu().set_dispatch(*options.dispatch);
+    if (!options.load_state.empty())
+        gameboy.load_state(options.load_state);
+
+    cocoa::gb::Debugger debugger(gameboy);
+    if (options.breakpoint)
+        debugger.set_breakpoint(*options.breakpoint);
+    if (options.watch)
+        debugger.set_watchpoint(*options.watch, cocoa::gb::WatchKind::Write);
+
+    const cocoa::gb::Serial& serial = gameboy.serial();
+    size_t serial_seen = 0;
+    bool serial_matched = false;
+
+    std::ofstream dump;
+    if (!options.audio_dump.empty()) {
+        dump.open(options.audio_dump, std::ios::binary);
+        if (!dump)
+            throw std::runtime_error(
+                fmt::format("Cannot open audio dump {}", options.audio_dump.string()));
+    }
+
+    // NOTE: Run frame by frame towards absolute targets, so audio is drained before APU drops
+    // any of it, and overshoot of one frame does not shorten the next.
+    std::vector<int16_t> block;
+    uint64_t audio_hash = cocoa::FNV1A_BASIS;
+    size_t audio_samples = 0;
+    const size_t start = gameboy.cpu().tstates();
+    cocoa::gb::DebugStop stop = cocoa::gb::DebugStop::None;
+    // NOTE: Serial output is searched between slices of one scanline rather than before each
+    // instruction, so blocks and native code still run. Run stops at most one scanline late.
+    const size_t slice = options.serial.empty() ? cocoa::gb::DOTS_PER_FRAME
+                                                : cocoa::gb::DOTS_PER_LINE;
+    for (size_t frame = 0; frame < options.frames; ++frame) {
+        const size_t target = start + (frame + 1) * cocoa::gb::DOTS_PER_FRAME;
+        while (stop == cocoa::gb::DebugStop::None && !serial_matched
+            && gameboy.cpu().tstates() < target) {
+            // NOTE: Debugger does not hit breakpoint at PC it resumes from, yet one run for whole
+            // budget would have hit one that slice boundary happens to land on.
+            const cocoa::gb::Sm83State& cpu = gameboy.cpu().state();
+            if (cpu.tstates != start && options.breakpoint
+                && cpu.mode == cocoa::gb::Sm83Mode::Running && cpu.pc == *options.breakpoint) {
+                stop = cocoa::gb::DebugStop::Breakpoint;
+                break;
+            }
+
+            stop = debugger.run_for(std::min(slice, target - gameboy.cpu().tstates()));
+
+            // INVARIANT: Serial output only grows, so it is only searched again when it changes.
+            if (!options.serial.empty() && serial.output().size() != serial_seen) {
+                serial_seen = serial.output().size();
+                serial_matched = serial.output().find(options.serial) != std::string::npos;
+            }
+        }
+
+        gameboy.apu().read_block(block);
+        const auto* bytes = reinterpret_cast<const uint8_t*>(block.data());
+        const size_t size = block.size() * sizeof(int16_t);
+        audio_hash = cocoa::fnv1a(bytes, size, audio_hash);
+        audio_samples += block.size() / 2;
+        if (dump.is_open())
+            dump.write(reinterpret_cast<const char*>(block.data()),
+                static_cast<std::streamsize>(size));
+        if (stop != cocoa::gb::DebugStop::None || serial_matched)
+            break;
+    }
+    if (!options.save_state.empty())
+        gameboy.save_state(options.save_state);
+
+    const cocoa::gb::Sm83State& cpu = gameboy.cpu().state();
+    const cocoa::gb::Framebuffer& framebuffer = gameboy.ppu().framebuffer();
+    HeadlessResult result = {};
+    result.stop = StopReason::Frames;
+    if (stop == cocoa::gb::DebugStop::Breakpoint)
+        result.stop = StopReason::Breakpoint;
+    else if (stop == cocoa::gb::DebugStop::Watchpoint)
+        result.stop = StopReason::Watchpoint;
+    else if (serial_matched)
+        result.stop = StopReason::Serial;
+    result.frames = gameboy.ppu().frames();
+    result.tstates = gameboy.cpu().tstates();
+    result.framebuffer_hash = cocoa::fnv1a(framebuffer.data(), framebuffer.size());
+    result.audio_hash = audio_hash;
+    result.audio_samples = audio_samples;
+    result.serial = serial.output();
+    result.regs = cpu.regs;
+    result.sp = cpu.sp;
+    result.pc = cpu.pc;
+    return result;
+}
+
+std::string_view
+to_string(const StopReason reason)
+{
+    switch (reason) {
+    case StopReason::Frames:
+        return "frames";
+    case StopReason::Breakpoint:
+        return "breakpoint";
+    case StopReason::Watchpoint:
+        return "watchpoint";
+    case StopReason::Serial:
+        return "serial";
+    }
+    return "unknown";
+}
+
+cocoa::gb::Sm83Dispatch
+parse_dispatch(std::string_view name)
+{
+    if (name == "table")
+        return cocoa::gb::Sm83Dispatch::Table;
+    if (name == "threaded")
+        return cocoa::gb::Sm83Dispatch::Threaded;
+    if (name == "block")
+        return cocoa::gb::Sm83Dispatch::Block;
+#ifdef COCOA_JIT
+    if (name == "jit")
+        return cocoa::gb::Sm83Dispatch::Jit;
+#endif // COCOA_JIT
+    throw std::invalid_argument(fmt::format("Unknown dispatch '{}'", name));
+}
+
+std::string
+escape(std::string_view text)
+{
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (const char c : text) {
+        // NOTE: Bytes past ASCII pass through, so UTF-8 text, e.g., paths, stays intact.
+        const auto byte = static_cast<uint8_t>(c);
+        if (c == '\\')
+            escaped += "\\\\";
+        else if (c == '"')
+            escaped += "\\\"";
+        else if (c == '\n')
+            escaped += "\\n";
+        else if (byte >= 0x20 && byte != 0x7F)
+            escaped += c;
+        else
+            escaped += fmt::format("\\u{:04x}", byte);
+    }
+    return escaped;
+}
+} // namespace cocoboy
@@ -0,0 +1,114 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef CHOCBOY_HEADLESS_HPP
+#define CHOCBOY_HEADLESS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <spdlog/logger.h>
+
+#include "cocoa/gb/sm83.hpp"
+
+namespace cocoboy {
+/// @brief Conditions of one headless run.
+struct HeadlessOptions final {
+    std::filesystem::path rom;
+    size_t frames = 60;
+
+    /// Stop once serial output contains this text, unless empty.
+    std::string serial;
+
+    /// Stop once PC reaches this address.
+    std::optional<uint16_t> breakpoint;
+
+    /// Stop once this address is written.
+    std::optional<uint16_t> watch;
+
+    /// Resume from this save state before running, unless empty.
+    std::filesystem::path load_state;
+
+    /// Write save state here once run stops, unless empty.
+    std::filesystem::path save_state;
+
+    /// Write audio here as raw interleaved 16-bit little-endian stereo samples at 48 kHz, unless
+    /// empty.
+    std::filesystem::path audio_dump;
+
+    /// Dispatch strategy of CPU, unless left to default of `cocoa::gb::GameBoy`.
+    std::optional<cocoa::gb::Sm83Dispatch> dispatch;
+};
+
+/// @brief Reasons for headless run to stop.
+enum class StopReason {
+    Frames,
+    Breakpoint,
+    Watchpoint,
+    Serial,
+};
+
+/// @brief Final state of emulator after headless run.
+struct HeadlessResult final {
+    StopReason stop;
+    size_t frames;
+    size_t tstates;
+    uint64_t framebuffer_hash;
+
+    /// Hash of every audio sample produced during run, and amount of stereo sample frames.
+    uint64_t audio_hash;
+    size_t audio_samples;
+    std::string serial;
+    std::array<uint8_t, 8> regs;
+    uint16_t sp;
+    uint16_t pc;
+};
+
+/// @brief Run ROM without SDL or ImGui.
+///
+/// Runs until frame budget is spent, PC hits breakpoint, watched address is written, or serial
+/// output contains expected text, whichever comes first. Serial output is searched once per
+/// scanline. Frame budget counts from save state that run resumes from, if any. Audio is collected
+/// once per frame, so it never overflows what APU keeps pending.
+///
+/// @param [in] options Conditions of run.
+/// @param [in] log Logger to use.
+/// @return Final state of emulator.
+///
+/// @throws `CartridgeError` if ROM cannot be loaded.
+/// @throws `SnapshotError` if save state cannot be loaded or saved.
+/// @throws `std::runtime_error` if audio dump cannot be written.
+/// @throws `IllegalOpcode` if ROM executes an illegal opcode.
+HeadlessResult
+run_headless(const HeadlessOptions& options, std::shared_ptr<spdlog::logger> log);
+
+/// @brief Get name of stop reason as used in reports.
+std::string_view
+to_string(const StopReason reason);
+
+/// @brief Get dispatch strategy by name as used on command line.
+///
+/// Names are `table`, `threaded`, `block`, and `jit` when built with JIT.
+///
+/// @param [in] name Name of dispatch strategy.
+/// @return Dispatch strategy of given name.
+///
+/// @throws `std::invalid_argument` if no dispatch strategy has given name.
+cocoa::gb::Sm83Dispatch
+parse_dispatch(std::string_view name);
+
+/// @brief Escape text so it fits on one line of a report.
+///
+/// Quotes, backslashes, and control characters are escaped JSON style. Bytes past ASCII pass
+/// through unchanged, so UTF-8 text stays valid.
+std::string
+escape(std::string_view text);
+} // namespace cocoboy
+
+#endif // CHOCBOY_HEADLESS_HPP
@@ -1,8 +1,15 @@
 // SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
 // SPDX-License-Identifier: MIT
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <exception>
+#include <fstream>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <SDL3/SDL.h>
 #include <cxxopts.hpp>
@@ -13,24 +20,190 @@
 #include <spdlog/spdlog.h>
 
 #include "chocboy/config.hpp"
+#include "chocboy/headless.hpp"
+#include "cocoa/gb/apu.hpp"
+#include "cocoa/gb/debugger.hpp"
+#include "cocoa/gb/gameboy.hpp"
+#include "cocoa/gb/ppu.hpp"
+#include "cocoa/gb/sm83.hpp"
+#include "cocoa/rewind.hpp"
 #include "cocoa/utility.hpp"
 
+// NOTE: One keyframe per second of emulated time keeps rewinding across keyframes cheap.
+constexpr size_t REWIND_KEYFRAME_INTERVAL = 60;
+
+/// @brief State of debugger window kept across frames.
+struct DebuggerView final {
+    bool paused = false;
+    cocoa::gb::DebugStop stop = cocoa::gb::DebugStop::None;
+
+    /// Hex address typed in by user.
+    std::array<char, 5> address = {};
+};
+
+/// @brief Draw debugger window, and apply whatever was clicked in it.
+static void
+draw_debugger(cocoa::gb::Debugger& debugger, DebuggerView& view)
+{
+    ImGui::Begin("Debugger");
+    if (ImGui::Button(view.paused ? "Continue" : "Pause"))
+        view.paused = !view.paused;
+    ImGui::SameLine();
+    if (ImGui::Button("Step")) {
+        view.stop = debugger.step();
+        view.paused = true;
+    }
+
+    const cocoa::gb::Sm83State& cpu = debugger.gameboy().cpu().state();
+    ImGui::Text("AF=%02X%02X BC=%02X%02X DE=%02X%02X HL=%02X%02X SP=%04X PC=%04X",
+        cpu.regs[cocoa::gb::Sm83State::A], cpu.regs[cocoa::gb::Sm83State::F],
+        cpu.regs[cocoa::gb::Sm83State::B], cpu.regs[cocoa::gb::Sm83State::C],
+        cpu.regs[cocoa::gb::Sm83State::D], cpu.regs[cocoa::gb::Sm83State::E],
+        cpu.regs[cocoa::gb::Sm83State::H], cpu.regs[cocoa::gb::Sm83State::L], cpu.sp, cpu.pc);
+    if (view.stop == cocoa::gb::DebugStop::Breakpoint) {
+        ImGui::Text("Stopped at breakpoint");
+    } else if (view.stop == cocoa::gb::DebugStop::Watchpoint && debugger.last_hit()) {
+        const cocoa::gb::WatchHit& hit = *debugger.last_hit();
+        ImGui::Text("Stopped by %s of %02X at %04X",
+            (hit.kind == cocoa::gb::WatchKind::Read) ? "read" : "write", hit.value, hit.address);
+    }
+
+    ImGui::Separator();
+    ImGui::InputText("Address", view.address.data(), view.address.size(),
+        ImGuiInputTextFlags_CharsHexadecimal);
+    const auto address = static_cast<uint16_t>(std::strtoul(view.address.data(), nullptr, 16));
+    if (ImGui::Button("Break"))
+        debugger.set_breakpoint(address);
+    ImGui::SameLine();
+    if (ImGui::Button("Watch read"))
+        debugger.set_watchpoint(address, cocoa::gb::WatchKind::Read);
+    ImGui::SameLine();
+    if (ImGui::Button("Watch write"))
+        debugger.set_watchpoint(address, cocoa::gb::WatchKind::Write);
+
+    // NOTE: Lists are copies, so points can be cleared while iterating.
+    for (const uint16_t pc : debugger.breakpoints()) {
+        ImGui::PushID(pc);
+        if (ImGui::Button("x"))
+            debugger.clear_breakpoint(pc);
+        ImGui::SameLine();
+        ImGui::Text("Break at %04X", pc);
+        ImGui::PopID();
+    }
+    for (const cocoa::gb::Watchpoint& watch : debugger.watchpoints()) {
+        const bool read = watch.kind == cocoa::gb::WatchKind::Read;
+        ImGui::PushID((watch.address << 1) | (read ? 1 : 0));
+        if (ImGui::Button("x"))
+            debugger.clear_watchpoint(watch.address, watch.kind);
+        ImGui::SameLine();
+        ImGui::Text("Watch %s of %04X", read ? "read" : "write", watch.address);
+        ImGui::PopID();
+    }
+    ImGui::End();
+}
+
+/// @brief Run ROM without SDL or ImGui, then report final state of emulator.
+///
+/// Report goes to stdout unless an output file is given.
+static int
+run_headless(const cxxopts::ParseResult& result)
+{
+    // NOTE: Plain stderr sink, so stdout stays reserved for report and no logger is registered.
+    std::shared_ptr<spdlog::logger> logger = std::make_shared<spdlog::logger>(
+        cocoboy::PROGRAM_NAME.data(), std::make_shared<spdlog::sinks::stderr_color_sink_st>());
+    logger->set_level(spdlog::level::warn);
+
+    cocoboy::HeadlessOptions options;
+    options.rom = result["rom"].as<std::string>();
+    options.frames = result["frames"].as<size_t>();
+    if (result.count("serial") != 0U)
+        options.serial = result["serial"].as<std::string>();
+    if (result.count("break") != 0U)
+        options.breakpoint
+            = static_cast<uint16_t>(std::stoul(result["break"].as<std::string>(), nullptr, 16));
+    if (result.count("watch") != 0U)
+        options.watch
+            = static_cast<uint16_t>(std::stoul(result["watch"].as<std::string>(), nullptr, 16));
+    if (result.count("load-state") != 0U)
+        options.load_state = result["load-state"].as<std::string>();
+    if (result.count("save-state") != 0U)
+        options.save_state = result["save-state"].as<std::string>();
+    if (result.count("audio-dump") != 0U)
+        options.audio_dump = result["audio-dump"].as<std::string>();
+    if (result.count("dispatch") != 0U)
+        options.dispatch = cocoboy::parse_dispatch(result["dispatch"].as<std::string>());
+
+    const cocoboy::HeadlessResult run = cocoboy::run_headless(options, logger);
+    const std::string report = fmt::format(
+        "rom: {}\n"
+        "stop: {}\n"
+        "frames: {}\n"
+        "tstates: {}\n"
+        "framebuffer: {:016x}\n"
+        "audio: {:016x} ({} samples)\n"
+        "serial: {}\n"
+        "registers: A={:02X} F={:02X} B={:02X} C={:02X} D={:02X} E={:02X} H={:02X} L={:02X} "
+        "SP={:04X} PC={:04X}\n",
+        options.rom.string(), cocoboy::to_string(run.stop), run.frames, run.tstates,
+        run.framebuffer_hash, run.audio_hash, run.audio_samples, cocoboy::escape(run.serial),
+        run.regs[cocoa::gb::Sm83State::A], run.regs[cocoa::gb::Sm83State::F],
+        run.regs[cocoa::gb::Sm83State::B], run.regs[cocoa::gb::Sm83State::C],
+        run.regs[cocoa::gb::Sm83State::D], run.regs[cocoa::gb::Sm83State::E],
+        run.regs[cocoa::gb::Sm83State::H], run.regs[cocoa::gb::Sm83State::L], run.sp, run.pc);
+
+    if (result.count("output") != 0U) {
+        std::ofstream file(result["output"].as<std::string>());
+        file << report;
+    } else {
+        fmt::print("{}", report);
+    }
+
+    return 0;
+}
+
 int
 main(int argc, char** argv)
 try {
     std::unique_ptr<cxxopts::Options> parser
         = std::make_unique<cxxopts::Options>(argv[0], "- testing");
     bool version = false;
+    bool headless = false;
     constexpr size_t max_width = 90;
     auto& options = *parser;
     options.set_width(max_width).set_tab_expansion().add_options()(
-        "v,version", "version info", cxxopts::value<bool>(version));
+        "v,version", "version info", cxxopts::value<bool>(version))(
+        "headless", "run without any window, then report results", cxxopts::value<bool>(headless))(
+        "r,rom", "ROM file to run", cxxopts::value<std::string>())(
+        "f,frames", "frames to run in headless mode",
+        cxxopts::value<size_t>()->default_value("60"))(
+        "b,break", "stop headless mode once PC reaches hex address", cxxopts::value<std::string>())(
+        "w,watch", "stop headless mode once hex address is written", cxxopts::value<std::string>())(
+        "s,serial", "stop headless mode once serial output contains text",
+        cxxopts::value<std::string>())(
+        "o,output", "write headless report to file instead of stdout",
+        cxxopts::value<std::string>())(
+        "load-state", "resume headless mode from save state", cxxopts::value<std::string>())(
+        "save-state", "write save state once headless mode stops", cxxopts::value<std::string>())(
+        "audio-dump", "write headless audio as raw 48 kHz s16le stereo",
+        cxxopts::value<std::string>())(
+        "d,dispatch", "CPU dispatch of headless mode, table, threaded, block, or jit",
+        cxxopts::value<std::string>())(
+        "rewind-mb", "memory budget of rewind history in MiB, rewind by holding backspace",
+        cxxopts::value<size_t>()->default_value("64"));
     auto result = options.parse(argc, argv);
 
     if (result.count("version") != 0U) {
         fmt::print("{}\n", cocoboy::PROGRAM_VERSION);
     }
 
+    if (headless) {
+        if (result.count("rom") == 0U) {
+            fmt::print(stderr, "--headless requires --rom\n");
+            return 1;
+        }
+        return run_headless(result);
+    }
+
     fmt::print("{} {}\n", cocoboy::PROGRAM_NAME, cocoboy::PROGRAM_VERSION);
     fmt::print("{}\n\n", cocoboy::PROGRAM_DESCRIPTION);
 
@@ -46,10 +219,18 @@ try {
 
     constexpr int winWidth = 600;
     constexpr int winHeight = 400;
-    SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS);
+    SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO | SDL_INIT_EVENTS);
     SDL_Window* window = SDL_CreateWindow("cocoboy", winWidth, winHeight, SDL_WINDOW_OPENGL);
     SDL_Renderer* renderer = SDL_CreateRenderer(window, nullptr);
 
+    // NOTE: Stream converts and buffers blocks, so emulation just hands over each frame of audio.
+    const SDL_AudioSpec audio_spec
+        = { SDL_AUDIO_S16, 2, static_cast<int>(cocoa::gb::APU_SAMPLE_RATE) };
+    SDL_AudioStream* audio = SDL_OpenAudioDeviceStream(
+        SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &audio_spec, nullptr, nullptr);
+    if (audio != nullptr)
+        SDL_ResumeAudioStreamDevice(audio);
+
     IMGUI_CHECKVERSION();
     ImGui::CreateContext();
     ImGuiIO& gio = ImGui::GetIO();
@@ -57,6 +238,17 @@ try {
     ImGui_ImplSDL3_InitForSDLRenderer(window, renderer);
     ImGui_ImplSDLRenderer3_Init(renderer);
 
+    std::unique_ptr<cocoa::gb::GameBoy> gameboy;
+    std::unique_ptr<cocoa::gb::Debugger> debugger;
+    if (result.count("rom") != 0U) {
+        gameboy = std::make_unique<cocoa::gb::GameBoy>(logger, result["rom"].as<std::string>());
+        debugger = std::make_unique<cocoa::gb::Debugger>(*gameboy);
+    }
+    DebuggerView view;
+    cocoa::RewindBuffer rewind(result["rewind-mb"].as<size_t>() << 20, REWIND_KEYFRAME_INTERVAL);
+    std::vector<uint8_t> state;
+    std::vector<int16_t> samples;
+
     bool running = true;
     while (running) {
         SDL_Event event;
@@ -67,6 +259,25 @@ try {
             }
         }
 
+        // INVARIANT: At most one frame is either emulated and captured, or rewound, per iteration.
+        if (gameboy) {
+            const bool* keys = SDL_GetKeyboardState(nullptr);
+            if (keys[SDL_SCANCODE_BACKSPACE] && rewind.pop(state)) {
+                gameboy->load_state(state);
+            } else if (!view.paused) {
+                view.stop = debugger->run_for(cocoa::gb::DOTS_PER_FRAME);
+                view.paused = view.stop != cocoa::gb::DebugStop::None;
+                gameboy->save_state(state);
+                rewind.push(state);
+            }
+
+            // NOTE: Drained every iteration, so rewinding or pausing never replays stale audio.
+            gameboy->apu().read_block(samples);
+            if (audio != nullptr && !samples.empty())
+                SDL_PutAudioStreamData(audio, samples.data(),
+                    static_cast<int>(samples.size() * sizeof(int16_t)));
+        }
+
         ImGui_ImplSDLRenderer3_NewFrame();
         ImGui_ImplSDL3_NewFrame();
         ImGui::NewFrame();
@@ -74,8 +285,15 @@ try {
         bool some_panel = true;
         ImGui::Begin("Some panel", &some_panel);
         ImGui::Text("Hello world");
+        if (gameboy) {
+            ImGui::Text("Rewind: %zu frames in %zu KiB", rewind.size(), rewind.memory() >> 10);
+        }
         ImGui::End();
 
+        if (debugger) {
+            draw_debugger(*debugger, view);
+        }
+
         ImGui::Render();
         SDL_SetRenderDrawColor(renderer, 100, 100, 100, 255); // NOLINT
         SDL_RenderClear(renderer);
@@ -87,6 +305,8 @@ try {
     ImGui_ImplSDL3_Shutdown();
     ImGui::DestroyContext();
 
+    if (audio != nullptr)
+        SDL_DestroyAudioStream(audio);
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     SDL_Quit();
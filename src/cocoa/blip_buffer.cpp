@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "cocoa/blip_buffer.hpp"
+
+namespace cocoa {
+// NOTE: Steps are stored with this many fractional bits, and integrated back on read.
+constexpr size_t BLIP_KERNEL_BITS = 14;
+
+// NOTE: Cutoff of high-pass filter is roughly sample rate / (2 * pi * 2^n), i.e., 15 Hz at 48 kHz.
+constexpr size_t BLIP_HIGHPASS_SHIFT = 9;
+
+// NOTE: Cutoff of sinc relative to Nyquist frequency, which leaves room for transition band.
+constexpr double BLIP_CUTOFF = 0.9;
+
+constexpr size_t BLIP_PHASE_BITS = 5;
+static_assert((size_t(1) << BLIP_PHASE_BITS) == BLIP_PHASE_COUNT);
+
+using BlipKernel = std::array<std::array<int32_t, BLIP_KERNEL_WIDTH>, BLIP_PHASE_COUNT>;
+
+/// @brief Build windowed sinc step for every sub-sample position.
+///
+/// Taps of each phase sum to exactly one in fixed point, so integrated steps never drift.
+static BlipKernel
+make_kernel()
+{
+    constexpr double pi = 3.14159265358979323846;
+    constexpr double half = BLIP_KERNEL_WIDTH / 2.0;
+    BlipKernel kernel = {};
+    for (size_t phase = 0; phase < BLIP_PHASE_COUNT; ++phase) {
+        std::array<double, BLIP_KERNEL_WIDTH> taps = {};
+        double sum = 0.0;
+        for (size_t i = 0; i < BLIP_KERNEL_WIDTH; ++i) {
+            const double x = static_cast<double>(i) - (half - 1.0)
+                - static_cast<double>(phase) / BLIP_PHASE_COUNT;
+            const double angle = pi * BLIP_CUTOFF * x;
+            const double sinc = (x == 0.0) ? 1.0 : std::sin(angle) / angle;
+            const double window = 0.42 + 0.5 * std::cos(pi * x / half)
+                + 0.08 * std::cos(2.0 * pi * x / half);
+            taps[i] = sinc * window;
+            sum += taps[i];
+        }
+
+        int32_t total = 0;
+        size_t peak = 0;
+        for (size_t i = 0; i < BLIP_KERNEL_WIDTH; ++i) {
+            kernel[phase][i] = static_cast<int32_t>(
+                std::lround(taps[i] / sum * static_cast<double>(1 << BLIP_KERNEL_BITS)));
+            total += kernel[phase][i];
+            if (kernel[phase][i] > kernel[phase][peak])
+                peak = i;
+        }
+        kernel[phase][peak] += (1 << BLIP_KERNEL_BITS) - total;
+    }
+    return kernel;
+}
+
+static const BlipKernel&
+kernel()
+{
+    static const BlipKernel table = make_kernel();
+    return table;
+}
+
+BlipBuffer::BlipBuffer(const size_t clock_rate, const size_t sample_rate, const size_t time)
+    : m_factor(((static_cast<uint64_t>(sample_rate) << 32) + clock_rate / 2) / clock_rate)
+    , m_time(time)
+    , m_offset(0)
+    , m_deltas(BLIP_KERNEL_WIDTH, 0)
+    , m_level(0)
+    , m_highpass(0)
+{
+    // NOTE: Built here rather than on first step, so no step ever pays for it.
+    (void)kernel();
+}
+
+void
+BlipBuffer::add_delta(const size_t time, const int32_t delta)
+{
+    const uint64_t pos = position(time);
+    const size_t index = pos >> 32;
+    const size_t phase = (pos >> (32 - BLIP_PHASE_BITS)) & (BLIP_PHASE_COUNT - 1);
+    if (index + BLIP_KERNEL_WIDTH > m_deltas.size())
+        m_deltas.resize(index + BLIP_KERNEL_WIDTH, 0);
+
+    const std::array<int32_t, BLIP_KERNEL_WIDTH>& taps = kernel()[phase];
+    int32_t* out = m_deltas.data() + index;
+    for (size_t i = 0; i < BLIP_KERNEL_WIDTH; ++i)
+        out[i] += delta * taps[i];
+}
+
+size_t
+BlipBuffer::samples_available(const size_t time) const
+{
+    return position(time) >> 32;
+}
+
+size_t
+BlipBuffer::read_samples(const size_t time, int16_t* out, const size_t stride)
+{
+    const uint64_t pos = position(time);
+    const size_t count = pos >> 32;
+    if (m_deltas.size() < count + BLIP_KERNEL_WIDTH)
+        m_deltas.resize(count + BLIP_KERNEL_WIDTH, 0);
+
+    for (size_t i = 0; i < count; ++i) {
+        m_level += m_deltas[i];
+        const int64_t filtered = m_level - m_highpass;
+        m_highpass += filtered >> BLIP_HIGHPASS_SHIFT;
+        if (out != nullptr) {
+            const int64_t sample = std::clamp<int64_t>(
+                filtered >> BLIP_KERNEL_BITS, INT16_MIN, INT16_MAX);
+            out[i * stride] = static_cast<int16_t>(sample);
+        }
+    }
+
+    // INVARIANT: No step added before given time reaches past one kernel beyond last sample
+    // read, so only that much moves to front of buffer, and everything after it is still zero.
+    const auto first = m_deltas.begin() + static_cast<std::ptrdiff_t>(count);
+    std::copy(first, first + BLIP_KERNEL_WIDTH, m_deltas.begin());
+    std::fill(m_deltas.begin() + BLIP_KERNEL_WIDTH, first + BLIP_KERNEL_WIDTH, 0);
+    m_offset = pos - (count << 32);
+    m_time = time;
+    return count;
+}
+
+void
+BlipBuffer::clear(const size_t time)
+{
+    std::fill(m_deltas.begin(), m_deltas.end(), 0);
+    m_time = time;
+    m_offset = 0;
+    m_level = 0;
+    m_highpass = 0;
+}
+
+uint64_t
+BlipBuffer::position(const size_t time) const
+{
+    return m_offset + (time - m_time) * m_factor;
+}
+} // namespace cocoa
@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_BLIP_BUFFER_HPP
+#define COCOA_BLIP_BUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cocoa {
+/// @brief Amount of output samples touched by one band-limited step.
+constexpr size_t BLIP_KERNEL_WIDTH = 16;
+
+/// @brief Amount of sub-sample positions that band-limited steps are placed at.
+constexpr size_t BLIP_PHASE_COUNT = 32;
+
+/// @brief Band-limited step synthesizer.
+///
+/// Turns a signal that only ever changes in steps, e.g., output of a square wave generator, into
+/// output samples at a much lower sample rate without aliasing. Nothing is generated per output
+/// sample. Instead, every change of level is added as a windowed sinc step at its exact
+/// sub-sample position, and reading integrates those steps into samples. Cost thus scales with
+/// amount of changes rather than with amount of clocks or samples.
+///
+/// Time is given in clocks of the source signal, e.g., t-states. Steps lag behind their time by
+/// half of `BLIP_KERNEL_WIDTH` samples, and a one-pole high-pass filter removes any DC offset.
+class BlipBuffer final {
+public:
+    /// @brief Construct empty buffer.
+    ///
+    /// @param [in] clock_rate Clocks per second of source signal.
+    /// @param [in] sample_rate Output samples per second.
+    /// @param [in] time Clock at which buffer starts.
+    BlipBuffer(const size_t clock_rate, const size_t sample_rate, const size_t time = 0);
+
+    ~BlipBuffer() noexcept = default;
+
+    /// @brief Add change of level at given time.
+    ///
+    /// @pre Time must not precede time of last read.
+    ///
+    /// @param [in] time Clock at which level changes.
+    /// @param [in] delta Change of level in output sample units.
+    void
+    add_delta(const size_t time, const int32_t delta);
+
+    /// @brief Get amount of samples that are complete by given time.
+    ///
+    /// Samples are complete once no step at or after given time can change them anymore.
+    [[nodiscard]]
+    size_t
+    samples_available(const size_t time) const;
+
+    /// @brief Read every sample that is complete by given time.
+    ///
+    /// @param [in] time Clock up to which samples are read, which must not precede any step still
+    ///                  to be added.
+    /// @param [out] out Buffer to write samples to, or null to drop them.
+    /// @param [in] stride Distance between samples written to buffer, e.g., two for interleaved
+    ///                    stereo.
+    /// @return Amount of samples read.
+    size_t
+    read_samples(const size_t time, int16_t* out, const size_t stride);
+
+    /// @brief Drop every sample and step, and restart buffer at given time in silence.
+    ///
+    /// @param [in] time Clock at which buffer restarts.
+    void
+    clear(const size_t time);
+
+private:
+    /// @brief Get position of time in 32.32 fixed-point samples relative to start of buffer.
+    [[nodiscard]]
+    uint64_t
+    position(const size_t time) const;
+
+    /// Samples per clock in 32.32 fixed point.
+    uint64_t m_factor;
+
+    /// Clock that `m_offset` was taken at.
+    size_t m_time;
+
+    /// Position of `m_time` in 32.32 fixed-point samples relative to start of buffer.
+    uint64_t m_offset;
+
+    /// Steps per output sample, which are integrated on read.
+    std::vector<int32_t> m_deltas;
+    int64_t m_level;
+    int64_t m_highpass;
+};
+} // namespace cocoa
+
+#endif // COCOA_BLIP_BUFFER_HPP
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "cocoa/blip_buffer.hpp"
+
+TEST_CASE("size_t cocoa::BlipBuffer::samples_available(const size_t) const", "[samples_available]")
+{
+    cocoa::BlipBuffer buffer(4194304, 48000, 100);
+    REQUIRE(buffer.samples_available(100) == 0);
+    REQUIRE(buffer.samples_available(100 + 4194304) == 48000);
+    REQUIRE(buffer.samples_available(100 + 4194304 / 2) == 24000);
+}
+
+TEST_CASE("size_t cocoa::BlipBuffer::read_samples(const size_t, int16_t*, const size_t)",
+    "[read_samples]")
+{
+    cocoa::BlipBuffer buffer(4194304, 48000);
+    std::vector<int16_t> samples(2 * 48000, 0x7FFF);
+
+    SECTION("Stay silent without any step")
+    {
+        REQUIRE(buffer.read_samples(4194304, samples.data(), 2) == 48000);
+        for (size_t i = 0; i < samples.size(); i += 2)
+            REQUIRE(samples[i] == 0);
+        REQUIRE(samples[1] == 0x7FFF);
+        REQUIRE(buffer.samples_available(4194304) == 0);
+    }
+
+    SECTION("Settle on level of step, then decay back to silence")
+    {
+        buffer.add_delta(1000, 10000);
+        REQUIRE(buffer.read_samples(4194304 / 4, samples.data(), 1) == 12000);
+
+        const int16_t peak = *std::max_element(samples.begin(), samples.begin() + 12000);
+        REQUIRE(peak > 9000);
+        REQUIRE(peak < 11500);
+        REQUIRE(samples[0] == 0);
+        REQUIRE(std::abs(samples[11999]) < 10);
+    }
+
+    SECTION("Read steps spread over several reads exactly like one read")
+    {
+        cocoa::BlipBuffer other(4194304, 48000);
+        std::vector<int16_t> whole(4000);
+        std::vector<int16_t> split(4000);
+        size_t read = 0;
+        size_t next_read = 50000;
+        for (size_t time = 0; time < 300000; time += 1234) {
+            if (time >= next_read) {
+                read += other.read_samples(next_read, split.data() + read, 1);
+                next_read += 50000;
+            }
+
+            const int32_t delta = ((time / 1234) % 2 == 0) ? 3000 : -3000;
+            buffer.add_delta(time, delta);
+            other.add_delta(time, delta);
+        }
+
+        REQUIRE(buffer.read_samples(300000, whole.data(), 1) == 3433);
+        read += other.read_samples(300000, split.data() + read, 1);
+        REQUIRE(read == 3433);
+        REQUIRE(whole == split);
+    }
+
+    SECTION("Drop samples without writing them")
+    {
+        buffer.add_delta(0, 10000);
+        REQUIRE(buffer.read_samples(4194304, nullptr, 0) == 48000);
+        REQUIRE(buffer.samples_available(4194304) == 0);
+    }
+}
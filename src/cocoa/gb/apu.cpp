@@ -0,0 +1,537 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+#include "cocoa/gb/apu.hpp"
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/scheduler.hpp"
+#include "cocoa/utility.hpp"
+
+namespace cocoa::gb {
+constexpr uint16_t NR10_ADDRESS = from_enum(IoMap::NR10);
+constexpr uint16_t NR50_ADDRESS = from_enum(IoMap::NR50);
+constexpr uint16_t NR51_ADDRESS = from_enum(IoMap::NR51);
+constexpr uint16_t NR52_ADDRESS = from_enum(IoMap::NR52);
+constexpr uint16_t WAVE_RAM_START = from_enum(IoMap::WavePatternRamStart);
+constexpr uint16_t WAVE_RAM_END = from_enum(IoMap::WavePatternRamEnd);
+
+// NOTE: Sound registers span 0xFF10 to 0xFF2F, including unused ones that always read 0xFF.
+constexpr uint16_t SOUND_REGISTER_END = 0xFF2F;
+
+// NOTE: Each channel owns five registers starting at NR10, where NR20 and NR40 are unused.
+constexpr size_t REGISTERS_PER_CHANNEL = 5;
+
+// NOTE: Bits that read back as one, since they are unused or write-only.
+// clang-format off
+constexpr std::array<uint8_t, 0x20> READ_MASKS = {
+    0x80, 0x3F, 0x00, 0xFF, 0xBF, // NR10-NR14
+    0xFF, 0x3F, 0x00, 0xFF, 0xBF, // NR20-NR24
+    0x7F, 0xFF, 0x9F, 0xFF, 0xBF, // NR30-NR34
+    0xFF, 0xFF, 0x00, 0x00, 0xBF, // NR40-NR44
+    0x00, 0x00, 0x70,             // NR50-NR52
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+// clang-format on
+
+// NOTE: Step n of duty cycle is bit n of pattern, indexed by duty bits of NRx1.
+constexpr std::array<uint8_t, 4> DUTY_PATTERNS = { 0x80, 0x81, 0xE1, 0x7E };
+
+// NOTE: Right shift of wave samples, indexed by output level bits of NR32.
+constexpr std::array<uint8_t, 4> WAVE_SHIFTS = { 4, 0, 1, 2 };
+
+constexpr std::array<size_t, 8> NOISE_DIVISORS = { 8, 16, 32, 48, 64, 80, 96, 112 };
+constexpr std::array<uint16_t, APU_CHANNEL_COUNT> LENGTH_LIMITS = { 64, 64, 256, 64 };
+
+// NOTE: Scales mix so that four channels at full volume on both master volumes fill 16 bits.
+constexpr int32_t CHANNEL_GAIN = 64;
+
+constexpr size_t WAVE_CHANNEL = 2;
+constexpr size_t NOISE_CHANNEL = 3;
+
+Apu::Apu(MemoryBus& bus, const Scheduler& scheduler)
+    : m_bus(bus)
+    , m_scheduler(scheduler)
+    , m_channels {}
+    , m_synced(scheduler.peripheral_now())
+    , m_next_step(scheduler.peripheral_now() + APU_SEQUENCER_TSTATES)
+    , m_step(0)
+    , m_left(0)
+    , m_right(0)
+    , m_left_gain(CHANNEL_GAIN)
+    , m_right_gain(CHANNEL_GAIN)
+    , m_panning(0)
+    , m_left_buffer(APU_CLOCK_RATE, APU_SAMPLE_RATE, scheduler.peripheral_now())
+    , m_right_buffer(APU_CLOCK_RATE, APU_SAMPLE_RATE, scheduler.peripheral_now())
+{
+    for (uint16_t address = NR10_ADDRESS; address <= SOUND_REGISTER_END; ++address)
+        m_bus.map_io_handler(static_cast<IoMap>(address), { on_read, on_write, this });
+    for (uint16_t address = WAVE_RAM_START; address <= WAVE_RAM_END; ++address)
+        m_bus.map_io_handler(static_cast<IoMap>(address), { nullptr, on_write_wave, this });
+}
+
+void
+Apu::read_block(std::vector<int16_t>& block)
+{
+    sync();
+    const size_t now = m_scheduler.peripheral_now();
+    block.resize(2 * m_left_buffer.samples_available(now));
+    m_left_buffer.read_samples(now, block.data(), 2);
+    m_right_buffer.read_samples(now, block.data() + 1, 2);
+}
+
+bool
+Apu::is_playing(const size_t channel) const
+{
+    return m_channels[channel].enabled;
+}
+
+void
+Apu::save_state(ApuSnapshot& out) const
+{
+    out = {};
+    out.synced = m_synced;
+    out.next_step = m_next_step;
+    out.step = m_step;
+    for (size_t i = 0; i < APU_CHANNEL_COUNT; ++i) {
+        const Channel& channel = m_channels[i];
+        ApuChannelSnapshot& image = out.channels[i];
+        image.next_tick = channel.next_tick;
+        image.length = channel.length;
+        image.shadow = channel.shadow;
+        image.lfsr = channel.lfsr;
+        image.volume = channel.volume;
+        image.envelope_timer = channel.envelope_timer;
+        image.sweep_timer = channel.sweep_timer;
+        image.position = channel.position;
+        image.output = channel.output;
+        image.enabled = channel.enabled ? 1 : 0;
+        image.sweep_enabled = channel.sweep_enabled ? 1 : 0;
+    }
+}
+
+void
+Apu::load_state(const ApuSnapshot& snapshot)
+{
+    m_synced = snapshot.synced;
+    m_next_step = snapshot.next_step;
+    m_step = snapshot.step & 0x07;
+    for (size_t i = 0; i < APU_CHANNEL_COUNT; ++i) {
+        const ApuChannelSnapshot& image = snapshot.channels[i];
+        Channel& channel = m_channels[i];
+        channel.next_tick = image.next_tick;
+        channel.length = image.length;
+        channel.shadow = image.shadow;
+        channel.lfsr = image.lfsr;
+        channel.volume = image.volume;
+        channel.envelope_timer = image.envelope_timer;
+        channel.sweep_timer = image.sweep_timer;
+        channel.position = image.position;
+        channel.output = image.output;
+        channel.enabled = image.enabled != 0;
+        channel.sweep_enabled = image.sweep_enabled != 0;
+    }
+
+    m_left_buffer.clear(m_synced);
+    m_right_buffer.clear(m_synced);
+    m_left = 0;
+    m_right = 0;
+    update_outputs(m_synced);
+}
+
+uint8_t
+Apu::on_read(void* context, uint16_t address)
+{
+    Apu* apu = static_cast<Apu*>(context);
+    const uint8_t mask = READ_MASKS[address - NR10_ADDRESS];
+    if (address != NR52_ADDRESS)
+        return static_cast<uint8_t>(apu->m_bus.peek(address) | mask);
+
+    apu->sync();
+    uint8_t status = static_cast<uint8_t>(apu->m_bus.peek(address) | mask);
+    for (size_t i = 0; i < APU_CHANNEL_COUNT; ++i) {
+        if (apu->m_channels[i].enabled)
+            status = static_cast<uint8_t>(status | (1 << i));
+    }
+    return status;
+}
+
+void
+Apu::on_write(void* context, uint16_t address, uint8_t value)
+{
+    Apu* apu = static_cast<Apu*>(context);
+    apu->sync();
+    apu->write_register(address, value);
+}
+
+void
+Apu::on_write_wave(void* context, uint16_t address, uint8_t value)
+{
+    Apu* apu = static_cast<Apu*>(context);
+    apu->sync();
+    apu->m_bus.poke(address, value);
+}
+
+uint8_t
+Apu::reg(const size_t channel, const size_t index) const
+{
+    return m_bus.peek(
+        static_cast<uint16_t>(NR10_ADDRESS + channel * REGISTERS_PER_CHANNEL + index));
+}
+
+bool
+Apu::is_powered() const
+{
+    return is_bit_set<uint8_t, 7>(m_bus.peek(NR52_ADDRESS));
+}
+
+bool
+Apu::is_dac_on(const size_t channel) const
+{
+    if (channel == WAVE_CHANNEL)
+        return is_bit_set<uint8_t, 7>(reg(channel, 0));
+    return (reg(channel, 2) & 0xF8) != 0;
+}
+
+size_t
+Apu::period(const size_t channel) const
+{
+    if (channel == NOISE_CHANNEL) {
+        const uint8_t nr43 = reg(channel, 3);
+        return NOISE_DIVISORS[nr43 & 0x07] << (nr43 >> 4);
+    }
+
+    const size_t divider
+        = 2048 - static_cast<size_t>(((reg(channel, 4) & 0x07) << 8) | reg(channel, 3));
+    return (channel == WAVE_CHANNEL) ? divider * 2 : divider * 4;
+}
+
+uint8_t
+Apu::current_output(const size_t channel) const
+{
+    const Channel& state = m_channels[channel];
+    if (!state.enabled)
+        return 0;
+
+    if (channel == WAVE_CHANNEL) {
+        const uint8_t pair = m_bus.peek(static_cast<uint16_t>(WAVE_RAM_START + state.position / 2));
+        const uint8_t sample = (state.position & 1) ? (pair & 0x0F) : (pair >> 4);
+        return static_cast<uint8_t>(sample >> WAVE_SHIFTS[(reg(channel, 2) >> 5) & 0x03]);
+    }
+
+    if (channel == NOISE_CHANNEL)
+        return (state.lfsr & 1) ? 0 : state.volume;
+    return ((DUTY_PATTERNS[reg(channel, 1) >> 6] >> state.position) & 1) ? state.volume : 0;
+}
+
+void
+Apu::sync()
+{
+    const size_t now = m_scheduler.peripheral_now();
+    while (m_synced < now) {
+        const size_t end = std::min(now, m_next_step);
+        run_pulse(0, end);
+        run_pulse(1, end);
+        run_wave(end);
+        run_noise(end);
+        m_synced = end;
+        if (end == m_next_step) {
+            step_sequencer(end);
+            m_next_step += APU_SEQUENCER_TSTATES;
+        }
+    }
+
+    if (m_left_buffer.samples_available(now) > APU_MAX_PENDING_SAMPLES) {
+        m_left_buffer.read_samples(now, nullptr, 0);
+        m_right_buffer.read_samples(now, nullptr, 0);
+    }
+}
+
+void
+Apu::run_pulse(const size_t channel, const size_t end)
+{
+    Channel& state = m_channels[channel];
+    if (!state.enabled || state.next_tick > end)
+        return;
+
+    // NOTE: Silent channel cannot change output, so only its duty step needs to keep up.
+    const size_t ticks_period = period(channel);
+    if (state.volume == 0) {
+        const size_t ticks = (end - state.next_tick) / ticks_period + 1;
+        state.position = static_cast<uint8_t>((state.position + ticks) & 0x07);
+        state.next_tick += ticks * ticks_period;
+        return;
+    }
+
+    const uint8_t pattern = DUTY_PATTERNS[reg(channel, 1) >> 6];
+    while (state.next_tick <= end) {
+        state.position = (state.position + 1) & 0x07;
+        set_output(channel, ((pattern >> state.position) & 1) ? state.volume : 0, state.next_tick);
+        state.next_tick += ticks_period;
+    }
+}
+
+void
+Apu::run_wave(const size_t end)
+{
+    Channel& state = m_channels[WAVE_CHANNEL];
+    if (!state.enabled || state.next_tick > end)
+        return;
+
+    const size_t ticks_period = period(WAVE_CHANNEL);
+    const uint8_t shift = WAVE_SHIFTS[(reg(WAVE_CHANNEL, 2) >> 5) & 0x03];
+    if (shift == 4) {
+        const size_t ticks = (end - state.next_tick) / ticks_period + 1;
+        state.position = static_cast<uint8_t>((state.position + ticks) & 0x1F);
+        state.next_tick += ticks * ticks_period;
+        return;
+    }
+
+    while (state.next_tick <= end) {
+        state.position = (state.position + 1) & 0x1F;
+        const uint8_t pair = m_bus.peek(static_cast<uint16_t>(WAVE_RAM_START + state.position / 2));
+        const uint8_t sample = (state.position & 1) ? (pair & 0x0F) : (pair >> 4);
+        set_output(WAVE_CHANNEL, static_cast<uint8_t>(sample >> shift), state.next_tick);
+        state.next_tick += ticks_period;
+    }
+}
+
+void
+Apu::run_noise(const size_t end)
+{
+    Channel& state = m_channels[NOISE_CHANNEL];
+    if (!state.enabled || state.next_tick > end)
+        return;
+
+    // NOTE: Clock shifts of 14 and 15 leave channel without any clock at all.
+    const uint8_t nr43 = reg(NOISE_CHANNEL, 3);
+    if ((nr43 >> 4) >= 14) {
+        state.next_tick = end + 1;
+        return;
+    }
+
+    const size_t ticks_period = period(NOISE_CHANNEL);
+    const bool narrow = is_bit_set<uint8_t, 3>(nr43);
+    while (state.next_tick <= end) {
+        const uint16_t feedback = (state.lfsr ^ (state.lfsr >> 1)) & 1;
+        state.lfsr = static_cast<uint16_t>((state.lfsr >> 1) | (feedback << 14));
+        if (narrow)
+            state.lfsr = static_cast<uint16_t>((state.lfsr & ~(1 << 6)) | (feedback << 6));
+        set_output(NOISE_CHANNEL, (state.lfsr & 1) ? 0 : state.volume, state.next_tick);
+        state.next_tick += ticks_period;
+    }
+}
+
+void
+Apu::step_sequencer(const size_t time)
+{
+    const uint8_t step = m_step;
+    m_step = (m_step + 1) & 0x07;
+    if (!is_powered())
+        return;
+
+    if ((step & 1) == 0) {
+        for (size_t i = 0; i < APU_CHANNEL_COUNT; ++i) {
+            Channel& state = m_channels[i];
+            if (!is_bit_set<uint8_t, 6>(reg(i, 4)) || state.length == 0)
+                continue;
+            if (--state.length == 0)
+                state.enabled = false;
+        }
+    }
+
+    Channel& sweep = m_channels[0];
+    if ((step == 2 || step == 6) && sweep.enabled) {
+        if (sweep.sweep_timer > 0)
+            --sweep.sweep_timer;
+        if (sweep.sweep_timer == 0) {
+            const uint8_t nr10 = reg(0, 0);
+            const uint8_t pace = (nr10 >> 4) & 0x07;
+            sweep.sweep_timer = (pace != 0) ? pace : 8;
+            if (sweep.sweep_enabled && pace != 0) {
+                const uint16_t next = sweep_period();
+                if (next <= 0x07FF && (nr10 & 0x07) != 0) {
+                    sweep.shadow = next;
+                    const uint16_t nr14 = NR10_ADDRESS + 4;
+                    m_bus.poke(NR10_ADDRESS + 3, from_low(next));
+                    m_bus.poke(nr14, static_cast<uint8_t>((m_bus.peek(nr14) & 0xF8) | (next >> 8)));
+                    sweep_period();
+                }
+            }
+        }
+    }
+
+    if (step == 7) {
+        for (const size_t i : { size_t(0), size_t(1), NOISE_CHANNEL }) {
+            Channel& state = m_channels[i];
+            const uint8_t envelope = reg(i, 2);
+            if ((envelope & 0x07) == 0)
+                continue;
+            if (state.envelope_timer > 0)
+                --state.envelope_timer;
+            if (state.envelope_timer != 0)
+                continue;
+
+            state.envelope_timer = envelope & 0x07;
+            if (is_bit_set<uint8_t, 3>(envelope) && state.volume < 15)
+                ++state.volume;
+            else if (!is_bit_set<uint8_t, 3>(envelope) && state.volume > 0)
+                --state.volume;
+        }
+    }
+
+    update_outputs(time);
+}
+
+void
+Apu::write_register(const uint16_t address, const uint8_t value)
+{
+    if (address == NR52_ADDRESS) {
+        const bool was_powered = is_powered();
+        m_bus.poke(address, static_cast<uint8_t>(value & 0x80));
+        if (was_powered && !is_powered())
+            power_off();
+        else if (!was_powered && is_powered())
+            m_step = 0;
+        update_outputs(m_synced);
+        return;
+    }
+
+    // NOTE: Every register but NR52 ignores writes while powered off.
+    if (!is_powered() || address > NR51_ADDRESS)
+        return;
+
+    const size_t offset = address - NR10_ADDRESS;
+    const size_t channel = offset / REGISTERS_PER_CHANNEL;
+    const size_t index = offset % REGISTERS_PER_CHANNEL;
+    if (address < NR50_ADDRESS && index == 0 && channel != 0 && channel != WAVE_CHANNEL)
+        return;
+
+    m_bus.poke(address, value);
+    if (channel < APU_CHANNEL_COUNT) {
+        Channel& state = m_channels[channel];
+        if (index == 1)
+            state.length = static_cast<uint16_t>(
+                LENGTH_LIMITS[channel] - ((channel == WAVE_CHANNEL) ? value : (value & 0x3F)));
+
+        const size_t dac_index = (channel == WAVE_CHANNEL) ? 0 : 2;
+        if (index == dac_index && !is_dac_on(channel))
+            state.enabled = false;
+
+        if (index == 4 && is_bit_set<uint8_t, 7>(value))
+            trigger(channel);
+    }
+
+    update_outputs(m_synced);
+}
+
+void
+Apu::trigger(const size_t channel)
+{
+    Channel& state = m_channels[channel];
+    state.enabled = is_dac_on(channel);
+    if (state.length == 0)
+        state.length = LENGTH_LIMITS[channel];
+    state.next_tick = m_synced + period(channel);
+
+    if (channel == WAVE_CHANNEL) {
+        state.position = 0;
+        return;
+    }
+
+    const uint8_t envelope = reg(channel, 2);
+    state.volume = envelope >> 4;
+    state.envelope_timer = envelope & 0x07;
+    if (channel == NOISE_CHANNEL)
+        state.lfsr = 0x7FFF;
+
+    if (channel == 0) {
+        const uint8_t nr10 = reg(0, 0);
+        const uint8_t pace = (nr10 >> 4) & 0x07;
+        state.shadow = static_cast<uint16_t>(((reg(0, 4) & 0x07) << 8) | reg(0, 3));
+        state.sweep_timer = (pace != 0) ? pace : 8;
+        state.sweep_enabled = pace != 0 || (nr10 & 0x07) != 0;
+        if ((nr10 & 0x07) != 0)
+            sweep_period();
+    }
+}
+
+uint16_t
+Apu::sweep_period()
+{
+    Channel& state = m_channels[0];
+    const uint8_t nr10 = reg(0, 0);
+    const uint16_t delta = state.shadow >> (nr10 & 0x07);
+    const uint16_t next = static_cast<uint16_t>(
+        is_bit_set<uint8_t, 3>(nr10) ? state.shadow - delta : state.shadow + delta);
+    if (next > 0x07FF)
+        state.enabled = false;
+    return next;
+}
+
+void
+Apu::power_off()
+{
+    for (uint16_t address = NR10_ADDRESS; address <= NR51_ADDRESS; ++address)
+        m_bus.poke(address, 0);
+    for (Channel& state : m_channels)
+        state.enabled = false;
+}
+
+void
+Apu::set_output(const size_t channel, const uint8_t output, const size_t time)
+{
+    Channel& state = m_channels[channel];
+    if (output == state.output)
+        return;
+
+    // INVARIANT: Only enabled channels change output here, and those always have their DAC on.
+    const int32_t delta = 2 * (static_cast<int32_t>(output) - state.output);
+    state.output = output;
+    if ((m_panning >> (channel + 4)) & 1) {
+        m_left += delta * m_left_gain;
+        m_left_buffer.add_delta(time, delta * m_left_gain);
+    }
+    if ((m_panning >> channel) & 1) {
+        m_right += delta * m_right_gain;
+        m_right_buffer.add_delta(time, delta * m_right_gain);
+    }
+}
+
+void
+Apu::update_outputs(const size_t time)
+{
+    const uint8_t nr50 = m_bus.peek(NR50_ADDRESS);
+    m_panning = m_bus.peek(NR51_ADDRESS);
+    m_left_gain = (((nr50 >> 4) & 0x07) + 1) * CHANNEL_GAIN;
+    m_right_gain = ((nr50 & 0x07) + 1) * CHANNEL_GAIN;
+
+    // NOTE: DAC maps digital output from 0 to 15 onto a level centered around zero.
+    int32_t left = 0;
+    int32_t right = 0;
+    for (size_t i = 0; i < APU_CHANNEL_COUNT; ++i) {
+        m_channels[i].output = current_output(i);
+        const int32_t level = is_dac_on(i) ? 2 * m_channels[i].output - 15 : 0;
+        if ((m_panning >> (i + 4)) & 1)
+            left += level;
+        if ((m_panning >> i) & 1)
+            right += level;
+    }
+
+    left *= m_left_gain;
+    right *= m_right_gain;
+    if (left != m_left) {
+        m_left_buffer.add_delta(time, left - m_left);
+        m_left = left;
+    }
+    if (right != m_right) {
+        m_right_buffer.add_delta(time, right - m_right);
+        m_right = right;
+    }
+}
+} // namespace cocoa::gb
@@ -0,0 +1,249 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_GB_APU_HPP
+#define COCOA_GB_APU_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "cocoa/blip_buffer.hpp"
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/scheduler.hpp"
+
+namespace cocoa::gb {
+/// @brief Amount of t-states per second.
+constexpr size_t APU_CLOCK_RATE = 4194304;
+
+/// @brief Amount of stereo sample frames per second of audio output.
+constexpr size_t APU_SAMPLE_RATE = 48000;
+
+/// @brief Amount of t-states between steps of frame sequencer, i.e., 512 Hz.
+constexpr size_t APU_SEQUENCER_TSTATES = 8192;
+
+/// @brief Amount of sample frames kept for reading before the oldest ones are dropped.
+constexpr size_t APU_MAX_PENDING_SAMPLES = APU_SAMPLE_RATE;
+
+/// @brief Amount of sound channels.
+constexpr size_t APU_CHANNEL_COUNT = 4;
+
+/// @brief Plain image of one sound channel stored in save states.
+///
+/// @invariant Fields are fixed width and explicitly padded, so layout is identical across builds.
+struct ApuChannelSnapshot final {
+    uint64_t next_tick;
+    uint16_t length;
+    uint16_t shadow;
+    uint16_t lfsr;
+    uint8_t volume;
+    uint8_t envelope_timer;
+    uint8_t sweep_timer;
+    uint8_t position;
+    uint8_t output;
+    uint8_t enabled;
+    uint8_t sweep_enabled;
+    std::array<uint8_t, 3> reserved;
+};
+
+static_assert(sizeof(ApuChannelSnapshot) == 24);
+
+/// @brief Plain image of APU state stored in save states.
+///
+/// Samples not yet read are not part of it.
+///
+/// @invariant Fields are fixed width and explicitly padded, so layout is identical across builds.
+struct ApuSnapshot final {
+    uint64_t synced;
+    uint64_t next_step;
+    std::array<ApuChannelSnapshot, APU_CHANNEL_COUNT> channels;
+    uint8_t step;
+    std::array<uint8_t, 7> reserved;
+};
+
+static_assert(sizeof(ApuSnapshot) == 24 + 24 * APU_CHANNEL_COUNT);
+
+/// @brief GameBoy audio processing unit.
+///
+/// Synthesizes both pulse channels, wave channel, and noise channel lazily. Nothing runs while
+/// CPU executes. APU catches up with peripheral time only when a sound register is accessed or a
+/// block of audio is read, and never posts events to scheduler. Catching up advances each
+/// channel from one output change to the next in bulk, and jumps straight over stretches where
+/// channel output cannot change.
+///
+/// Every change of mixed output is fed into a band-limited step synthesizer per stereo side, so
+/// output is free of aliasing at `APU_SAMPLE_RATE` no matter how fast channels toggle. Audio is
+/// handed out in blocks of interleaved 16-bit stereo samples. Samples not read within
+/// `APU_MAX_PENDING_SAMPLES` are dropped, so a frontend without audio never piles them up.
+///
+/// Sound registers and wave RAM are kept in plain bus memory, and read back through I/O handlers
+/// that apply unused bit masks. Frame sequencer steps every `APU_SEQUENCER_TSTATES` relative to
+/// construction rather than to DIV, so resetting DIV does not shift it.
+///
+/// @see https://gbdev.io/pandocs/Audio.html
+/// @see https://gbdev.io/pandocs/Audio_Registers.html
+class Apu final {
+public:
+    /// @brief Attach APU to sound registers and wave RAM of memory bus.
+    ///
+    /// APU starts powered off, like it does before boot ROM enables it.
+    ///
+    /// @param [in] bus Memory bus to attach to.
+    /// @param [in] scheduler Scheduler to read peripheral time from.
+    Apu(MemoryBus& bus, const Scheduler& scheduler);
+
+    Apu(const Apu&) = delete;
+
+    Apu&
+    operator=(const Apu&) = delete;
+
+    ~Apu() noexcept = default;
+
+    /// @brief Catch up with current time, and hand out every sample completed so far.
+    ///
+    /// @param [out] block Interleaved left and right samples. Buffer is reused, so reading every
+    ///                    frame does not allocate once it has grown to size.
+    void
+    read_block(std::vector<int16_t>& block);
+
+    /// @brief Check if channel is currently playing, as reported by NR52.
+    ///
+    /// @param [in] channel Channel from 0 to 3.
+    [[nodiscard]]
+    bool
+    is_playing(const size_t channel) const;
+
+    /// @brief Capture APU state for save state.
+    ///
+    /// @param [out] out Snapshot to fill.
+    void
+    save_state(ApuSnapshot& out) const;
+
+    /// @brief Restore APU state from save state.
+    ///
+    /// Samples not yet read are dropped, and output resumes from silence.
+    ///
+    /// @param [in] snapshot Snapshot to restore from.
+    void
+    load_state(const ApuSnapshot& snapshot);
+
+private:
+    /// @brief Running state of one sound channel, apart from its registers.
+    struct Channel final {
+        /// Time at which frequency timer of channel next expires.
+        size_t next_tick;
+        uint16_t length;
+
+        /// Period that sweep of channel 1 works on.
+        uint16_t shadow;
+
+        /// Linear-feedback shift register of channel 4.
+        uint16_t lfsr;
+        uint8_t volume;
+        uint8_t envelope_timer;
+        uint8_t sweep_timer;
+
+        /// Step of duty cycle, or sample index into wave RAM.
+        uint8_t position;
+
+        /// Digital output from 0 to 15 that mix currently holds.
+        uint8_t output;
+        bool enabled;
+        bool sweep_enabled;
+    };
+
+    static uint8_t
+    on_read(void* context, uint16_t address);
+
+    static void
+    on_write(void* context, uint16_t address, uint8_t value);
+
+    static void
+    on_write_wave(void* context, uint16_t address, uint8_t value);
+
+    [[nodiscard]]
+    uint8_t
+    reg(const size_t channel, const size_t index) const;
+
+    [[nodiscard]]
+    bool
+    is_powered() const;
+
+    [[nodiscard]]
+    bool
+    is_dac_on(const size_t channel) const;
+
+    /// @brief Get amount of t-states per frequency timer expiry of channel.
+    [[nodiscard]]
+    size_t
+    period(const size_t channel) const;
+
+    /// @brief Get digital output that channel holds according to its state.
+    [[nodiscard]]
+    uint8_t
+    current_output(const size_t channel) const;
+
+    /// @brief Catch every channel up with current time.
+    void
+    sync();
+
+    void
+    run_pulse(const size_t channel, const size_t end);
+
+    void
+    run_wave(const size_t end);
+
+    void
+    run_noise(const size_t end);
+
+    /// @brief Clock length counters, sweep, and envelopes due at current sequencer step.
+    void
+    step_sequencer(const size_t time);
+
+    /// @brief Apply write to sound register once APU caught up with it.
+    void
+    write_register(const uint16_t address, const uint8_t value);
+
+    void
+    trigger(const size_t channel);
+
+    /// @brief Compute next period of sweep, disabling channel 1 on overflow.
+    uint16_t
+    sweep_period();
+
+    void
+    power_off();
+
+    /// @brief Change digital output of channel at given time.
+    void
+    set_output(const size_t channel, const uint8_t output, const size_t time);
+
+    /// @brief Recompute output of every channel and whole mix at given time.
+    void
+    update_outputs(const size_t time);
+
+    MemoryBus& m_bus;
+    const Scheduler& m_scheduler;
+    std::array<Channel, APU_CHANNEL_COUNT> m_channels;
+
+    /// Time up to which every channel is accurate.
+    size_t m_synced;
+
+    /// Time of next frame sequencer step.
+    size_t m_next_step;
+    uint8_t m_step;
+
+    /// Current level of mix per side, and gain applied to each channel per side.
+    int32_t m_left;
+    int32_t m_right;
+    int32_t m_left_gain;
+    int32_t m_right_gain;
+    uint8_t m_panning;
+
+    BlipBuffer m_left_buffer;
+    BlipBuffer m_right_buffer;
+};
+} // namespace cocoa::gb
+
+#endif // COCOA_GB_APU_HPP
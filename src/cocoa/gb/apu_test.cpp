@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "cocoa/gb/apu.hpp"
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/scheduler.hpp"
+
+/// @brief Power APU on, and play channel 2 as a 64 Hz square wave at full volume on right side.
+static void
+play_square(cocoa::gb::MemoryBus& bus, const uint8_t length = 0, const bool stop = false)
+{
+    bus.write_io_reg(cocoa::gb::IoMap::NR52, 0x80);
+    bus.write_io_reg(cocoa::gb::IoMap::NR50, 0x77);
+    bus.write_io_reg(cocoa::gb::IoMap::NR51, 0x02);
+    bus.write_io_reg(cocoa::gb::IoMap::NR21, static_cast<uint8_t>(0x80 | length));
+    bus.write_io_reg(cocoa::gb::IoMap::NR22, 0xF0);
+    bus.write_io_reg(cocoa::gb::IoMap::NR23, 0x00);
+    bus.write_io_reg(cocoa::gb::IoMap::NR24, stop ? 0xC0 : 0x80);
+}
+
+TEST_CASE("cocoa::gb::Apu::Apu(MemoryBus&, const Scheduler&)", "[apu]")
+{
+    size_t clock = 0;
+    cocoa::gb::MemoryBus bus {};
+    cocoa::gb::Scheduler scheduler(clock);
+    cocoa::gb::Apu apu(bus, scheduler);
+
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::NR52) == 0x70);
+    bus.write_io_reg(cocoa::gb::IoMap::NR50, 0x77);
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::NR50) == 0x00);
+
+    bus.write_io_reg(cocoa::gb::IoMap::NR52, 0x80);
+    bus.write_io_reg(cocoa::gb::IoMap::NR50, 0x77);
+    bus.write_io_reg(cocoa::gb::IoMap::NR11, 0x80);
+    bus.write_io_reg(cocoa::gb::IoMap::NR13, 0x12);
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::NR52) == 0xF0);
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::NR50) == 0x77);
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::NR11) == 0xBF);
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::NR13) == 0xFF);
+    REQUIRE(scheduler.next_deadline() == cocoa::gb::NO_DEADLINE);
+
+    bus.write_io_reg(cocoa::gb::IoMap::NR52, 0x00);
+    bus.write_io_reg(cocoa::gb::IoMap::NR52, 0x80);
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::NR50) == 0x00);
+}
+
+TEST_CASE("bool cocoa::gb::Apu::is_playing(const size_t) const", "[is_playing]")
+{
+    size_t clock = 0;
+    cocoa::gb::MemoryBus bus {};
+    cocoa::gb::Scheduler scheduler(clock);
+    cocoa::gb::Apu apu(bus, scheduler);
+
+    SECTION("Stop once length counter expires")
+    {
+        play_square(bus, 62, true);
+        REQUIRE(apu.is_playing(1));
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::NR52) == 0xF2);
+
+        // NOTE: Length counter is clocked every other sequencer step, starting with first one.
+        clock += cocoa::gb::APU_SEQUENCER_TSTATES;
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::NR52) == 0xF2);
+        clock += 2 * cocoa::gb::APU_SEQUENCER_TSTATES;
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::NR52) == 0xF0);
+        REQUIRE(!apu.is_playing(1));
+    }
+
+    SECTION("Stop once DAC is turned off")
+    {
+        play_square(bus);
+        clock += 1000;
+        bus.write_io_reg(cocoa::gb::IoMap::NR22, 0x00);
+        REQUIRE(!apu.is_playing(1));
+    }
+
+    SECTION("Stop once powered off")
+    {
+        play_square(bus);
+        bus.write_io_reg(cocoa::gb::IoMap::NR52, 0x00);
+        REQUIRE(!apu.is_playing(1));
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::NR52) == 0x70);
+    }
+}
+
+TEST_CASE("void cocoa::gb::Apu::read_block(std::vector<int16_t>&)", "[read_block]")
+{
+    size_t clock = 0;
+    cocoa::gb::MemoryBus bus {};
+    cocoa::gb::Scheduler scheduler(clock);
+    cocoa::gb::Apu apu(bus, scheduler);
+    std::vector<int16_t> block;
+
+    SECTION("Hand out one block of interleaved stereo samples")
+    {
+        clock += cocoa::gb::APU_CLOCK_RATE / 8;
+        apu.read_block(block);
+        REQUIRE(block.size() == 2 * cocoa::gb::APU_SAMPLE_RATE / 8);
+        REQUIRE(std::all_of(
+            block.begin(), block.end(), [](int16_t sample) { return sample == 0; }));
+
+        apu.read_block(block);
+        REQUIRE(block.empty());
+    }
+
+    SECTION("Play square wave on panned side only")
+    {
+        play_square(bus);
+        clock += cocoa::gb::APU_CLOCK_RATE / 8;
+        apu.read_block(block);
+
+        // NOTE: Square wave at 64 Hz flips 16 times in an eighth of a second. Ringing around
+        // each flip is ignored by only counting swings from well above to well below zero.
+        int16_t left = 0;
+        bool high = false;
+        size_t flips = 0;
+        for (size_t i = 0; i < block.size(); i += 2) {
+            left = std::max(left, block[i]);
+            if ((high && block[i + 1] < -2000) || (!high && block[i + 1] > 2000)) {
+                high = !high;
+                ++flips;
+            }
+        }
+        REQUIRE(left == 0);
+        REQUIRE(flips >= 15);
+        REQUIRE(flips <= 17);
+    }
+
+    SECTION("Produce identical blocks no matter how often they are read")
+    {
+        cocoa::gb::MemoryBus other_bus {};
+        cocoa::gb::Apu other(other_bus, scheduler);
+        play_square(bus);
+        play_square(other_bus);
+
+        std::vector<int16_t> whole;
+        std::vector<int16_t> pieces;
+        for (size_t i = 0; i < 10; ++i) {
+            clock += cocoa::gb::APU_CLOCK_RATE / 100;
+            apu.read_block(block);
+            pieces.insert(pieces.end(), block.begin(), block.end());
+        }
+        other.read_block(whole);
+        REQUIRE(whole == pieces);
+    }
+}
+
+TEST_CASE("void cocoa::gb::Apu::load_state(const ApuSnapshot&)", "[load_state]")
+{
+    size_t clock = 0;
+    cocoa::gb::MemoryBus bus {};
+    cocoa::gb::Scheduler scheduler(clock);
+    cocoa::gb::Apu apu(bus, scheduler);
+
+    play_square(bus, 62, true);
+    cocoa::gb::ApuSnapshot snapshot = {};
+    apu.save_state(snapshot);
+
+    clock += 3 * cocoa::gb::APU_SEQUENCER_TSTATES;
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::NR52) == 0xF0);
+
+    clock = 0;
+    apu.load_state(snapshot);
+    REQUIRE(apu.is_playing(1));
+    clock += 3 * cocoa::gb::APU_SEQUENCER_TSTATES;
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::NR52) == 0xF0);
+}
@@ -0,0 +1,225 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define COCOA_HAS_MMAP 1
+#endif
+
+#include <fmt/format.h>
+
+#include "cocoa/gb/cartridge.hpp"
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/utility.hpp"
+
+namespace cocoa::gb {
+// NOTE: Smallest valid ROM is two banks, i.e., 32 KiB without any MBC.
+constexpr size_t MIN_ROM_SIZE = 2 * ROM_BANK_SIZE;
+
+static size_t
+decode_ram_size(const uint8_t code)
+{
+    constexpr std::array<size_t, 6> sizes = { 0, 0, 0x2000, 0x8000, 0x20000, 0x10000 };
+    if (code >= sizes.size())
+        throw CartridgeError(fmt::format("Unknown RAM size code 0x{0:02X}", code));
+    return sizes[code];
+}
+
+Cartridge::Cartridge(const std::filesystem::path& path)
+    : m_data(nullptr)
+    , m_size(0)
+    , m_ram_size(0)
+    , m_title()
+    , m_fallback()
+{
+#ifdef COCOA_HAS_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        throw CartridgeError(fmt::format("Cannot open ROM '{0}'", path.string()));
+
+    struct stat info = {};
+    if (::fstat(fd, &info) != 0 || info.st_size < 0) {
+        ::close(fd);
+        throw CartridgeError(fmt::format("Cannot stat ROM '{0}'", path.string()));
+    }
+
+    m_size = static_cast<size_t>(info.st_size);
+    if (m_size >= MIN_ROM_SIZE) {
+        // INVARIANT: Private read-only mapping of a file is backed by the page cache, so every
+        // process and instance mapping the same ROM shares the same physical pages.
+        void* mapping = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            ::close(fd);
+            throw CartridgeError(fmt::format("Cannot map ROM '{0}'", path.string()));
+        }
+        m_data = static_cast<const uint8_t*>(mapping);
+    }
+    ::close(fd);
+#else
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        throw CartridgeError(fmt::format("Cannot open ROM '{0}'", path.string()));
+    m_fallback.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    m_data = m_fallback.data();
+    m_size = m_fallback.size();
+#endif // COCOA_HAS_MMAP
+
+    try {
+        if (m_size < MIN_ROM_SIZE || m_size % ROM_BANK_SIZE != 0) {
+            throw CartridgeError(
+                fmt::format("ROM '{0}' has invalid size of {1} bytes", path.string(), m_size));
+        }
+
+        const uint8_t rom_size = header(CartridgeHeader::RomSize);
+        if (rom_size > 8 || (MIN_ROM_SIZE << rom_size) > m_size) {
+            throw CartridgeError(
+                fmt::format("ROM '{0}' is smaller than its header declares", path.string()));
+        }
+
+        m_ram_size = decode_ram_size(header(CartridgeHeader::RamSize));
+    } catch (...) {
+        release();
+        throw;
+    }
+
+    constexpr size_t max_length
+        = from_enum(CartridgeHeader::TitleEnd) - from_enum(CartridgeHeader::TitleStart) + 1;
+    const char* title
+        = reinterpret_cast<const char*>(m_data + from_enum(CartridgeHeader::TitleStart));
+    size_t length = 0;
+    while (length < max_length && title[length] > 0)
+        ++length;
+    m_title = std::string_view(title, length);
+}
+
+Cartridge::~Cartridge() noexcept
+{
+    release();
+}
+
+void
+Cartridge::attach(MemoryBus& bus) const
+{
+    switch_bank0(bus, 0);
+    switch_bank(bus, 1);
+}
+
+void
+Cartridge::switch_bank(MemoryBus& bus, const size_t bank) const
+{
+    bus.map_pages(from_enum(MemoryMap::RomXStart), from_enum(MemoryMap::RomXEnd), rom_bank(bank),
+        nullptr);
+}
+
+void
+Cartridge::switch_bank0(MemoryBus& bus, const size_t bank) const
+{
+    bus.map_pages(from_enum(MemoryMap::Rom0Start), from_enum(MemoryMap::Rom0End), rom_bank(bank),
+        nullptr);
+}
+
+const uint8_t*
+Cartridge::rom_bank(const size_t bank) const
+{
+    return m_data + (bank % rom_banks()) * ROM_BANK_SIZE;
+}
+
+size_t
+Cartridge::rom_banks() const
+{
+    return m_size / ROM_BANK_SIZE;
+}
+
+size_t
+Cartridge::rom_size() const
+{
+    return m_size;
+}
+
+size_t
+Cartridge::ram_size() const
+{
+    return m_ram_size;
+}
+
+CartridgeType
+Cartridge::type() const
+{
+    return static_cast<CartridgeType>(header(CartridgeHeader::Type));
+}
+
+std::string_view
+Cartridge::title() const
+{
+    return m_title;
+}
+
+bool
+Cartridge::is_cgb() const
+{
+    return is_bit_set<uint8_t, 7>(header(CartridgeHeader::CgbFlag));
+}
+
+bool
+Cartridge::is_header_valid() const
+{
+    uint8_t checksum = 0;
+    for (uint16_t addr = from_enum(CartridgeHeader::TitleStart);
+         addr < from_enum(CartridgeHeader::HeaderChecksum); ++addr)
+        checksum = static_cast<uint8_t>(checksum - m_data[addr] - 1);
+    return checksum == header(CartridgeHeader::HeaderChecksum);
+}
+
+bool
+Cartridge::is_global_valid() const
+{
+    uint16_t checksum = 0;
+    for (size_t addr = 0; addr < m_size; ++addr)
+        checksum = static_cast<uint16_t>(checksum + m_data[addr]);
+    checksum = static_cast<uint16_t>(
+        checksum - header(CartridgeHeader::GlobalChecksumHigh)
+        - header(CartridgeHeader::GlobalChecksumLow));
+    return checksum
+        == from_pair(header(CartridgeHeader::GlobalChecksumHigh),
+            header(CartridgeHeader::GlobalChecksumLow));
+}
+
+void
+Cartridge::release() noexcept
+{
+#ifdef COCOA_HAS_MMAP
+    if (m_data != nullptr)
+        ::munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif // COCOA_HAS_MMAP
+    m_data = nullptr;
+}
+
+uint8_t
+Cartridge::header(const CartridgeHeader field) const
+{
+    return m_data[from_enum(field)];
+}
+
+CartridgeError::CartridgeError(std::string message)
+    : m_message(message)
+{
+}
+
+const char*
+CartridgeError::what() const noexcept
+{
+    return m_message.c_str();
+}
+} // namespace cocoa::gb
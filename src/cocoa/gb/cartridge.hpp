@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_GB_CARTRIDGE_HPP
+#define COCOA_GB_CARTRIDGE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "cocoa/gb/memory.hpp"
+
+namespace cocoa::gb {
+/// @brief Size of one switchable ROM bank.
+constexpr size_t ROM_BANK_SIZE = 0x4000;
+
+/// @brief Cartridge header fields.
+///
+/// @see https://gbdev.io/pandocs/The_Cartridge_Header.html
+enum class CartridgeHeader : uint16_t {
+    TitleStart = 0x0134,
+    TitleEnd = 0x0143,
+    CgbFlag = 0x0143,
+    Type = 0x0147,
+    RomSize = 0x0148,
+    RamSize = 0x0149,
+    HeaderChecksum = 0x014D,
+    GlobalChecksumHigh = 0x014E,
+    GlobalChecksumLow = 0x014F,
+};
+
+/// @brief Cartridge hardware identified by header.
+///
+/// @see https://gbdev.io/pandocs/The_Cartridge_Header.html#0147--cartridge-type
+enum class CartridgeType : uint8_t {
+    RomOnly = 0x00,
+    Mbc1 = 0x01,
+    Mbc1Ram = 0x02,
+    Mbc1RamBattery = 0x03,
+    Mbc2 = 0x05,
+    Mbc2Battery = 0x06,
+    RomRam = 0x08,
+    RomRamBattery = 0x09,
+    Mbc3TimerBattery = 0x0F,
+    Mbc3TimerRamBattery = 0x10,
+    Mbc3 = 0x11,
+    Mbc3Ram = 0x12,
+    Mbc3RamBattery = 0x13,
+    Mbc5 = 0x19,
+    Mbc5Ram = 0x1A,
+    Mbc5RamBattery = 0x1B,
+    Mbc5Rumble = 0x1C,
+    Mbc5RumbleRam = 0x1D,
+    Mbc5RumbleRamBattery = 0x1E,
+};
+
+/// @brief GameBoy cartridge ROM.
+///
+/// The ROM file is memory mapped read-only rather than copied onto the heap. Thus, memory bus
+/// pages covering ROM point straight into the mapping, and switching banks only repoints pages.
+/// Every cartridge mapping the same file shares the same physical pages through the page cache of
+/// the host, so many emulator instances can share one cartridge, or even one file, cheaply.
+///
+/// @see https://gbdev.io/pandocs/The_Cartridge_Header.html
+class Cartridge final {
+public:
+    /// @brief Map ROM file and parse its header.
+    ///
+    /// @param [in] path Path to ROM file.
+    ///
+    /// @throws `CartridgeError` if ROM file cannot be mapped, or has a malformed header.
+    explicit Cartridge(const std::filesystem::path& path);
+
+    Cartridge(const Cartridge&) = delete;
+
+    Cartridge&
+    operator=(const Cartridge&) = delete;
+
+    ~Cartridge() noexcept;
+
+    /// @brief Map ROM banks into memory bus.
+    ///
+    /// Bank 0 goes to `Rom0Start..Rom0End`, and bank 1 goes to `RomXStart..RomXEnd`. Both ranges
+    /// become read-only.
+    ///
+    /// @param [in] bus Memory bus to map ROM into.
+    void
+    attach(MemoryBus& bus) const;
+
+    /// @brief Map ROM bank into `RomXStart..RomXEnd` region of memory bus.
+    ///
+    /// @param [in] bus Memory bus to map ROM bank into.
+    /// @param [in] bank ROM bank number, wrapped around total amount of banks.
+    void
+    switch_bank(MemoryBus& bus, const size_t bank) const;
+
+    /// @brief Map ROM bank into `Rom0Start..Rom0End` region of memory bus.
+    ///
+    /// @note Only needed by mappers that can bank the lower ROM region, e.g., MBC1 mode 1.
+    ///
+    /// @param [in] bus Memory bus to map ROM bank into.
+    /// @param [in] bank ROM bank number, wrapped around total amount of banks.
+    void
+    switch_bank0(MemoryBus& bus, const size_t bank) const;
+
+    /// @brief Get host pointer to start of ROM bank.
+    ///
+    /// @param [in] bank ROM bank number, wrapped around total amount of banks.
+    /// @return Read-only pointer to first byte of ROM bank.
+    [[nodiscard]]
+    const uint8_t*
+    rom_bank(const size_t bank) const;
+
+    /// @brief Get total amount of ROM banks.
+    [[nodiscard]]
+    size_t
+    rom_banks() const;
+
+    /// @brief Get size of ROM in bytes.
+    [[nodiscard]]
+    size_t
+    rom_size() const;
+
+    /// @brief Get size of external RAM in bytes declared by header.
+    [[nodiscard]]
+    size_t
+    ram_size() const;
+
+    /// @brief Get cartridge hardware declared by header.
+    [[nodiscard]]
+    CartridgeType
+    type() const;
+
+    /// @brief Get title declared by header.
+    [[nodiscard]]
+    std::string_view
+    title() const;
+
+    /// @brief Check if header declares support for CGB features.
+    [[nodiscard]]
+    bool
+    is_cgb() const;
+
+    /// @brief Check if header checksum matches header contents.
+    [[nodiscard]]
+    bool
+    is_header_valid() const;
+
+    /// @brief Check if global checksum matches ROM contents.
+    ///
+    /// @note Touches every byte of ROM, so avoid calling it on hot paths.
+    [[nodiscard]]
+    bool
+    is_global_valid() const;
+
+private:
+    void
+    release() noexcept;
+
+    [[nodiscard]]
+    uint8_t
+    header(const CartridgeHeader field) const;
+
+    const uint8_t* m_data;
+    size_t m_size;
+    size_t m_ram_size;
+    std::string_view m_title;
+    std::vector<uint8_t> m_fallback;
+};
+
+class CartridgeError final : public std::exception {
+public:
+    explicit CartridgeError(std::string message);
+
+    const char*
+    what() const noexcept;
+
+private:
+    std::string m_message;
+};
+} // namespace cocoa::gb
+
+#endif // COCOA_GB_CARTRIDGE_HPP
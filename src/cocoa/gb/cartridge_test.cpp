@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <filesystem>
+#include <fstream>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "cocoa/gb/cartridge.hpp"
+#include "cocoa/gb/cartridge_test.hpp"
+#include "cocoa/gb/memory.hpp"
+
+TEST_CASE("cocoa::gb::Cartridge::Cartridge(const std::filesystem::path&)", "[cartridge]")
+{
+    std::filesystem::path path = write_rom("cocoa_cartridge_test.gb", 4, 0x01, 0x02);
+    cocoa::gb::Cartridge cart(path);
+
+    REQUIRE(cart.title() == "COCOA TEST");
+    REQUIRE(cart.type() == cocoa::gb::CartridgeType::Mbc1);
+    REQUIRE(cart.rom_banks() == 4);
+    REQUIRE(cart.rom_size() == 0x10000);
+    REQUIRE(cart.ram_size() == 0x2000);
+    REQUIRE(cart.is_header_valid() == true);
+    REQUIRE(cart.is_cgb() == false);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("void cocoa::gb::Cartridge::switch_bank(MemoryBus&, const size_t)", "[switch_bank]")
+{
+    std::filesystem::path path = write_rom("cocoa_switch_bank_test.gb", 4, 0x01, 0x02);
+    cocoa::gb::Cartridge cart(path);
+    cocoa::gb::MemoryBus bus;
+
+    cart.attach(bus);
+    REQUIRE(bus.read_byte(0x0000) == 0x00);
+    REQUIRE(bus.read_byte(0x4000) == 0x01);
+
+    cart.switch_bank(bus, 3);
+    REQUIRE(bus.read_byte(0x7FFF) == 0x03);
+    REQUIRE(bus.read_byte(0x4000) == 0x03);
+
+    // INVARIANT: ROM is never written through memory bus.
+    bus.write_byte(0x4000, 0xFF);
+    REQUIRE(bus.read_byte(0x4000) == 0x03);
+
+    cart.switch_bank(bus, 5);
+    REQUIRE(bus.read_byte(0x4000) == 0x01);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("cocoa::gb::Cartridge rejects malformed ROM", "[cartridge]")
+{
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "cocoa_bad_test.gb";
+    std::ofstream(path, std::ios::binary) << "too small";
+    REQUIRE_THROWS_AS(cocoa::gb::Cartridge(path), cocoa::gb::CartridgeError);
+    std::filesystem::remove(path);
+}
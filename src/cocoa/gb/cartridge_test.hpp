@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_GB_CARTRIDGE_TEST_HPP
+#define COCOA_GB_CARTRIDGE_TEST_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "cocoa/gb/cartridge.hpp"
+
+/// @brief Write ROM with valid header whose banks are filled with their own bank number.
+///
+/// Header is titled "COCOA TEST", and its ROM size field matches amount of banks.
+///
+/// @param [in] name File name in temporary directory.
+/// @param [in] banks Amount of 16 KiB ROM banks.
+/// @param [in] type Cartridge type field of header.
+/// @param [in] ram RAM size field of header.
+/// @param [in] program Code placed at entry point, if any.
+/// @param [in] cgb_flag CGB flag field of header.
+/// @return Path to ROM.
+inline std::filesystem::path
+write_rom(const std::string& name, const size_t banks = 2, const uint8_t type = 0x00,
+    const uint8_t ram = 0x00, const std::vector<uint8_t>& program = {},
+    const uint8_t cgb_flag = 0x00)
+{
+    std::vector<uint8_t> rom(banks * cocoa::gb::ROM_BANK_SIZE);
+    for (size_t i = 0; i < rom.size(); ++i)
+        rom[i] = static_cast<uint8_t>(i / cocoa::gb::ROM_BANK_SIZE);
+    std::copy(program.begin(), program.end(), rom.begin() + 0x0100);
+
+    const std::string title = "COCOA TEST";
+    for (size_t i = 0; i < 16; ++i)
+        rom[0x0134 + i] = (i < title.size()) ? static_cast<uint8_t>(title[i]) : 0;
+
+    rom[0x0143] = cgb_flag;
+    rom[0x0147] = type;
+    rom[0x0148] = 0;
+    while ((size_t(2) << rom[0x0148]) < banks)
+        ++rom[0x0148];
+    rom[0x0149] = ram;
+
+    uint8_t checksum = 0;
+    for (size_t addr = 0x0134; addr < 0x014D; ++addr)
+        checksum = static_cast<uint8_t>(checksum - rom[addr] - 1);
+    rom[0x014D] = checksum;
+
+    std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(rom.data()), static_cast<std::streamsize>(rom.size()));
+    return path;
+}
+
+#endif // COCOA_GB_CARTRIDGE_TEST_HPP
@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "cocoa/gb/debugger.hpp"
+
+namespace cocoa::gb {
+Debugger::Debugger(GameBoy& gameboy)
+    : m_gameboy(gameboy)
+    , m_breakpoints()
+    , m_breakpoint_count(0)
+    , m_watchpoint_count(0)
+    , m_hit()
+{
+    m_gameboy.bus().set_watch_handler({ on_watch, this });
+    m_gameboy.cpu().set_breakpoints(&m_breakpoints);
+}
+
+Debugger::~Debugger() noexcept
+{
+    m_gameboy.bus().clear_watches();
+    m_gameboy.bus().set_watch_handler({});
+    m_gameboy.cpu().set_breakpoints(nullptr);
+}
+
+void
+Debugger::set_breakpoint(const uint16_t pc)
+{
+    if (!m_breakpoints[pc]) {
+        m_breakpoints.set(pc);
+        ++m_breakpoint_count;
+        m_gameboy.cpu().set_breakpoints(&m_breakpoints);
+    }
+}
+
+void
+Debugger::clear_breakpoint(const uint16_t pc)
+{
+    if (m_breakpoints[pc]) {
+        m_breakpoints.reset(pc);
+        --m_breakpoint_count;
+        m_gameboy.cpu().set_breakpoints(&m_breakpoints);
+    }
+}
+
+bool
+Debugger::has_breakpoint(const uint16_t pc) const
+{
+    return m_breakpoints[pc];
+}
+
+std::vector<uint16_t>
+Debugger::breakpoints() const
+{
+    std::vector<uint16_t> found;
+    found.reserve(m_breakpoint_count);
+    for (size_t pc = 0; found.size() < m_breakpoint_count; ++pc) {
+        if (m_breakpoints[pc])
+            found.push_back(static_cast<uint16_t>(pc));
+    }
+    return found;
+}
+
+void
+Debugger::set_watchpoint(const uint16_t address, const WatchKind kind)
+{
+    MemoryBus& bus = m_gameboy.bus();
+    if (!bus.is_watched(address, kind)) {
+        bus.watch(address, kind);
+        ++m_watchpoint_count;
+    }
+}
+
+void
+Debugger::clear_watchpoint(const uint16_t address, const WatchKind kind)
+{
+    MemoryBus& bus = m_gameboy.bus();
+    if (bus.is_watched(address, kind)) {
+        bus.unwatch(address, kind);
+        --m_watchpoint_count;
+    }
+}
+
+bool
+Debugger::has_watchpoint(const uint16_t address, const WatchKind kind) const
+{
+    return m_gameboy.bus().is_watched(address, kind);
+}
+
+std::vector<Watchpoint>
+Debugger::watchpoints() const
+{
+    const MemoryBus& bus = m_gameboy.bus();
+    std::vector<Watchpoint> found;
+    found.reserve(m_watchpoint_count);
+    for (size_t address = 0; found.size() < m_watchpoint_count; ++address) {
+        for (const WatchKind kind : { WatchKind::Read, WatchKind::Write }) {
+            if (bus.is_watched(static_cast<uint16_t>(address), kind))
+                found.push_back({ static_cast<uint16_t>(address), kind });
+        }
+    }
+    return found;
+}
+
+void
+Debugger::clear()
+{
+    m_breakpoints.reset();
+    m_breakpoint_count = 0;
+    m_gameboy.cpu().set_breakpoints(&m_breakpoints);
+    m_gameboy.bus().clear_watches();
+    m_watchpoint_count = 0;
+}
+
+DebugStop
+Debugger::run_for(const size_t tstates)
+{
+    if (m_breakpoint_count == 0 && m_watchpoint_count == 0) {
+        m_hit.reset();
+        m_gameboy.run_for(tstates);
+        return DebugStop::None;
+    }
+
+    return run_until(tstates, block_predicate([](const Sm83State&) { return false; }));
+}
+
+DebugStop
+Debugger::step()
+{
+    return run_until(1, block_predicate([](const Sm83State&) { return false; }));
+}
+
+const std::optional<WatchHit>&
+Debugger::last_hit() const
+{
+    return m_hit;
+}
+
+GameBoy&
+Debugger::gameboy()
+{
+    return m_gameboy;
+}
+
+void
+Debugger::on_watch(void* context, uint16_t address, uint8_t value, WatchKind kind)
+{
+    Debugger* debugger = static_cast<Debugger*>(context);
+    if (!debugger->m_hit)
+        debugger->m_hit = WatchHit { address, value, kind };
+}
+} // namespace cocoa::gb
@@ -0,0 +1,163 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_GB_DEBUGGER_HPP
+#define COCOA_GB_DEBUGGER_HPP
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "cocoa/gb/gameboy.hpp"
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/sm83.hpp"
+
+namespace cocoa::gb {
+/// @brief Reasons for debugger to stop execution.
+enum class DebugStop {
+    /// Budget ran out, or predicate of caller was satisfied.
+    None,
+
+    /// PC reached a breakpoint.
+    Breakpoint,
+
+    /// Watched address was accessed.
+    Watchpoint,
+};
+
+/// @brief Access of watched address that stopped execution.
+struct WatchHit final {
+    uint16_t address;
+    uint8_t value;
+    WatchKind kind;
+};
+
+/// @brief Address watched for one kind of access.
+struct Watchpoint final {
+    uint16_t address;
+    WatchKind kind;
+};
+
+/// @brief Debugger driving a GameBoy system through breakpoints and watchpoints.
+///
+/// PC breakpoints live in a bitmap of one bit per address, so checking one costs a single bit
+/// test. Watchpoints live in the memory bus itself, which routes only pages holding a watched
+/// address through its slow path.
+///
+/// Execution stops before the instruction at a breakpoint, or right after the instruction that
+/// accessed a watched address. Neither costs anything while none is set, since the system is then
+/// run exactly like without a debugger.
+///
+/// Meant to be driven from a frontend or a script alike. Only one debugger may be attached to a
+/// system at a time.
+class Debugger final {
+public:
+    /// @brief Attach debugger to system.
+    ///
+    /// @param [in,out] gameboy System to debug, which must outlive debugger.
+    explicit Debugger(GameBoy& gameboy);
+
+    Debugger(const Debugger&) = delete;
+
+    Debugger&
+    operator=(const Debugger&) = delete;
+
+    /// @brief Detach debugger, removing every watchpoint from system.
+    ~Debugger() noexcept;
+
+    void
+    set_breakpoint(const uint16_t pc);
+
+    void
+    clear_breakpoint(const uint16_t pc);
+
+    [[nodiscard]]
+    bool
+    has_breakpoint(const uint16_t pc) const;
+
+    /// @brief Get every breakpoint in ascending order.
+    [[nodiscard]]
+    std::vector<uint16_t>
+    breakpoints() const;
+
+    void
+    set_watchpoint(const uint16_t address, const WatchKind kind);
+
+    void
+    clear_watchpoint(const uint16_t address, const WatchKind kind);
+
+    [[nodiscard]]
+    bool
+    has_watchpoint(const uint16_t address, const WatchKind kind) const;
+
+    /// @brief Get every watchpoint in ascending order of address.
+    [[nodiscard]]
+    std::vector<Watchpoint>
+    watchpoints() const;
+
+    /// @brief Remove every breakpoint and watchpoint.
+    void
+    clear();
+
+    /// @brief Run system until t-state budget is exhausted, or a breakpoint or watchpoint hits.
+    ///
+    /// A breakpoint at the PC that execution starts from does not hit, so calling this again
+    /// after stopping at a breakpoint resumes past it.
+    ///
+    /// @param [in] tstates Budget of t-states to run for.
+    /// @return Reason for stopping.
+    ///
+    /// @throws `IllegalOpcode` if any of the 11 illegal opcode instructions are encountered.
+    DebugStop
+    run_for(const size_t tstates);
+
+    /// @brief Run system like `run_for()`, but also stop once predicate is satisfied.
+    ///
+    /// Predicate must be callable as `bool(const Sm83State&)`, and is checked before each
+    /// instruction. Breakpoints and watchpoints are checked where basic blocks start instead if
+    /// predicate is a `BlockPredicate`.
+    ///
+    /// @param [in] tstates Budget of t-states to run for.
+    /// @param [in] predicate Stop condition checked before each instruction.
+    /// @return Reason for stopping, which is `DebugStop::None` if predicate stopped execution.
+    ///
+    /// @throws `IllegalOpcode` if any of the 11 illegal opcode instructions are encountered.
+    template <typename Predicate>
+    DebugStop
+    run_until(const size_t tstates, Predicate predicate);
+
+    /// @brief Execute exactly one instruction, or idle one m-cycle in HALT or STOP mode.
+    ///
+    /// @return Reason for stopping, which is `DebugStop::Breakpoint` if next instruction has one.
+    ///
+    /// @throws `IllegalOpcode` if any of the 11 illegal opcode instructions are encountered.
+    DebugStop
+    step();
+
+    /// @brief Get access that stopped last run, if a watchpoint stopped it.
+    [[nodiscard]]
+    const std::optional<WatchHit>&
+    last_hit() const;
+
+    [[nodiscard]]
+    GameBoy&
+    gameboy();
+
+private:
+    /// @brief Record first watchpoint hit of current run.
+    static void
+    on_watch(void* context, uint16_t address, uint8_t value, WatchKind kind);
+
+    GameBoy& m_gameboy;
+    std::bitset<MEMORY_BUS_SIZE> m_breakpoints;
+    size_t m_breakpoint_count;
+    size_t m_watchpoint_count;
+    std::optional<WatchHit> m_hit;
+};
+} // namespace cocoa::gb
+
+#include "cocoa/gb/debugger.tpp"
+
+#endif // COCOA_GB_DEBUGGER_HPP
@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_GB_DEBUGGER_TPP
+#define COCOA_GB_DEBUGGER_TPP
+
+#include <cstddef>
+
+namespace cocoa::gb {
+template <typename Predicate>
+DebugStop
+Debugger::run_until(const size_t tstates, Predicate predicate)
+{
+    m_hit.reset();
+    const size_t start = m_gameboy.cpu().tstates();
+    bool at_breakpoint = false;
+    auto should_stop = [&](const Sm83State& cpu) {
+        // NOTE: Nothing ran yet while t-states still equal start, so PC is where the last stop
+        // already reported, and a halted CPU stays put on its PC until it wakes up.
+        at_breakpoint = m_breakpoint_count != 0 && cpu.tstates != start
+            && cpu.mode == Sm83Mode::Running && m_breakpoints[cpu.pc];
+        return at_breakpoint || m_hit.has_value() || predicate(cpu);
+    };
+
+    // NOTE: Breakpoints end basic blocks, and watchpoints only hit in instructions with effects,
+    // so both are checked where blocks start unless caller needs its own check per instruction.
+    if constexpr (is_block_predicate<Predicate>::value)
+        m_gameboy.run_until(tstates, block_predicate(should_stop));
+    else
+        m_gameboy.run_until(tstates, should_stop);
+
+    if (m_hit)
+        return DebugStop::Watchpoint;
+    return at_breakpoint ? DebugStop::Breakpoint : DebugStop::None;
+}
+} // namespace cocoa::gb
+
+#endif // COCOA_GB_DEBUGGER_TPP
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/logger.h>
+
+#include "cocoa/gb/cartridge_test.hpp"
+#include "cocoa/gb/debugger.hpp"
+#include "cocoa/gb/gameboy.hpp"
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/ppu.hpp"
+
+/// @brief Program that stores to and loads from WRAM in a loop.
+// clang-format off
+static const std::vector<uint8_t> PROGRAM = {
+    0x3E, 0x42,       // LD A, 0x42
+    0xEA, 0x00, 0xC0, // LD [0xC000], A
+    0xFA, 0x01, 0xC0, // LD A, [0xC001]
+    0x3C,             // INC A
+    0x18, 0xF5,       // JR -11
+};
+// clang-format on
+
+TEST_CASE("cocoa::gb::DebugStop cocoa::gb::Debugger::run_for(const size_t)", "[run_for]")
+{
+    std::filesystem::path path = write_rom("cocoa_debugger_run_for.gb", 2, 0x00, 0x00, PROGRAM);
+    cocoa::gb::GameBoy gameboy(std::make_shared<spdlog::logger>("test"), path);
+    cocoa::gb::Debugger debugger(gameboy);
+    const cocoa::gb::Sm83State& cpu = gameboy.cpu().state();
+
+    SECTION("Run whole budget without breakpoints or watchpoints")
+    {
+        REQUIRE(debugger.run_for(cocoa::gb::DOTS_PER_FRAME) == cocoa::gb::DebugStop::None);
+        REQUIRE(gameboy.cpu().tstates() >= cocoa::gb::DOTS_PER_FRAME);
+    }
+
+    SECTION("Stop before instruction at breakpoint, and resume past it")
+    {
+        debugger.set_breakpoint(0x0108);
+        REQUIRE(debugger.run_for(cocoa::gb::DOTS_PER_FRAME) == cocoa::gb::DebugStop::Breakpoint);
+        REQUIRE(cpu.pc == 0x0108);
+
+        const size_t first = gameboy.cpu().tstates();
+        REQUIRE(debugger.run_for(cocoa::gb::DOTS_PER_FRAME) == cocoa::gb::DebugStop::Breakpoint);
+        REQUIRE(cpu.pc == 0x0108);
+        REQUIRE(gameboy.cpu().tstates() > first);
+
+        debugger.clear_breakpoint(0x0108);
+        REQUIRE(debugger.breakpoints().empty());
+        REQUIRE(debugger.run_for(cocoa::gb::DOTS_PER_FRAME) == cocoa::gb::DebugStop::None);
+    }
+
+    SECTION("Stop at breakpoint inside basic block that already ran")
+    {
+        gameboy.cpu().set_dispatch(cocoa::gb::Sm83Dispatch::Block);
+        REQUIRE(debugger.run_for(cocoa::gb::DOTS_PER_FRAME) == cocoa::gb::DebugStop::None);
+
+        debugger.set_breakpoint(0x0109);
+        REQUIRE(debugger.run_for(cocoa::gb::DOTS_PER_FRAME) == cocoa::gb::DebugStop::Breakpoint);
+        REQUIRE(cpu.pc == 0x0109);
+    }
+
+    SECTION("Stop right after instruction writing watched address")
+    {
+        debugger.set_watchpoint(0xC000, cocoa::gb::WatchKind::Write);
+        REQUIRE(debugger.run_for(cocoa::gb::DOTS_PER_FRAME) == cocoa::gb::DebugStop::Watchpoint);
+        REQUIRE(cpu.pc == 0x0105);
+        REQUIRE(debugger.last_hit().has_value());
+        REQUIRE(debugger.last_hit()->address == 0xC000);
+        REQUIRE(debugger.last_hit()->value == 0x42);
+        REQUIRE(debugger.last_hit()->kind == cocoa::gb::WatchKind::Write);
+    }
+
+    SECTION("Stop right after instruction reading watched address")
+    {
+        gameboy.bus().write_byte(0xC001, 0x10);
+        debugger.set_watchpoint(0xC000, cocoa::gb::WatchKind::Read);
+        debugger.set_watchpoint(0xC001, cocoa::gb::WatchKind::Read);
+        REQUIRE(debugger.watchpoints().size() == 2);
+        REQUIRE(debugger.run_for(cocoa::gb::DOTS_PER_FRAME) == cocoa::gb::DebugStop::Watchpoint);
+        REQUIRE(cpu.pc == 0x0108);
+        REQUIRE(cpu.regs[cocoa::gb::Sm83State::A] == 0x10);
+        REQUIRE(debugger.last_hit()->address == 0xC001);
+        REQUIRE(debugger.last_hit()->kind == cocoa::gb::WatchKind::Read);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("cocoa::gb::DebugStop cocoa::gb::Debugger::step()", "[step]")
+{
+    std::filesystem::path path = write_rom("cocoa_debugger_step.gb", 2, 0x00, 0x00, PROGRAM);
+    cocoa::gb::GameBoy gameboy(std::make_shared<spdlog::logger>("test"), path);
+    cocoa::gb::Debugger debugger(gameboy);
+    const cocoa::gb::Sm83State& cpu = gameboy.cpu().state();
+
+    REQUIRE(debugger.step() == cocoa::gb::DebugStop::None);
+    REQUIRE(cpu.pc == 0x0102);
+
+    debugger.set_breakpoint(0x0105);
+    REQUIRE(debugger.step() == cocoa::gb::DebugStop::Breakpoint);
+    REQUIRE(cpu.pc == 0x0105);
+    REQUIRE(debugger.step() == cocoa::gb::DebugStop::None);
+    REQUIRE(cpu.pc == 0x0108);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("cocoa::gb::Debugger::~Debugger()", "[destructor]")
+{
+    std::filesystem::path path = write_rom("cocoa_debugger_detach.gb", 2, 0x00, 0x00, PROGRAM);
+    cocoa::gb::GameBoy gameboy(std::make_shared<spdlog::logger>("test"), path);
+    {
+        cocoa::gb::Debugger debugger(gameboy);
+        debugger.set_watchpoint(0xC000, cocoa::gb::WatchKind::Write);
+    }
+
+    REQUIRE(!gameboy.bus().is_watched(0xC000, cocoa::gb::WatchKind::Write));
+    cocoa::gb::Debugger debugger(gameboy);
+    REQUIRE(debugger.watchpoints().empty());
+    REQUIRE(debugger.run_for(cocoa::gb::DOTS_PER_FRAME) == cocoa::gb::DebugStop::None);
+    std::filesystem::remove(path);
+}
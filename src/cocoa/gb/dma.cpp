@@ -0,0 +1,204 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "cocoa/gb/dma.hpp"
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/ppu.hpp"
+#include "cocoa/gb/scheduler.hpp"
+#include "cocoa/gb/sm83.hpp"
+#include "cocoa/utility.hpp"
+
+namespace cocoa::gb {
+Dma::Dma(MemoryBus& bus, const Scheduler& scheduler, Sm83& cpu, Ppu& ppu, const bool cgb)
+    : m_bus(bus)
+    , m_scheduler(scheduler)
+    , m_cpu(cpu)
+    , m_ppu(ppu)
+    , m_oam_end(0)
+    , m_oam_locked(false)
+    , m_hdma_source(0)
+    , m_hdma_dest(0)
+    , m_hdma_blocks(0)
+    , m_hdma_active(false)
+{
+    m_bus.map_io_handler(IoMap::DMA, { nullptr, on_write_dma, this });
+    if (!cgb)
+        return;
+
+    for (const IoMap reg : { IoMap::HDMA1, IoMap::HDMA2, IoMap::HDMA3, IoMap::HDMA4 })
+        m_bus.map_io_handler(reg, { on_read_hdma, on_write_hdma, this });
+    m_bus.map_io_handler(IoMap::HDMA5, { on_read_hdma5, on_write_hdma5, this });
+    m_ppu.set_hblank_handler({ on_hblank, this });
+}
+
+bool
+Dma::is_oam_locked() const
+{
+    return m_oam_locked && m_scheduler.now() < m_oam_end;
+}
+
+bool
+Dma::is_hblank_active() const
+{
+    return m_hdma_active;
+}
+
+void
+Dma::save_state(DmaSnapshot& out) const
+{
+    out.oam_end = m_oam_end;
+    out.hdma_source = m_hdma_source;
+    out.hdma_dest = m_hdma_dest;
+    out.hdma_blocks = m_hdma_blocks;
+    out.hdma_active = m_hdma_active ? 1 : 0;
+    out.reserved = {};
+}
+
+void
+Dma::load_state(const DmaSnapshot& snapshot)
+{
+    m_oam_end = snapshot.oam_end;
+    m_hdma_source = snapshot.hdma_source;
+    m_hdma_dest = snapshot.hdma_dest;
+    m_hdma_blocks = snapshot.hdma_blocks;
+    m_hdma_active = snapshot.hdma_active != 0;
+
+    m_oam_locked = m_scheduler.now() < m_oam_end;
+    if (m_oam_locked)
+        m_bus.map_handler(from_enum(MemoryMap::OamStart), from_enum(MemoryMap::UnusableAreaEnd),
+            { on_read_oam, on_write_oam, this });
+    else
+        m_ppu.map_oam();
+}
+
+void
+Dma::on_write_dma(void* context, uint16_t address, uint8_t value)
+{
+    Dma* dma = static_cast<Dma*>(context);
+    dma->m_bus.poke(address, value);
+
+    // NOTE: Restarting while locked must not drop its own writes into OAM.
+    dma->m_ppu.map_oam();
+    const uint16_t source = from_pair<uint16_t, uint8_t>(value, 0x00);
+    dma->m_bus.copy(from_enum(MemoryMap::OamStart), source, OAM_DMA_LENGTH);
+    dma->m_oam_end = dma->m_scheduler.now() + OAM_DMA_TSTATES;
+    dma->m_oam_locked = true;
+    dma->m_bus.map_handler(from_enum(MemoryMap::OamStart), from_enum(MemoryMap::UnusableAreaEnd),
+        { on_read_oam, on_write_oam, dma });
+}
+
+uint8_t
+Dma::on_read_oam(void* context, uint16_t address)
+{
+    Dma* dma = static_cast<Dma*>(context);
+    if (dma->check_oam_lock())
+        return 0xFF;
+    return dma->m_ppu.oam()[from_low(address)];
+}
+
+void
+Dma::on_write_oam(void* context, uint16_t address, uint8_t value)
+{
+    Dma* dma = static_cast<Dma*>(context);
+    if (!dma->check_oam_lock())
+        dma->m_ppu.oam()[from_low(address)] = value;
+}
+
+uint8_t
+Dma::on_read_hdma(void* context, uint16_t address)
+{
+    // NOTE: Source and destination registers are write-only.
+    (void)context;
+    (void)address;
+    return 0xFF;
+}
+
+void
+Dma::on_write_hdma(void* context, uint16_t address, uint8_t value)
+{
+    static_cast<Dma*>(context)->m_bus.poke(address, value);
+}
+
+uint8_t
+Dma::on_read_hdma5(void* context, uint16_t address)
+{
+    (void)address;
+    const Dma* dma = static_cast<const Dma*>(context);
+    if (dma->m_hdma_blocks == 0)
+        return 0xFF;
+
+    // NOTE: Bit 7 reads clear while HBlank DMA is active, and set once it was cancelled.
+    const auto remaining = static_cast<uint8_t>(dma->m_hdma_blocks - 1);
+    return dma->m_hdma_active ? remaining : static_cast<uint8_t>(0x80 | remaining);
+}
+
+void
+Dma::on_write_hdma5(void* context, uint16_t address, uint8_t value)
+{
+    (void)address;
+    Dma* dma = static_cast<Dma*>(context);
+    if (dma->m_hdma_active && !is_bit_set<uint8_t, 7>(value)) {
+        dma->m_hdma_active = false;
+        return;
+    }
+
+    const MemoryBus& bus = dma->m_bus;
+    dma->m_hdma_source = static_cast<uint16_t>(
+        from_pair(bus.peek(from_enum(IoMap::HDMA1)), bus.peek(from_enum(IoMap::HDMA2))) & 0xFFF0);
+    dma->m_hdma_dest = static_cast<uint16_t>(from_enum(MemoryMap::VramStart)
+        | (from_pair(bus.peek(from_enum(IoMap::HDMA3)), bus.peek(from_enum(IoMap::HDMA4)))
+            & 0x1FF0));
+    dma->m_hdma_blocks = static_cast<uint8_t>((value & 0x7F) + 1);
+    dma->m_hdma_active = is_bit_set<uint8_t, 7>(value);
+    if (!dma->m_hdma_active) {
+        dma->transfer(dma->m_hdma_blocks);
+        dma->m_hdma_blocks = 0;
+    }
+}
+
+void
+Dma::on_hblank(void* context)
+{
+    Dma* dma = static_cast<Dma*>(context);
+    if (!dma->m_hdma_active)
+        return;
+
+    if (dma->transfer(1) == 0)
+        dma->m_hdma_blocks = 0;
+    else
+        --dma->m_hdma_blocks;
+    dma->m_hdma_active = dma->m_hdma_blocks != 0;
+}
+
+bool
+Dma::check_oam_lock()
+{
+    if (m_oam_locked && m_scheduler.now() >= m_oam_end) {
+        m_ppu.map_oam();
+        m_oam_locked = false;
+    }
+    return m_oam_locked;
+}
+
+size_t
+Dma::transfer(const size_t blocks)
+{
+    const size_t vram_end = from_enum(MemoryMap::VramEnd) + size_t(1);
+    const size_t room = (m_hdma_dest < vram_end) ? (vram_end - m_hdma_dest) / HDMA_BLOCK_SIZE : 0;
+    const size_t count = std::min(blocks, room);
+    if (count == 0)
+        return 0;
+
+    m_bus.copy(m_hdma_dest, m_hdma_source, count * HDMA_BLOCK_SIZE);
+    m_hdma_source = static_cast<uint16_t>(m_hdma_source + count * HDMA_BLOCK_SIZE);
+    m_hdma_dest = static_cast<uint16_t>(m_hdma_dest + count * HDMA_BLOCK_SIZE);
+
+    // NOTE: VRAM DMA takes as long in double speed mode, which is twice as many CPU t-states.
+    m_cpu.stall((count * HDMA_BLOCK_TSTATES) << (m_scheduler.is_double_speed() ? 1 : 0));
+    return count;
+}
+} // namespace cocoa::gb
@@ -0,0 +1,160 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_GB_DMA_HPP
+#define COCOA_GB_DMA_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/ppu.hpp"
+#include "cocoa/gb/scheduler.hpp"
+#include "cocoa/gb/sm83.hpp"
+
+namespace cocoa::gb {
+/// @brief Amount of bytes moved into OAM by one OAM DMA.
+constexpr size_t OAM_DMA_LENGTH = 0xA0;
+
+/// @brief Amount of t-states that OAM DMA keeps CPU locked out of OAM, i.e., 160 m-cycles.
+constexpr size_t OAM_DMA_TSTATES = 640;
+
+/// @brief Amount of bytes moved by one block of VRAM DMA.
+constexpr size_t HDMA_BLOCK_SIZE = 0x10;
+
+/// @brief Amount of t-states that CPU is stalled for per block of VRAM DMA at normal speed.
+constexpr size_t HDMA_BLOCK_TSTATES = 32;
+
+/// @brief Plain image of DMA state stored in save states.
+///
+/// @invariant Fields are fixed width and explicitly padded, so layout is identical across builds.
+struct DmaSnapshot final {
+    uint64_t oam_end;
+    uint16_t hdma_source;
+    uint16_t hdma_dest;
+    uint8_t hdma_blocks;
+    uint8_t hdma_active;
+    std::array<uint8_t, 2> reserved;
+};
+
+static_assert(sizeof(DmaSnapshot) == 16);
+
+/// @brief GameBoy OAM DMA, and CGB general purpose and HBlank VRAM DMA.
+///
+/// Every transfer is done in bulk through `MemoryBus::copy()`, so sources and destinations that
+/// are plain memory are copied straight between host pages, and only I/O ranges go byte by byte
+/// through their handlers.
+///
+/// OAM DMA copies all of its bytes the moment DMA is written, then locks CPU out of OAM for
+/// `OAM_DMA_TSTATES` by routing OAM pages to a handler that reads 0xFF and drops writes. Lock is
+/// lifted lazily on first OAM access past its end, so a transfer posts no scheduler event. Only
+/// OAM is locked, since source bus conflicts are not modeled, and software waits out the transfer
+/// in HRAM anyway.
+///
+/// General purpose VRAM DMA copies every block at once and stalls CPU for `HDMA_BLOCK_TSTATES`
+/// per block. HBlank VRAM DMA copies one block and stalls CPU each time PPU enters HBlank of a
+/// visible scanline. VRAM DMA registers are only attached for CGB cartridges.
+///
+/// @see https://gbdev.io/pandocs/OAM_DMA_Transfer.html
+/// @see https://gbdev.io/pandocs/CGB_Registers.html#lcd-vram-dma-transfers
+class Dma final {
+public:
+    /// @brief Attach DMA to its registers of memory bus, and to HBlank of PPU.
+    ///
+    /// @param [in] bus Memory bus to attach to, and transfer through.
+    /// @param [in] scheduler Scheduler to read time from.
+    /// @param [in] cpu CPU to stall during VRAM DMA.
+    /// @param [in] ppu PPU owning OAM, and driving HBlank VRAM DMA.
+    /// @param [in] cgb Attach VRAM DMA registers too.
+    Dma(MemoryBus& bus, const Scheduler& scheduler, Sm83& cpu, Ppu& ppu, const bool cgb);
+
+    Dma(const Dma&) = delete;
+
+    Dma&
+    operator=(const Dma&) = delete;
+
+    ~Dma() noexcept = default;
+
+    /// @brief Check if OAM DMA still locks CPU out of OAM.
+    [[nodiscard]]
+    bool
+    is_oam_locked() const;
+
+    /// @brief Check if HBlank VRAM DMA has blocks left to transfer.
+    [[nodiscard]]
+    bool
+    is_hblank_active() const;
+
+    /// @brief Capture DMA state for save state.
+    ///
+    /// @param [out] out Snapshot to fill.
+    void
+    save_state(DmaSnapshot& out) const;
+
+    /// @brief Restore DMA state from save state.
+    ///
+    /// OAM is locked or unlocked again to match, so CPU must be restored first.
+    ///
+    /// @param [in] snapshot Snapshot to restore from.
+    void
+    load_state(const DmaSnapshot& snapshot);
+
+private:
+    static void
+    on_write_dma(void* context, uint16_t address, uint8_t value);
+
+    static uint8_t
+    on_read_oam(void* context, uint16_t address);
+
+    static void
+    on_write_oam(void* context, uint16_t address, uint8_t value);
+
+    static uint8_t
+    on_read_hdma(void* context, uint16_t address);
+
+    static void
+    on_write_hdma(void* context, uint16_t address, uint8_t value);
+
+    static uint8_t
+    on_read_hdma5(void* context, uint16_t address);
+
+    static void
+    on_write_hdma5(void* context, uint16_t address, uint8_t value);
+
+    static void
+    on_hblank(void* context);
+
+    /// @brief Lift lock on OAM once OAM DMA is over.
+    ///
+    /// @return True if OAM is still locked.
+    bool
+    check_oam_lock();
+
+    /// @brief Copy blocks of VRAM DMA, and stall CPU for them.
+    ///
+    /// Transfer stops early once destination runs past end of VRAM.
+    ///
+    /// @param [in] blocks Amount of blocks to copy.
+    /// @return Amount of blocks copied.
+    size_t
+    transfer(const size_t blocks);
+
+    MemoryBus& m_bus;
+    const Scheduler& m_scheduler;
+    Sm83& m_cpu;
+    Ppu& m_ppu;
+
+    /// Time at which OAM DMA stops locking OAM.
+    size_t m_oam_end;
+    bool m_oam_locked;
+
+    /// Next addresses and remaining blocks of VRAM DMA.
+    uint16_t m_hdma_source;
+    uint16_t m_hdma_dest;
+    uint8_t m_hdma_blocks;
+    bool m_hdma_active;
+};
+} // namespace cocoa::gb
+
+#endif // COCOA_GB_DMA_HPP
@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/logger.h>
+
+#include "cocoa/gb/dma.hpp"
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/ppu.hpp"
+#include "cocoa/gb/scheduler.hpp"
+#include "cocoa/gb/sm83.hpp"
+
+/// @brief Fill 256 bytes of WRAM starting at address with recognizable pattern.
+static void
+fill_wram(cocoa::gb::MemoryBus& bus, const uint16_t start)
+{
+    for (uint16_t i = 0; i < 0x100; ++i)
+        bus.write_byte(static_cast<uint16_t>(start + i), static_cast<uint8_t>(i ^ 0x5A));
+}
+
+TEST_CASE("void cocoa::gb::Dma::on_write_dma(void*, uint16_t, uint8_t)", "[oam_dma]")
+{
+    cocoa::gb::MemoryBus bus {};
+    cocoa::gb::Sm83 cpu(std::make_shared<spdlog::logger>("test"), bus);
+    cocoa::gb::Scheduler scheduler(cpu.state().tstates);
+    cocoa::gb::Ppu ppu(bus);
+    cocoa::gb::Dma dma(bus, scheduler, cpu, ppu, false);
+    fill_wram(bus, 0xC100);
+    bus.write_io_reg(cocoa::gb::IoMap::DMA, 0xC1);
+
+    SECTION("Copy into OAM at once, then lock CPU out of it")
+    {
+        REQUIRE(ppu.oam()[0x00] == 0x5A);
+        REQUIRE(ppu.oam()[0x9F] == (0x9F ^ 0x5A));
+        REQUIRE(ppu.oam()[0xA0] == 0x00);
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::DMA) == 0xC1);
+        REQUIRE(dma.is_oam_locked());
+        REQUIRE(bus.read_byte(0xFE00) == 0xFF);
+        bus.write_byte(0xFE00, 0x12);
+        REQUIRE(ppu.oam()[0x00] == 0x5A);
+        REQUIRE(bus.read_byte(0xFF80) == 0x00);
+    }
+
+    SECTION("Unlock OAM once transfer is over")
+    {
+        cpu.stall(cocoa::gb::OAM_DMA_TSTATES - 4);
+        REQUIRE(bus.read_byte(0xFE01) == 0xFF);
+        cpu.stall(4);
+        REQUIRE(!dma.is_oam_locked());
+        REQUIRE(bus.read_byte(0xFE01) == (0x01 ^ 0x5A));
+        bus.write_byte(0xFE00, 0x12);
+        REQUIRE(ppu.oam()[0x00] == 0x12);
+    }
+
+    SECTION("Restart while still locked")
+    {
+        fill_wram(bus, 0xC200);
+        bus.write_byte(0xC200, 0x77);
+        cpu.stall(100);
+        bus.write_io_reg(cocoa::gb::IoMap::DMA, 0xC2);
+        REQUIRE(ppu.oam()[0x00] == 0x77);
+        cpu.stall(cocoa::gb::OAM_DMA_TSTATES - 4);
+        REQUIRE(dma.is_oam_locked());
+    }
+
+    SECTION("Restore lock from save state")
+    {
+        cocoa::gb::DmaSnapshot snapshot = {};
+        dma.save_state(snapshot);
+        cpu.stall(cocoa::gb::OAM_DMA_TSTATES);
+        REQUIRE(bus.read_byte(0xFE00) == 0x5A);
+
+        snapshot.oam_end = cpu.tstates() + 8;
+        dma.load_state(snapshot);
+        REQUIRE(bus.read_byte(0xFE00) == 0xFF);
+        cpu.stall(8);
+        REQUIRE(bus.read_byte(0xFE00) == 0x5A);
+    }
+}
+
+TEST_CASE("void cocoa::gb::Dma::on_write_hdma5(void*, uint16_t, uint8_t)", "[hdma]")
+{
+    cocoa::gb::MemoryBus bus {};
+    cocoa::gb::Sm83 cpu(std::make_shared<spdlog::logger>("test"), bus);
+    cocoa::gb::Scheduler scheduler(cpu.state().tstates);
+    cocoa::gb::Ppu ppu(bus);
+    cocoa::gb::Dma dma(bus, scheduler, cpu, ppu, true);
+    bus.write_io_reg(cocoa::gb::IoMap::LCDC, 0x91);
+    fill_wram(bus, 0xC000);
+    bus.write_io_reg(cocoa::gb::IoMap::HDMA1, 0xC0);
+    bus.write_io_reg(cocoa::gb::IoMap::HDMA2, 0x0F);
+    bus.write_io_reg(cocoa::gb::IoMap::HDMA3, 0xE1);
+    bus.write_io_reg(cocoa::gb::IoMap::HDMA4, 0x00);
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::HDMA1) == 0xFF);
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::HDMA5) == 0xFF);
+
+    SECTION("Copy every block at once, and stall CPU for them")
+    {
+        bus.write_io_reg(cocoa::gb::IoMap::HDMA5, 0x01);
+        REQUIRE(cpu.tstates() == 2 * cocoa::gb::HDMA_BLOCK_TSTATES);
+        for (uint16_t i = 0; i < 0x20; ++i)
+            REQUIRE(bus.read_byte(static_cast<uint16_t>(0x8100 + i)) == (i ^ 0x5A));
+        REQUIRE(bus.read_byte(0x8120) == 0x00);
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::HDMA5) == 0xFF);
+    }
+
+    SECTION("Copy one block per HBlank")
+    {
+        bus.write_io_reg(cocoa::gb::IoMap::HDMA5, 0x81);
+        REQUIRE(dma.is_hblank_active());
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::HDMA5) == 0x01);
+        REQUIRE(bus.read_byte(0x8100) == 0x00);
+
+        ppu.step(80 + 172);
+        REQUIRE(bus.read_byte(0x810F) == (0x0F ^ 0x5A));
+        REQUIRE(bus.read_byte(0x8110) == 0x00);
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::HDMA5) == 0x00);
+        REQUIRE(cpu.tstates() == cocoa::gb::HDMA_BLOCK_TSTATES);
+
+        ppu.step(cocoa::gb::DOTS_PER_LINE);
+        REQUIRE(bus.read_byte(0x811F) == (0x1F ^ 0x5A));
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::HDMA5) == 0xFF);
+        REQUIRE(!dma.is_hblank_active());
+    }
+
+    SECTION("Cancel HBlank transfer")
+    {
+        bus.write_io_reg(cocoa::gb::IoMap::HDMA5, 0x82);
+        ppu.step(80 + 172);
+        bus.write_io_reg(cocoa::gb::IoMap::HDMA5, 0x00);
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::HDMA5) == 0x81);
+        ppu.step(cocoa::gb::DOTS_PER_LINE);
+        REQUIRE(bus.read_byte(0x8110) == 0x00);
+    }
+
+    SECTION("Stop at end of VRAM")
+    {
+        bus.write_io_reg(cocoa::gb::IoMap::HDMA3, 0x1F);
+        bus.write_io_reg(cocoa::gb::IoMap::HDMA4, 0xE0);
+        bus.write_io_reg(cocoa::gb::IoMap::HDMA5, 0x7F);
+        REQUIRE(cpu.tstates() == 2 * cocoa::gb::HDMA_BLOCK_TSTATES);
+        REQUIRE(bus.read_byte(0x9FFF) == (0x1F ^ 0x5A));
+        REQUIRE(bus.read_byte(0xA000) == 0x00);
+    }
+}
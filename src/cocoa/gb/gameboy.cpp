@@ -0,0 +1,333 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+#include <spdlog/logger.h>
+
+#include "cocoa/gb/gameboy.hpp"
+#include "cocoa/gb/snapshot.hpp"
+#include "cocoa/utility.hpp"
+
+namespace cocoa::gb {
+GameBoy::GameBoy(std::shared_ptr<spdlog::logger> log, const std::filesystem::path& rom)
+    : GameBoy(log, std::make_shared<const Cartridge>(rom))
+{
+}
+
+GameBoy::GameBoy(std::shared_ptr<spdlog::logger> log, std::shared_ptr<const Cartridge> cart)
+    : m_log(log)
+    , m_bus()
+    , m_cart(cart)
+    , m_cpu(log, m_bus)
+    , m_scheduler(m_cpu.state().tstates)
+    , m_mapper(*m_cart, m_bus, m_cpu.state().tstates)
+    , m_ppu(m_bus, m_cart->is_cgb())
+    , m_timer(m_bus, m_scheduler)
+    , m_serial(m_bus, m_scheduler)
+    , m_apu(m_bus, m_scheduler)
+    , m_dma(m_bus, m_scheduler, m_cpu, m_ppu, m_cart->is_cgb())
+    , m_ppu_clock(m_cpu.tstates())
+{
+    // NOTE: Only registers that software actually relies on after boot ROM hands off.
+    m_bus.write_io_reg(IoMap::BGP, 0xFC);
+    m_bus.write_io_reg(IoMap::LCDC, 0x91);
+    m_bus.write_io_reg(IoMap::NR52, 0x80);
+    m_bus.write_io_reg(IoMap::NR51, 0xF3);
+    m_bus.write_io_reg(IoMap::NR50, 0x77);
+    if (m_cart->is_cgb()) {
+        m_bus.map_io_handler(IoMap::SPD, { nullptr, on_write_spd, this });
+        m_bus.map_io_handler(IoMap::SVBK, { nullptr, on_write_svbk, this });
+        m_bus.poke(from_enum(IoMap::SPD), 0x7E);
+        m_bus.poke(from_enum(IoMap::SVBK), 0xF8);
+    }
+
+    // NOTE: Cartridge ROM is immutable and outlives CPU, so blocks decoded from it stay valid.
+    // Without native code, threaded dispatch is fastest, see `Sm83::set_dispatch()`.
+#ifdef COCOA_JIT
+    m_cpu.set_dispatch(Sm83Dispatch::Jit);
+#else
+    m_cpu.set_dispatch(Sm83Dispatch::Threaded);
+#endif // COCOA_JIT
+
+    m_scheduler.attach(EventKind::Ppu, { on_ppu_event, this });
+    m_scheduler.schedule_in(EventKind::Ppu, m_ppu.dots_until_event());
+}
+
+size_t
+GameBoy::run_for(size_t tstates)
+{
+    // NOTE: Same slicing as `run_until()`, but CPU runs without predicate, so it can run native
+    // code if it has any.
+    size_t consumed = 0;
+    while (consumed < tstates) {
+        const size_t slice = std::min(tstates - consumed, m_scheduler.until_next_deadline());
+        consumed += m_cpu.run_for(slice);
+        if (m_cpu.state().mode == Sm83Mode::Stopped)
+            switch_speed();
+        m_scheduler.dispatch();
+    }
+
+    return consumed;
+}
+
+void
+GameBoy::save_state(const std::filesystem::path& path) const
+{
+    SaveParts parts;
+    write_snapshot(path, sections(parts));
+}
+
+void
+GameBoy::load_state(const std::filesystem::path& path)
+{
+    const SnapshotFile file(path);
+    restore(file, path.string());
+}
+
+void
+GameBoy::save_state(std::vector<uint8_t>& image) const
+{
+    SaveParts parts;
+    pack_snapshot(sections(parts), image);
+}
+
+void
+GameBoy::load_state(const std::vector<uint8_t>& image)
+{
+    const SnapshotFile file(image.data(), image.size());
+    restore(file, "<memory>");
+}
+
+/// @brief Copy state of component into another one through its snapshot.
+template <typename Snapshot, typename Component>
+static void
+copy_state(const Component& from, Component& to)
+{
+    Snapshot snapshot = {};
+    from.save_state(snapshot);
+    to.load_state(snapshot);
+}
+
+std::unique_ptr<GameBoy>
+GameBoy::fork()
+{
+    // NOTE: Constructor is private, hence no std::make_unique.
+    std::unique_ptr<GameBoy> child(new GameBoy(m_log, m_cart));
+
+    // INVARIANT: Bus goes first, since mapper and PPU repoint pages of child bus afterwards.
+    child->m_bus.share_memory(m_bus);
+    if (m_cart->is_cgb())
+        child->m_bus.switch_wram_bank(m_bus.wram_bank());
+    child->m_mapper.share_state(m_mapper);
+    child->m_ppu.share_state(m_ppu);
+    copy_state<Sm83Snapshot>(m_cpu, child->m_cpu);
+    copy_state<TimerSnapshot>(m_timer, child->m_timer);
+    copy_state<ApuSnapshot>(m_apu, child->m_apu);
+    copy_state<DmaSnapshot>(m_dma, child->m_dma);
+    child->m_ppu_clock = m_ppu_clock;
+
+    // INVARIANT: Scheduler goes last, since taking over components must not post events.
+    copy_state<SchedulerSnapshot>(m_scheduler, child->m_scheduler);
+    child->m_cpu.set_dispatch(m_cpu.dispatch());
+    return child;
+}
+
+const Cartridge&
+GameBoy::cartridge() const
+{
+    return *m_cart;
+}
+
+const Sm83&
+GameBoy::cpu() const
+{
+    return m_cpu;
+}
+
+Sm83&
+GameBoy::cpu()
+{
+    return m_cpu;
+}
+
+const Ppu&
+GameBoy::ppu() const
+{
+    return m_ppu;
+}
+
+const Serial&
+GameBoy::serial() const
+{
+    return m_serial;
+}
+
+Apu&
+GameBoy::apu()
+{
+    return m_apu;
+}
+
+const Timer&
+GameBoy::timer() const
+{
+    return m_timer;
+}
+
+const Scheduler&
+GameBoy::scheduler() const
+{
+    return m_scheduler;
+}
+
+MemoryBus&
+GameBoy::bus()
+{
+    return m_bus;
+}
+
+void
+GameBoy::capture(SaveParts& parts) const
+{
+    parts.system.ppu_clock = m_ppu_clock;
+    parts.system.rom_size = m_cart->rom_size();
+    const std::string_view title = m_cart->title();
+    std::array<char, 16>& out = parts.system.title;
+    out = {};
+    std::copy_n(title.begin(), std::min(title.size(), out.size()), out.begin());
+
+    m_cpu.save_state(parts.cpu);
+    m_ppu.save_state(parts.ppu);
+    m_timer.save_state(parts.timer);
+    m_scheduler.save_state(parts.scheduler);
+    m_mapper.save_state(parts.mapper);
+    m_apu.save_state(parts.apu);
+    m_dma.save_state(parts.dma);
+}
+
+std::array<SnapshotChunk, SNAPSHOT_SECTION_COUNT>
+GameBoy::sections(SaveParts& parts) const
+{
+    capture(parts);
+    m_bus.save_memory(parts.bus.data());
+    parts.ram.resize(m_mapper.ram().size());
+    m_mapper.ram().save(parts.ram.data());
+
+    return { {
+        { SnapshotSection::System, &parts.system, sizeof(parts.system) },
+        { SnapshotSection::Cpu, &parts.cpu, sizeof(parts.cpu) },
+        { SnapshotSection::Bus, parts.bus.data(), parts.bus.size() },
+        { SnapshotSection::Ppu, &parts.ppu, sizeof(parts.ppu) },
+        { SnapshotSection::Timer, &parts.timer, sizeof(parts.timer) },
+        { SnapshotSection::Scheduler, &parts.scheduler, sizeof(parts.scheduler) },
+        { SnapshotSection::Mapper, &parts.mapper, sizeof(parts.mapper) },
+        { SnapshotSection::MapperRam, parts.ram.data(), parts.ram.size() },
+        { SnapshotSection::Apu, &parts.apu, sizeof(parts.apu) },
+        { SnapshotSection::Dma, &parts.dma, sizeof(parts.dma) },
+    } };
+}
+
+void
+GameBoy::apply(const SaveParts& parts, const uint8_t* ram)
+{
+    // INVARIANT: Scheduler goes last, since restoring components must not post events.
+    m_cpu.load_state(parts.cpu);
+    m_ppu.load_state(parts.ppu);
+    m_timer.load_state(parts.timer);
+    m_mapper.load_state(parts.mapper, ram);
+    m_apu.load_state(parts.apu);
+    m_dma.load_state(parts.dma);
+    if (m_cart->is_cgb())
+        m_bus.switch_wram_bank(m_bus.peek(from_enum(IoMap::SVBK)));
+    m_ppu_clock = parts.system.ppu_clock;
+    m_scheduler.load_state(parts.scheduler);
+}
+
+void
+GameBoy::restore(const SnapshotFile& file, const std::string& name)
+{
+    SaveParts parts;
+    file.read(SnapshotSection::System, parts.system);
+    file.read(SnapshotSection::Cpu, parts.cpu);
+    file.read(SnapshotSection::Ppu, parts.ppu);
+    file.read(SnapshotSection::Timer, parts.timer);
+    file.read(SnapshotSection::Scheduler, parts.scheduler);
+    file.read(SnapshotSection::Mapper, parts.mapper);
+    file.read(SnapshotSection::Apu, parts.apu);
+    file.read(SnapshotSection::Dma, parts.dma);
+    file.expect_size(SnapshotSection::Bus, MemoryBus::size());
+    file.expect_size(SnapshotSection::MapperRam, m_mapper.ram().size());
+
+    std::array<char, 16> title = {};
+    const std::string_view cart_title = m_cart->title();
+    std::copy_n(cart_title.begin(), std::min(cart_title.size(), title.size()), title.begin());
+    if (parts.system.rom_size != m_cart->rom_size() || parts.system.title != title
+        || parts.mapper.type != static_cast<uint8_t>(m_mapper.type()))
+        throw SnapshotError(fmt::format("Snapshot '{0}' was taken with another cartridge", name));
+
+    if (parts.cpu.mode > static_cast<uint8_t>(Sm83Mode::Stopped)
+        || parts.ppu.mode > from_enum(PpuMode::Transfer))
+        throw SnapshotError(fmt::format("Snapshot '{0}' is malformed", name));
+
+    m_bus.load_memory(file.data(SnapshotSection::Bus));
+    apply(parts, file.data(SnapshotSection::MapperRam));
+}
+
+void
+GameBoy::on_ppu_event(void* context, size_t)
+{
+    static_cast<GameBoy*>(context)->sync_ppu();
+}
+
+void
+GameBoy::on_write_spd(void* context, uint16_t address, uint8_t value)
+{
+    // NOTE: Only prepare bit is writable, while bit 7 reports current speed.
+    MemoryBus& bus = static_cast<GameBoy*>(context)->m_bus;
+    bus.poke(address, static_cast<uint8_t>(0x7E | (bus.peek(address) & 0x80) | (value & 0x01)));
+}
+
+void
+GameBoy::on_write_svbk(void* context, uint16_t address, uint8_t value)
+{
+    MemoryBus& bus = static_cast<GameBoy*>(context)->m_bus;
+    bus.poke(address, static_cast<uint8_t>(0xF8 | value));
+    bus.switch_wram_bank(value);
+}
+
+void
+GameBoy::sync_ppu()
+{
+    const size_t now = m_scheduler.peripheral_now();
+    m_ppu.step(now - m_ppu_clock);
+    m_ppu_clock = now;
+    m_scheduler.schedule(
+        EventKind::Ppu, m_scheduler.peripheral_deadline(now + m_ppu.dots_until_event()));
+}
+
+void
+GameBoy::switch_speed()
+{
+    if (!m_cart->is_cgb() || !is_bit_set<uint8_t, 0>(m_bus.peek(from_enum(IoMap::SPD))))
+        return;
+
+    // INVARIANT: PPU catches up at old speed, then reposts its next mode change at new speed.
+    sync_ppu();
+    m_scheduler.set_double_speed(!m_scheduler.is_double_speed());
+    sync_ppu();
+
+    m_bus.poke(from_enum(IoMap::SPD), m_scheduler.is_double_speed() ? 0xFE : 0x7E);
+    m_cpu.resume();
+    m_cpu.stall(SPEED_SWITCH_TSTATES);
+}
+} // namespace cocoa::gb
@@ -0,0 +1,284 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_GB_GAMEBOY_HPP
+#define COCOA_GB_GAMEBOY_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <spdlog/logger.h>
+
+#include "cocoa/gb/apu.hpp"
+#include "cocoa/gb/cartridge.hpp"
+#include "cocoa/gb/dma.hpp"
+#include "cocoa/gb/mapper.hpp"
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/ppu.hpp"
+#include "cocoa/gb/scheduler.hpp"
+#include "cocoa/gb/serial.hpp"
+#include "cocoa/gb/sm83.hpp"
+#include "cocoa/gb/snapshot.hpp"
+#include "cocoa/gb/timer.hpp"
+
+namespace cocoa::gb {
+/// @brief Amount of t-states that CPU is kept stopped for by a CGB speed switch.
+constexpr size_t SPEED_SWITCH_TSTATES = 8200;
+
+/// @brief Plain image of system-wide state stored in save states.
+///
+/// Also identifies cartridge that save state was taken with, so it is never restored on top of
+/// another game.
+///
+/// @invariant Fields are fixed width and explicitly padded, so layout is identical across builds.
+struct GameBoySnapshot final {
+    uint64_t ppu_clock;
+    uint64_t rom_size;
+    std::array<char, 16> title;
+};
+
+static_assert(sizeof(GameBoySnapshot) == 32);
+
+/// @brief Whole GameBoy system.
+///
+/// Owns memory bus, cartridge, and every peripheral attached to them, and keeps them in lock
+/// step. Needs no frontend at all, so it can be driven headless.
+///
+/// Peripherals post timestamped events to a shared `Scheduler`. CPU runs in slices that end at
+/// the earliest pending deadline, after which every due event fires. Thus, interrupts raised by
+/// peripherals are seen by CPU at the right instruction boundary without stepping any of them
+/// per instruction.
+///
+/// CGB cartridges get banked VRAM and WRAM, and can switch CPU to double speed through SPD and
+/// STOP. Time budgets are always in CPU t-states, so in double speed mode PPU and APU only cover
+/// half as much of their own time per budget.
+class GameBoy final {
+public:
+    /// @brief Load ROM and bring system to its post-boot state.
+    ///
+    /// @param [in] log Logger to use.
+    /// @param [in] rom Path to ROM file.
+    ///
+    /// @throws `CartridgeError` if ROM cannot be loaded or needs unsupported hardware.
+    GameBoy(std::shared_ptr<spdlog::logger> log, const std::filesystem::path& rom);
+
+    GameBoy(const GameBoy&) = delete;
+
+    GameBoy&
+    operator=(const GameBoy&) = delete;
+
+    ~GameBoy() noexcept = default;
+
+    /// @brief Run whole system for t-state budget.
+    ///
+    /// @param [in] tstates Budget of t-states to run for.
+    /// @return Number of t-states consumed, which can overshoot budget by one instruction.
+    ///
+    /// @throws `IllegalOpcode` if any of the 11 illegal opcode instructions are encountered.
+    size_t
+    run_for(size_t tstates);
+
+    /// @brief Run whole system until predicate is satisfied or t-state budget is exhausted.
+    ///
+    /// Predicate must be callable as `bool(const Sm83State&)`, and is checked before each
+    /// instruction.
+    ///
+    /// @param [in] tstates Budget of t-states to run for.
+    /// @param [in] predicate Stop condition checked before each instruction.
+    /// @return Number of t-states consumed, which can overshoot budget by one instruction.
+    ///
+    /// @throws `IllegalOpcode` if any of the 11 illegal opcode instructions are encountered.
+    template <typename Predicate>
+    size_t
+    run_until(size_t tstates, Predicate predicate);
+
+    /// @brief Save whole system state to snapshot file.
+    ///
+    /// Cartridge ROM is not stored, only identified. Memory bus and external RAM are written
+    /// straight from where they live, so saving costs one gathered write plus copies of the
+    /// small component states.
+    ///
+    /// @param [in] path Path to snapshot file, which is replaced if it exists.
+    ///
+    /// @throws `SnapshotError` if snapshot file cannot be written.
+    void
+    save_state(const std::filesystem::path& path) const;
+
+    /// @brief Restore whole system state from snapshot file.
+    ///
+    /// Every section is validated before anything is restored, so a rejected snapshot leaves
+    /// system untouched.
+    ///
+    /// @param [in] path Path to snapshot file.
+    ///
+    /// @throws `SnapshotError` if snapshot file is invalid, has another version, or was taken with
+    ///         another cartridge.
+    void
+    load_state(const std::filesystem::path& path);
+
+    /// @brief Save whole system state into memory.
+    ///
+    /// Image has exactly the layout of a snapshot file. Buffer is reused, so saving every frame
+    /// only allocates a scratch copy of external RAM, if cartridge has any.
+    ///
+    /// @param [out] image Buffer to save into.
+    void
+    save_state(std::vector<uint8_t>& image) const;
+
+    /// @brief Restore whole system state from image saved into memory.
+    ///
+    /// @param [in] image Image to restore from.
+    ///
+    /// @throws `SnapshotError` if image is invalid, or was taken with another cartridge.
+    void
+    load_state(const std::vector<uint8_t>& image);
+
+    /// @brief Branch off independent copy of whole system at its current state.
+    ///
+    /// Cartridge ROM is shared, while internal memory of bus, VRAM, external RAM, and the
+    /// framebuffer are shared copy-on-write. Pages are copied on first write by either system, and
+    /// the framebuffer once either system renders. A fork thus costs the registers of CPU, PPU,
+    /// APU, DMA, timer, scheduler, and mapper, plus OAM, one reference per page, and afterwards
+    /// only the pages it dirties. Serial output and unread audio of fork start out empty.
+    ///
+    /// @note Forking mutates this system, since its pages become copy-on-write. Fork from one
+    ///       thread, then run forks on as many threads as needed.
+    ///
+    /// @return New system that continues exactly where this one is.
+    [[nodiscard]]
+    std::unique_ptr<GameBoy>
+    fork();
+
+    [[nodiscard]]
+    const Cartridge&
+    cartridge() const;
+
+    [[nodiscard]]
+    const Sm83&
+    cpu() const;
+
+    [[nodiscard]]
+    Sm83&
+    cpu();
+
+    [[nodiscard]]
+    const Ppu&
+    ppu() const;
+
+    [[nodiscard]]
+    const Serial&
+    serial() const;
+
+    [[nodiscard]]
+    Apu&
+    apu();
+
+    [[nodiscard]]
+    const Timer&
+    timer() const;
+
+    [[nodiscard]]
+    const Scheduler&
+    scheduler() const;
+
+    [[nodiscard]]
+    MemoryBus&
+    bus();
+
+private:
+    /// @brief Component states and memory copied out for one save.
+    struct SaveParts final {
+        GameBoySnapshot system;
+        Sm83Snapshot cpu;
+        PpuSnapshot ppu;
+        TimerSnapshot timer;
+        SchedulerSnapshot scheduler;
+        MapperSnapshot mapper;
+        ApuSnapshot apu;
+        DmaSnapshot dma;
+        std::array<uint8_t, MemoryBus::size()> bus;
+        std::vector<uint8_t> ram;
+    };
+
+    /// @brief Bring up system around already loaded cartridge.
+    GameBoy(std::shared_ptr<spdlog::logger> log, std::shared_ptr<const Cartridge> cart);
+
+    /// @brief Capture state of every component apart from bus.
+    ///
+    /// @param [out] parts Storage for component states.
+    void
+    capture(SaveParts& parts) const;
+
+    /// @brief Capture whole system and describe sections of save state.
+    ///
+    /// @param [out] parts Storage for component states, bus, and external RAM, which sections
+    ///                   point into.
+    /// @return Every section of save state.
+    [[nodiscard]]
+    std::array<SnapshotChunk, SNAPSHOT_SECTION_COUNT>
+    sections(SaveParts& parts) const;
+
+    /// @brief Restore state of every component apart from bus.
+    ///
+    /// @param [in] parts Component states to restore.
+    /// @param [in] ram Contents of external RAM.
+    void
+    apply(const SaveParts& parts, const uint8_t* ram);
+
+    /// @brief Validate every section of save state, then restore every component.
+    ///
+    /// @param [in] file Save state to restore from.
+    /// @param [in] name Name of save state used in error messages.
+    ///
+    /// @throws `SnapshotError` if save state is invalid, or was taken with another cartridge.
+    void
+    restore(const SnapshotFile& file, const std::string& name);
+
+    /// @brief Catch PPU up to current time, and post its next mode change.
+    ///
+    /// Next mode change is posted relative to time PPU was caught up to, since HBlank VRAM DMA
+    /// stalls CPU, and thus moves time on, while PPU is stepped.
+    static void
+    on_ppu_event(void* context, size_t deadline);
+
+    static void
+    on_write_spd(void* context, uint16_t address, uint8_t value);
+
+    static void
+    on_write_svbk(void* context, uint16_t address, uint8_t value);
+
+    /// @brief Catch PPU up to current peripheral time, and post its next mode change.
+    void
+    sync_ppu();
+
+    /// @brief Switch CPU speed if STOP was executed with speed switch prepared.
+    ///
+    /// CPU is woken up again and stalled for `SPEED_SWITCH_TSTATES`. Otherwise, CPU stays stopped.
+    void
+    switch_speed();
+
+    std::shared_ptr<spdlog::logger> m_log;
+    MemoryBus m_bus;
+    std::shared_ptr<const Cartridge> m_cart;
+    Sm83 m_cpu;
+    Scheduler m_scheduler;
+    Mapper m_mapper;
+    Ppu m_ppu;
+    Timer m_timer;
+    Serial m_serial;
+    Apu m_apu;
+    Dma m_dma;
+
+    /// Peripheral time that PPU was last caught up to.
+    size_t m_ppu_clock;
+};
+} // namespace cocoa::gb
+
+#include "cocoa/gb/gameboy.tpp"
+
+#endif // COCOA_GB_GAMEBOY_HPP
@@ -0,0 +1,30 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_GB_GAMEBOY_TPP
+#define COCOA_GB_GAMEBOY_TPP
+
+#include <algorithm>
+#include <cstddef>
+
+namespace cocoa::gb {
+template <typename Predicate>
+size_t
+GameBoy::run_until(size_t tstates, Predicate predicate)
+{
+    size_t consumed = 0;
+    while (consumed < tstates) {
+        const size_t slice = std::min(tstates - consumed, m_scheduler.until_next_deadline());
+        consumed += m_cpu.run_until(slice, predicate);
+        if (m_cpu.state().mode == Sm83Mode::Stopped)
+            switch_speed();
+        m_scheduler.dispatch();
+        if (predicate(m_cpu.state()))
+            break;
+    }
+
+    return consumed;
+}
+} // namespace cocoa::gb
+
+#endif // COCOA_GB_GAMEBOY_TPP
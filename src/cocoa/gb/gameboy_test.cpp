@@ -0,0 +1,208 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/logger.h>
+
+#include "cocoa/gb/cartridge_test.hpp"
+#include "cocoa/gb/gameboy.hpp"
+#include "cocoa/gb/ppu.hpp"
+#include "cocoa/gb/snapshot.hpp"
+
+/// @brief Program that sends "Hi" over serial, then spins forever.
+// clang-format off
+static const std::vector<uint8_t> PROGRAM = {
+    0x3E, 'H',  // LD A, 'H'
+    0xE0, 0x01, // LDH [SB], A
+    0x3E, 0x81, // LD A, 0x81
+    0xE0, 0x02, // LDH [SC], A
+    0x3E, 'i',  // LD A, 'i'
+    0xE0, 0x01, // LDH [SB], A
+    0x3E, 0x81, // LD A, 0x81
+    0xE0, 0x02, // LDH [SC], A
+    0x18, 0xFE, // JR -2
+};
+// clang-format on
+
+TEST_CASE("size_t cocoa::gb::GameBoy::run_for(size_t)", "[run_for]")
+{
+    std::filesystem::path path = write_rom("cocoa_gameboy_run_for.gb", 2, 0x00, 0x00, PROGRAM);
+    cocoa::gb::GameBoy gameboy(std::make_shared<spdlog::logger>("test"), path);
+
+    REQUIRE(gameboy.run_for(2 * cocoa::gb::DOTS_PER_FRAME) >= 2 * cocoa::gb::DOTS_PER_FRAME);
+    REQUIRE(gameboy.serial().output() == "Hi");
+    REQUIRE(gameboy.ppu().frames() == 2);
+    REQUIRE(gameboy.cpu().state().pc == 0x0110);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("size_t cocoa::gb::GameBoy::run_until(size_t, Predicate)", "[run_until]")
+{
+    std::filesystem::path path = write_rom("cocoa_gameboy_run_until.gb", 2, 0x00, 0x00, PROGRAM);
+    cocoa::gb::GameBoy gameboy(std::make_shared<spdlog::logger>("test"), path);
+
+    auto at_pc = [](const cocoa::gb::Sm83State& state) { return state.pc == 0x0108; };
+    REQUIRE(gameboy.run_until(cocoa::gb::DOTS_PER_FRAME, at_pc) == 40);
+    REQUIRE(gameboy.serial().output() == "H");
+    REQUIRE(gameboy.ppu().ly() == 0);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("void cocoa::gb::GameBoy::load_state(const std::filesystem::path&)", "[load_state]")
+{
+    std::filesystem::path path = write_rom("cocoa_gameboy_load_state.gb", 2, 0x00, 0x00, PROGRAM);
+    std::filesystem::path state = std::filesystem::temp_directory_path() / "cocoa_gameboy.sav";
+    cocoa::gb::GameBoy gameboy(std::make_shared<spdlog::logger>("test"), path);
+
+    auto at_pc = [](const cocoa::gb::Sm83State& cpu) { return cpu.pc == 0x010C; };
+    gameboy.run_until(cocoa::gb::DOTS_PER_FRAME, at_pc);
+    gameboy.bus().write_byte(0xC123, 0x5A);
+    gameboy.save_state(state);
+
+    SECTION("Resume exactly where save state was taken")
+    {
+        gameboy.run_for(3 * cocoa::gb::DOTS_PER_FRAME);
+        const size_t tstates = gameboy.cpu().tstates();
+        const size_t frames = gameboy.ppu().frames();
+        const uint8_t ly = gameboy.ppu().ly();
+        const cocoa::gb::Framebuffer framebuffer = gameboy.ppu().framebuffer();
+        const uint8_t sc = gameboy.bus().read_io_reg(cocoa::gb::IoMap::SC);
+        gameboy.bus().write_byte(0xC123, 0x00);
+
+        gameboy.load_state(state);
+        REQUIRE(gameboy.cpu().state().pc == 0x010C);
+        REQUIRE(gameboy.bus().read_byte(0xC123) == 0x5A);
+        REQUIRE(gameboy.scheduler().is_scheduled(cocoa::gb::EventKind::Serial));
+
+        gameboy.run_for(tstates - gameboy.cpu().tstates());
+        REQUIRE(gameboy.cpu().tstates() == tstates);
+        REQUIRE(gameboy.ppu().frames() == frames);
+        REQUIRE(gameboy.ppu().ly() == ly);
+        REQUIRE(gameboy.ppu().framebuffer() == framebuffer);
+        REQUIRE(gameboy.bus().read_io_reg(cocoa::gb::IoMap::SC) == sc);
+    }
+
+    SECTION("Reject save state of another cartridge")
+    {
+        std::filesystem::path other_path
+            = write_rom("cocoa_gameboy_load_state_other.gb", 4, 0x00, 0x00, PROGRAM);
+        cocoa::gb::GameBoy other(std::make_shared<spdlog::logger>("test"), other_path);
+        const size_t tstates = other.cpu().tstates();
+        REQUIRE_THROWS_AS(other.load_state(state), cocoa::gb::SnapshotError);
+        REQUIRE(other.cpu().tstates() == tstates);
+        std::filesystem::remove(other_path);
+    }
+
+    std::filesystem::remove(state);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("std::unique_ptr<GameBoy> cocoa::gb::GameBoy::fork()", "[fork]")
+{
+    std::filesystem::path path = write_rom("cocoa_gameboy_fork.gb", 2, 0x00, 0x00, PROGRAM);
+    cocoa::gb::GameBoy gameboy(std::make_shared<spdlog::logger>("test"), path);
+
+    auto at_pc = [](const cocoa::gb::Sm83State& cpu) { return cpu.pc == 0x010C; };
+    gameboy.run_until(cocoa::gb::DOTS_PER_FRAME, at_pc);
+    gameboy.bus().write_byte(0xC123, 0x5A);
+    std::unique_ptr<cocoa::gb::GameBoy> fork = gameboy.fork();
+
+    SECTION("Continue exactly like parent")
+    {
+        REQUIRE(fork->cpu().state().pc == 0x010C);
+        REQUIRE(fork->cpu().tstates() == gameboy.cpu().tstates());
+        REQUIRE(&fork->cartridge() == &gameboy.cartridge());
+
+        gameboy.run_for(3 * cocoa::gb::DOTS_PER_FRAME);
+        fork->run_for(3 * cocoa::gb::DOTS_PER_FRAME);
+        REQUIRE(fork->cpu().tstates() == gameboy.cpu().tstates());
+        REQUIRE(fork->cpu().state().regs == gameboy.cpu().state().regs);
+        REQUIRE(fork->ppu().frames() == gameboy.ppu().frames());
+        REQUIRE(fork->ppu().framebuffer() == gameboy.ppu().framebuffer());
+        REQUIRE(fork->serial().output() == "i");
+    }
+
+    SECTION("Diverge from parent without affecting it")
+    {
+        REQUIRE(fork->bus().private_pages() == 0);
+        fork->bus().write_byte(0xC123, 0xA5);
+        REQUIRE(fork->bus().private_pages() == 1);
+        REQUIRE(gameboy.bus().read_byte(0xC123) == 0x5A);
+        REQUIRE(fork->bus().read_byte(0xC123) == 0xA5);
+    }
+
+    SECTION("Copy VRAM pages on first write by either system")
+    {
+        REQUIRE(fork->bus().read_byte(0x8000) == 0x00);
+        fork->bus().write_byte(0x8000, 0x3C);
+        gameboy.bus().write_byte(0x9800, 0x01);
+        REQUIRE(gameboy.bus().read_byte(0x8000) == 0x00);
+        REQUIRE(fork->bus().read_byte(0x8000) == 0x3C);
+        REQUIRE(fork->bus().read_byte(0x9800) == 0x00);
+        REQUIRE(fork->bus().private_pages() == 0);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("void cocoa::gb::GameBoy::switch_speed()", "[switch_speed]")
+{
+    // clang-format off
+    const std::vector<uint8_t> program = {
+        0x3E, 0x02,       // LD A, 2
+        0xE0, 0x70,       // LDH [SVBK], A
+        0x3E, 0x5A,       // LD A, 0x5A
+        0xEA, 0x00, 0xD0, // LD [0xD000], A
+        0x3E, 0x01,       // LD A, 1
+        0xE0, 0x4D,       // LDH [SPD], A
+        0x10, 0x00,       // STOP
+        0x18, 0xFE,       // JR -2
+    };
+    // clang-format on
+
+    std::filesystem::path path
+        = write_rom("cocoa_gameboy_switch_speed.gbc", 2, 0x00, 0x00, program, 0x80);
+    cocoa::gb::GameBoy gameboy(std::make_shared<spdlog::logger>("test"), path);
+    REQUIRE(gameboy.bus().read_io_reg(cocoa::gb::IoMap::SPD) == 0x7E);
+
+    // NOTE: PPU only covers a bit over one frame in two frames worth of CPU t-states.
+    gameboy.run_for(2 * cocoa::gb::DOTS_PER_FRAME);
+    REQUIRE(gameboy.cpu().state().mode == cocoa::gb::Sm83Mode::Running);
+    REQUIRE(gameboy.cpu().state().pc == 0x010F);
+    REQUIRE(gameboy.scheduler().is_double_speed());
+    REQUIRE(gameboy.bus().read_io_reg(cocoa::gb::IoMap::SPD) == 0xFE);
+    REQUIRE(gameboy.ppu().frames() == 1);
+
+    SECTION("Keep WRAM bank and speed in fork")
+    {
+        std::unique_ptr<cocoa::gb::GameBoy> fork = gameboy.fork();
+        REQUIRE(fork->scheduler().is_double_speed());
+        REQUIRE(fork->bus().read_byte(0xD000) == 0x5A);
+        fork->bus().write_io_reg(cocoa::gb::IoMap::SVBK, 0x01);
+        REQUIRE(fork->bus().read_byte(0xD000) == 0x00);
+        REQUIRE(gameboy.bus().read_byte(0xD000) == 0x5A);
+
+        gameboy.run_for(2 * cocoa::gb::DOTS_PER_FRAME);
+        fork->run_for(2 * cocoa::gb::DOTS_PER_FRAME);
+        REQUIRE(fork->ppu().frames() == gameboy.ppu().frames());
+        REQUIRE(gameboy.ppu().frames() == 2);
+    }
+
+    SECTION("Stay stopped on DMG")
+    {
+        std::filesystem::path dmg = write_rom("cocoa_gameboy_stop.gb", 2, 0x00, 0x00, program);
+        cocoa::gb::GameBoy other(std::make_shared<spdlog::logger>("test"), dmg);
+        other.run_for(cocoa::gb::DOTS_PER_FRAME);
+        REQUIRE(other.cpu().state().mode == cocoa::gb::Sm83Mode::Stopped);
+        REQUIRE(!other.scheduler().is_double_speed());
+        std::filesystem::remove(dmg);
+    }
+
+    std::filesystem::remove(path);
+}
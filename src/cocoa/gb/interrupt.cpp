@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstdint>
+
+#include "cocoa/gb/interrupt.hpp"
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/utility.hpp"
+
+namespace cocoa::gb {
+// NOTE: Only the five interrupt flags take part, whatever upper bits of IF and IE hold.
+constexpr uint8_t INTERRUPT_MASK = 0x1F;
+
+// NOTE: Vectors are evenly spaced in order of priority.
+constexpr uint16_t INTERRUPT_VECTOR_STRIDE = 0x08;
+
+InterruptController::InterruptController(MemoryBus& bus)
+    : m_bus(bus)
+    , m_pending(0)
+{
+    m_bus.map_io_handler(IoMap::IF, { nullptr, on_write, this });
+    m_bus.map_io_handler(IoMap::IE, { nullptr, on_write, this });
+    refresh();
+}
+
+InterruptVector
+InterruptController::acknowledge()
+{
+    const int isr = countr_zero(m_pending);
+    const uint16_t flags = from_enum(IoMap::IF);
+    m_bus.poke(flags, static_cast<uint8_t>(m_bus.peek(flags) & ~(1U << isr)));
+    m_pending = static_cast<uint8_t>(m_pending & (m_pending - 1));
+    return static_cast<InterruptVector>(
+        from_enum(InterruptVector::VBlank) + isr * INTERRUPT_VECTOR_STRIDE);
+}
+
+void
+InterruptController::refresh()
+{
+    m_pending = static_cast<uint8_t>(
+        m_bus.peek(from_enum(IoMap::IE)) & m_bus.peek(from_enum(IoMap::IF)) & INTERRUPT_MASK);
+}
+
+void
+InterruptController::on_write(void* context, uint16_t address, uint8_t value)
+{
+    InterruptController* controller = static_cast<InterruptController*>(context);
+    controller->m_bus.poke(address, value);
+    controller->refresh();
+}
+} // namespace cocoa::gb
@@ -28,6 +28,15 @@ template <enum Interrupt Isr>
 constexpr bool
 is_interrupt_pending(const MemoryBus& bus);
 
+/// @brief Get all pending interrupts.
+///
+/// Masks IF register with IE register, keeping only the five interrupt flags.
+///
+/// @param [in] bus Memory bus to check memory mapped IF and IE registers.
+/// @return Bitmask of pending interrupts, zero if none are pending.
+inline uint8_t
+pending_interrupts(const MemoryBus& bus);
+
 /// @brief Request new interrupt.
 ///
 /// Will set target flag in IF register.
@@ -45,6 +54,56 @@ request_interrupt(MemoryBus& bus);
 template <enum Interrupt Isr>
 constexpr void
 clear_interrupt(MemoryBus& bus);
+
+/// @brief Interrupt controller caching which interrupts are both requested and enabled.
+///
+/// IF and IE stay in plain bus memory, but writes to either go through I/O handlers that refresh
+/// one cached byte holding IE & IF. Checking for interrupts is thus one compare against that
+/// byte, and picking the one to service is one count of trailing zeros, since lower bits have
+/// higher priority. Neither touches the bus. `request_interrupt()` writes IF through the bus, so
+/// peripherals keep cache current without knowing about it.
+///
+/// @see https://gbdev.io/pandocs/Interrupts.html
+class InterruptController final {
+public:
+    /// @brief Attach controller to IF and IE of memory bus.
+    ///
+    /// @param [in] bus Memory bus holding IF and IE.
+    explicit InterruptController(MemoryBus& bus);
+
+    InterruptController(const InterruptController&) = delete;
+
+    InterruptController&
+    operator=(const InterruptController&) = delete;
+
+    ~InterruptController() noexcept = default;
+
+    /// @brief Get bitmask of pending interrupts, i.e., IE & IF.
+    ///
+    /// @return Bitmask of pending interrupts, zero if none are pending.
+    [[nodiscard]]
+    inline uint8_t
+    pending() const;
+
+    /// @brief Clear flag of highest priority pending interrupt in IF.
+    ///
+    /// @pre At least one interrupt is pending.
+    ///
+    /// @return Vector of interrupt to service.
+    InterruptVector
+    acknowledge();
+
+    /// @brief Recompute cache from IF and IE, e.g., once bus memory was replaced wholesale.
+    void
+    refresh();
+
+private:
+    static void
+    on_write(void* context, uint16_t address, uint8_t value);
+
+    MemoryBus& m_bus;
+    uint8_t m_pending;
+};
 } // namespace cocoa::gb
 
 #include "cocoa/gb/interrupt.tpp"
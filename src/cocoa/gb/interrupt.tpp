@@ -17,6 +17,14 @@ is_interrupt_pending(const MemoryBus& bus)
         && cocoa::is_bit_set<uint8_t, cocoa::from_enum(Isr)>(if_reg);
 }
 
+inline uint8_t
+pending_interrupts(const MemoryBus& bus)
+{
+    uint8_t ie_reg = bus.read_io_reg(IoMap::IE);
+    uint8_t if_reg = bus.read_io_reg(IoMap::IF);
+    return static_cast<uint8_t>(ie_reg & if_reg & 0x1F);
+}
+
 template <enum Interrupt Isr>
 constexpr void
 request_interrupt(MemoryBus& bus)
@@ -33,7 +41,13 @@ clear_interrupt(MemoryBus& bus)
     uint8_t if_reg = bus.read_io_reg(IoMap::IF);
     cocoa::clear_bit<uint8_t, cocoa::from_enum(Isr)>(if_reg);
     bus.write_io_reg(IoMap::IF, if_reg);
-}    
+}
+
+inline uint8_t
+InterruptController::pending() const
+{
+    return m_pending;
+}
 } // namespace cocoa::gb
 
 #endif // COCOA_GB_INTERRUPT_TPP
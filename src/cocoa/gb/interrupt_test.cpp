@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstdint>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "cocoa/gb/interrupt.hpp"
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/utility.hpp"
+
+TEST_CASE("uint8_t cocoa::gb::InterruptController::pending() const", "[pending]")
+{
+    cocoa::gb::MemoryBus bus {};
+    cocoa::gb::InterruptController interrupts(bus);
+    REQUIRE(interrupts.pending() == 0x00);
+
+    SECTION("Track writes to IF and IE")
+    {
+        bus.write_io_reg(cocoa::gb::IoMap::IF, 0xE5);
+        REQUIRE(interrupts.pending() == 0x00);
+        bus.write_io_reg(cocoa::gb::IoMap::IE, 0xFC);
+        REQUIRE(interrupts.pending() == 0x04);
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::IF) == 0xE5);
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::IE) == 0xFC);
+    }
+
+    SECTION("Track requested interrupts")
+    {
+        bus.write_io_reg(cocoa::gb::IoMap::IE, 0x1F);
+        cocoa::gb::request_interrupt<cocoa::gb::Interrupt::Serial>(bus);
+        REQUIRE(interrupts.pending() == 0x08);
+        cocoa::gb::clear_interrupt<cocoa::gb::Interrupt::Serial>(bus);
+        REQUIRE(interrupts.pending() == 0x00);
+    }
+
+    SECTION("Recompute from bus memory on refresh")
+    {
+        bus.poke(cocoa::from_enum(cocoa::gb::IoMap::IE), 0x03);
+        bus.poke(cocoa::from_enum(cocoa::gb::IoMap::IF), 0x02);
+        REQUIRE(interrupts.pending() == 0x00);
+        interrupts.refresh();
+        REQUIRE(interrupts.pending() == 0x02);
+    }
+}
+
+TEST_CASE("InterruptVector cocoa::gb::InterruptController::acknowledge()", "[acknowledge]")
+{
+    cocoa::gb::MemoryBus bus {};
+    cocoa::gb::InterruptController interrupts(bus);
+    bus.write_io_reg(cocoa::gb::IoMap::IE, 0x1E);
+    bus.write_io_reg(cocoa::gb::IoMap::IF, 0xF5);
+
+    REQUIRE(interrupts.acknowledge() == cocoa::gb::InterruptVector::Timer);
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::IF) == 0xF1);
+    REQUIRE(interrupts.pending() == 0x10);
+
+    REQUIRE(interrupts.acknowledge() == cocoa::gb::InterruptVector::Joypad);
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::IF) == 0xE1);
+    REQUIRE(interrupts.pending() == 0x00);
+}
@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <variant>
+
+#include <fmt/format.h>
+
+#include "cocoa/gb/cartridge.hpp"
+#include "cocoa/gb/mapper.hpp"
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/utility.hpp"
+
+namespace cocoa::gb {
+MbcType
+mbc_type(const CartridgeType type)
+{
+    switch (type) {
+    case CartridgeType::RomOnly:
+    case CartridgeType::RomRam:
+    case CartridgeType::RomRamBattery:
+        return MbcType::None;
+    case CartridgeType::Mbc1:
+    case CartridgeType::Mbc1Ram:
+    case CartridgeType::Mbc1RamBattery:
+        return MbcType::Mbc1;
+    case CartridgeType::Mbc2:
+    case CartridgeType::Mbc2Battery:
+        return MbcType::Mbc2;
+    case CartridgeType::Mbc3TimerBattery:
+    case CartridgeType::Mbc3TimerRamBattery:
+    case CartridgeType::Mbc3:
+    case CartridgeType::Mbc3Ram:
+    case CartridgeType::Mbc3RamBattery:
+        return MbcType::Mbc3;
+    case CartridgeType::Mbc5:
+    case CartridgeType::Mbc5Ram:
+    case CartridgeType::Mbc5RamBattery:
+    case CartridgeType::Mbc5Rumble:
+    case CartridgeType::Mbc5RumbleRam:
+    case CartridgeType::Mbc5RumbleRamBattery:
+        return MbcType::Mbc5;
+    }
+
+    throw CartridgeError(fmt::format("Unsupported cartridge type 0x{0:02X}", from_enum(type)));
+}
+
+Mapper::Mapper(const Cartridge& cart, MemoryBus& bus, const size_t& clock)
+    : m_mbc()
+{
+    switch (mbc_type(cart.type())) {
+    case MbcType::None:
+        m_mbc.emplace<Mbc<MbcType::None>>(cart, bus, clock);
+        break;
+    case MbcType::Mbc1:
+        m_mbc.emplace<Mbc<MbcType::Mbc1>>(cart, bus, clock);
+        break;
+    case MbcType::Mbc2:
+        m_mbc.emplace<Mbc<MbcType::Mbc2>>(cart, bus, clock);
+        break;
+    case MbcType::Mbc3:
+        m_mbc.emplace<Mbc<MbcType::Mbc3>>(cart, bus, clock);
+        break;
+    case MbcType::Mbc5:
+        m_mbc.emplace<Mbc<MbcType::Mbc5>>(cart, bus, clock);
+        break;
+    }
+}
+
+MbcType
+Mapper::type() const
+{
+    // INVARIANT: Alternatives after std::monostate follow declaration order of MbcType.
+    return static_cast<MbcType>(m_mbc.index() - 1);
+}
+
+const PagedMemory&
+Mapper::ram() const
+{
+    return std::visit(
+        [](const auto& mbc) -> const PagedMemory& {
+            if constexpr (std::is_same_v<std::decay_t<decltype(mbc)>, std::monostate>) {
+                static const PagedMemory empty(0, 0x00);
+                return empty;
+            } else {
+                return mbc.ram();
+            }
+        },
+        m_mbc);
+}
+
+void
+Mapper::save_state(MapperSnapshot& out) const
+{
+    out = {};
+    std::visit(
+        [&out](const auto& mbc) {
+            if constexpr (!std::is_same_v<std::decay_t<decltype(mbc)>, std::monostate>)
+                mbc.save_state(out);
+        },
+        m_mbc);
+}
+
+void
+Mapper::load_state(const MapperSnapshot& snapshot, const uint8_t* ram)
+{
+    std::visit(
+        [&snapshot, ram](auto& mbc) {
+            if constexpr (!std::is_same_v<std::decay_t<decltype(mbc)>, std::monostate>)
+                mbc.load_state(snapshot, ram);
+        },
+        m_mbc);
+}
+
+void
+Mapper::share_state(Mapper& other)
+{
+    std::visit(
+        [&other](auto& mbc) {
+            using Controller = std::decay_t<decltype(mbc)>;
+            if constexpr (!std::is_same_v<Controller, std::monostate>)
+                mbc.share_state(std::get<Controller>(other.m_mbc));
+        },
+        m_mbc);
+}
+} // namespace cocoa::gb
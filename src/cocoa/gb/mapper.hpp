@@ -0,0 +1,282 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_GB_MAPPER_HPP
+#define COCOA_GB_MAPPER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <variant>
+
+#include "cocoa/gb/cartridge.hpp"
+#include "cocoa/gb/memory.hpp"
+
+namespace cocoa::gb {
+/// @brief Size of one switchable external RAM bank.
+constexpr size_t RAM_BANK_SIZE = 0x2000;
+
+/// @brief Amount of 4-bit cells built into MBC2.
+constexpr size_t MBC2_RAM_SIZE = 512;
+
+/// @brief Amount of t-states in one second of real time clock.
+constexpr size_t RTC_TSTATES_PER_SECOND = 4194304;
+
+/// @brief Memory bank controllers available.
+///
+/// @see https://gbdev.io/pandocs/MBCs.html
+enum class MbcType {
+    None,
+    Mbc1,
+    Mbc2,
+    Mbc3,
+    Mbc5,
+};
+
+/// @brief Real time clock registers of MBC3.
+///
+/// @see https://gbdev.io/pandocs/MBC3.html#the-clock-counter-registers
+struct RtcRegisters final {
+    uint8_t seconds;
+    uint8_t minutes;
+    uint8_t hours;
+    uint8_t days_low;
+    uint8_t days_high;
+};
+
+/// @brief Plain image of memory bank controller registers stored in save states.
+///
+/// External RAM is stored as a separate section, because its size depends on cartridge.
+///
+/// @invariant Fields are fixed width and explicitly padded, so layout is identical across builds.
+struct MapperSnapshot final {
+    uint64_t rtc_base;
+    uint16_t rom_bank;
+    uint8_t type;
+    uint8_t ram_bank;
+    uint8_t ram_enabled;
+    uint8_t mode;
+    uint8_t latch;
+    RtcRegisters rtc;
+    RtcRegisters rtc_latched;
+    std::array<uint8_t, 7> reserved;
+};
+
+static_assert(sizeof(MapperSnapshot) == 32);
+
+/// @brief Get memory bank controller used by cartridge hardware.
+///
+/// @param [in] type Cartridge hardware declared by header.
+/// @return Memory bank controller of cartridge.
+///
+/// @throws `CartridgeError` if cartridge hardware is not supported.
+MbcType
+mbc_type(const CartridgeType type);
+
+/// @brief Memory bank controller.
+///
+/// Each controller is its own specialization, so bank select decoding is resolved at compile time
+/// and inlined straight into the memory bus write handler. A write to a mapper register costs one
+/// handler call with no virtual dispatch or runtime switch on controller type.
+///
+/// Banks are switched by repointing memory bus pages into cartridge ROM and external RAM. External
+/// RAM only goes through handlers while it is disabled, for MBC2 nibble RAM and MBC3 RTC
+/// registers, or for the first write to a page still shared with a fork.
+///
+/// The MBC3 real time clock is evaluated lazily from given t-state clock, and only when latched
+/// or written. Thus it stays deterministic and costs nothing per cycle.
+///
+/// @see https://gbdev.io/pandocs/MBCs.html
+template <enum MbcType T>
+class Mbc final {
+public:
+    /// @brief Attach controller to memory bus.
+    ///
+    /// @param [in] cart Cartridge to bank ROM from.
+    /// @param [in] bus Memory bus to map banks into.
+    /// @param [in] clock Running t-state count driving the MBC3 real time clock.
+    Mbc(const Cartridge& cart, MemoryBus& bus, const size_t& clock);
+
+    Mbc(const Mbc&) = delete;
+
+    Mbc&
+    operator=(const Mbc&) = delete;
+
+    ~Mbc() noexcept = default;
+
+    /// @brief Decode write to mapper register inside ROM range.
+    ///
+    /// @param [in] address Address inside `Rom0Start..RomXEnd`.
+    /// @param [in] value Value written.
+    void
+    write_rom(const uint16_t address, const uint8_t value);
+
+    /// @brief Read external RAM that is not directly mapped.
+    ///
+    /// @param [in] address Address inside `SramStart..SramEnd`.
+    /// @return Value read.
+    [[nodiscard]]
+    uint8_t
+    read_ram(const uint16_t address) const;
+
+    /// @brief Write external RAM that is not directly mapped.
+    ///
+    /// @param [in] address Address inside `SramStart..SramEnd`.
+    /// @param [in] value Value written.
+    void
+    write_ram(const uint16_t address, const uint8_t value);
+
+    /// @brief Get contents of external RAM.
+    [[nodiscard]]
+    const PagedMemory&
+    ram() const;
+
+    /// @brief Get currently latched real time clock registers.
+    [[nodiscard]]
+    const RtcRegisters&
+    rtc() const;
+
+    /// @brief Capture controller registers for save state.
+    ///
+    /// @param [out] out Snapshot to fill.
+    void
+    save_state(MapperSnapshot& out) const;
+
+    /// @brief Restore controller registers and external RAM from save state, then remap banks.
+    ///
+    /// @pre `ram` holds exactly `ram().size()` bytes.
+    ///
+    /// @param [in] snapshot Snapshot to restore from.
+    /// @param [in] ram Contents of external RAM.
+    void
+    load_state(const MapperSnapshot& snapshot, const uint8_t* ram);
+
+    /// @brief Take over registers of other controller, sharing its external RAM copy-on-write.
+    ///
+    /// @note Not thread-safe with respect to other controller, since its RAM gets mapped again.
+    ///
+    /// @param [in,out] other Controller to take over state from.
+    void
+    share_state(Mbc& other);
+
+private:
+    static void
+    on_write_rom(void* context, uint16_t address, uint8_t value);
+
+    static uint8_t
+    on_read_ram(void* context, uint16_t address);
+
+    static void
+    on_write_ram(void* context, uint16_t address, uint8_t value);
+
+    void
+    remap_rom();
+
+    /// @brief Restore controller registers from save state, then remap banks.
+    void
+    restore_registers(const MapperSnapshot& snapshot);
+
+    /// @brief Get external RAM bank shown at `SramStart..SramEnd`.
+    [[nodiscard]]
+    size_t
+    ram_bank() const;
+
+    /// @brief Check if external RAM bank is mapped straight into memory bus while enabled.
+    [[nodiscard]]
+    bool
+    is_ram_direct() const;
+
+    void
+    remap_ram();
+
+    [[nodiscard]]
+    RtcRegisters
+    current_rtc() const;
+
+    void
+    sync_rtc();
+
+    const Cartridge& m_cart;
+    MemoryBus& m_bus;
+    const size_t& m_clock;
+    PagedMemory m_ram;
+    uint16_t m_rom_bank;
+    uint8_t m_ram_bank;
+    bool m_ram_enabled;
+    bool m_mode;
+    uint8_t m_latch;
+    RtcRegisters m_rtc;
+    RtcRegisters m_rtc_latched;
+    size_t m_rtc_base;
+};
+
+/// @brief Memory bank controller selected by cartridge header.
+///
+/// Owns the controller specialization matching the cartridge, which registers itself with the
+/// memory bus on construction.
+class Mapper final {
+public:
+    /// @brief Attach memory bank controller matching cartridge to memory bus.
+    ///
+    /// @param [in] cart Cartridge to bank ROM from.
+    /// @param [in] bus Memory bus to map banks into.
+    /// @param [in] clock Running t-state count driving the MBC3 real time clock.
+    ///
+    /// @throws `CartridgeError` if cartridge hardware is not supported.
+    Mapper(const Cartridge& cart, MemoryBus& bus, const size_t& clock);
+
+    Mapper(const Mapper&) = delete;
+
+    Mapper&
+    operator=(const Mapper&) = delete;
+
+    ~Mapper() noexcept = default;
+
+    /// @brief Get type of memory bank controller.
+    [[nodiscard]]
+    MbcType
+    type() const;
+
+    /// @brief Get contents of external RAM.
+    [[nodiscard]]
+    const PagedMemory&
+    ram() const;
+
+    /// @brief Capture controller registers for save state.
+    ///
+    /// @param [out] out Snapshot to fill.
+    void
+    save_state(MapperSnapshot& out) const;
+
+    /// @brief Restore controller registers and external RAM from save state.
+    ///
+    /// @pre Snapshot was taken from a controller of the same type, and `ram` holds exactly
+    ///      `ram().size()` bytes.
+    ///
+    /// @param [in] snapshot Snapshot to restore from.
+    /// @param [in] ram Contents of external RAM.
+    void
+    load_state(const MapperSnapshot& snapshot, const uint8_t* ram);
+
+    /// @brief Take over state of other controller, sharing its external RAM copy-on-write.
+    ///
+    /// External RAM pages are copied on first write by either controller.
+    ///
+    /// @note Not thread-safe with respect to other controller, since its RAM gets mapped again.
+    ///
+    /// @pre Other controller is of the same type.
+    ///
+    /// @param [in,out] other Controller to take over state from.
+    void
+    share_state(Mapper& other);
+
+private:
+    std::variant<std::monostate, Mbc<MbcType::None>, Mbc<MbcType::Mbc1>, Mbc<MbcType::Mbc2>,
+        Mbc<MbcType::Mbc3>, Mbc<MbcType::Mbc5>>
+        m_mbc;
+};
+} // namespace cocoa::gb
+
+#include "cocoa/gb/mapper.tpp"
+
+#endif // COCOA_GB_MAPPER_HPP
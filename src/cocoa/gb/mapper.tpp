@@ -0,0 +1,372 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_GB_MAPPER_TPP
+#define COCOA_GB_MAPPER_TPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "cocoa/utility.hpp"
+
+namespace cocoa::gb {
+// NOTE: MBC3 maps RTC registers into external RAM range when bank 0x08 to 0x0C is selected.
+constexpr uint8_t RTC_SELECT_FIRST = 0x08;
+constexpr uint8_t RTC_SELECT_LAST = 0x0C;
+constexpr uint8_t RTC_DAY_HIGH_BIT = 0x01;
+constexpr uint8_t RTC_HALT_BIT = 0x40;
+constexpr uint8_t RTC_CARRY_BIT = 0x80;
+
+template <enum MbcType T>
+Mbc<T>::Mbc(const Cartridge& cart, MemoryBus& bus, const size_t& clock)
+    : m_cart(cart)
+    , m_bus(bus)
+    , m_clock(clock)
+    , m_ram((T == MbcType::Mbc2) ? MBC2_RAM_SIZE : cart.ram_size(),
+          (T == MbcType::Mbc2) ? 0x0F : 0x00)
+    , m_rom_bank(1)
+    , m_ram_bank(0)
+    , m_ram_enabled(T == MbcType::None)
+    , m_mode(false)
+    , m_latch(0xFF)
+    , m_rtc {}
+    , m_rtc_latched {}
+    , m_rtc_base(clock)
+{
+    m_cart.attach(m_bus);
+    m_bus.map_handler(from_enum(MemoryMap::Rom0Start), from_enum(MemoryMap::RomXEnd),
+        { nullptr, on_write_rom, this });
+    m_bus.map_handler(from_enum(MemoryMap::SramStart), from_enum(MemoryMap::SramEnd),
+        { on_read_ram, on_write_ram, this });
+    remap_ram();
+}
+
+template <enum MbcType T>
+void
+Mbc<T>::write_rom(const uint16_t address, const uint8_t value)
+{
+    if constexpr (T == MbcType::None) {
+        (void)address;
+        (void)value;
+    }
+
+    if constexpr (T == MbcType::Mbc1) {
+        if (address <= 0x1FFF) {
+            m_ram_enabled = (value & 0x0F) == 0x0A;
+            remap_ram();
+        } else if (address <= 0x3FFF) {
+            uint8_t low = value & 0x1F;
+            m_rom_bank = static_cast<uint16_t>((m_rom_bank & 0x60) | (low == 0 ? 1 : low));
+            remap_rom();
+        } else if (address <= 0x5FFF) {
+            m_ram_bank = value & 0x03;
+            m_rom_bank = static_cast<uint16_t>((m_rom_bank & 0x1F) | (m_ram_bank << 5));
+            remap_rom();
+            remap_ram();
+        } else {
+            m_mode = (value & 0x01) == 0x01;
+            remap_rom();
+            remap_ram();
+        }
+    }
+
+    if constexpr (T == MbcType::Mbc2) {
+        if (address > 0x3FFF)
+            return;
+
+        // INVARIANT: Bit 8 of address selects between RAM enable and ROM bank registers.
+        if ((address & 0x0100) == 0) {
+            m_ram_enabled = (value & 0x0F) == 0x0A;
+        } else {
+            uint8_t bank = value & 0x0F;
+            m_rom_bank = bank == 0 ? 1 : bank;
+            remap_rom();
+        }
+    }
+
+    if constexpr (T == MbcType::Mbc3) {
+        if (address <= 0x1FFF) {
+            m_ram_enabled = (value & 0x0F) == 0x0A;
+            remap_ram();
+        } else if (address <= 0x3FFF) {
+            uint8_t bank = value & 0x7F;
+            m_rom_bank = bank == 0 ? 1 : bank;
+            remap_rom();
+        } else if (address <= 0x5FFF) {
+            m_ram_bank = value & 0x0F;
+            remap_ram();
+        } else {
+            if (m_latch == 0x00 && value == 0x01)
+                m_rtc_latched = current_rtc();
+            m_latch = value;
+        }
+    }
+
+    if constexpr (T == MbcType::Mbc5) {
+        if (address <= 0x1FFF) {
+            m_ram_enabled = (value & 0x0F) == 0x0A;
+            remap_ram();
+        } else if (address <= 0x2FFF) {
+            m_rom_bank = static_cast<uint16_t>((m_rom_bank & 0x100) | value);
+            remap_rom();
+        } else if (address <= 0x3FFF) {
+            m_rom_bank = static_cast<uint16_t>((m_rom_bank & 0x0FF) | ((value & 0x01) << 8));
+            remap_rom();
+        } else if (address <= 0x5FFF) {
+            m_ram_bank = value & 0x0F;
+            remap_ram();
+        }
+    }
+}
+
+template <enum MbcType T>
+uint8_t
+Mbc<T>::read_ram(const uint16_t address) const
+{
+    if (!m_ram_enabled)
+        return 0xFF;
+
+    // NOTE: RTC registers are served even when cartridge has no RAM, e.g., MBC3+TIMER+BATTERY.
+    if constexpr (T == MbcType::Mbc3) {
+        switch (m_ram_bank) {
+        case 0x08:
+            return m_rtc_latched.seconds;
+        case 0x09:
+            return m_rtc_latched.minutes;
+        case 0x0A:
+            return m_rtc_latched.hours;
+        case 0x0B:
+            return m_rtc_latched.days_low;
+        case 0x0C:
+            return m_rtc_latched.days_high;
+        default:
+            break;
+        }
+    }
+
+    if (m_ram.empty())
+        return 0xFF;
+
+    const size_t offset = address - from_enum(MemoryMap::SramStart);
+    if constexpr (T == MbcType::Mbc2)
+        return static_cast<uint8_t>(0xF0 | m_ram[offset % MBC2_RAM_SIZE]);
+
+    return m_ram[(ram_bank() * RAM_BANK_SIZE + offset) % m_ram.size()];
+}
+
+template <enum MbcType T>
+void
+Mbc<T>::write_ram(const uint16_t address, const uint8_t value)
+{
+    if (!m_ram_enabled)
+        return;
+
+    if constexpr (T == MbcType::Mbc3) {
+        if (m_ram_bank >= RTC_SELECT_FIRST && m_ram_bank <= RTC_SELECT_LAST) {
+            sync_rtc();
+            switch (m_ram_bank) {
+            case 0x08:
+                m_rtc.seconds = value & 0x3F;
+                m_rtc_base = m_clock;
+                break;
+            case 0x09:
+                m_rtc.minutes = value & 0x3F;
+                break;
+            case 0x0A:
+                m_rtc.hours = value & 0x1F;
+                break;
+            case 0x0B:
+                m_rtc.days_low = value;
+                break;
+            default:
+                m_rtc.days_high = value & (RTC_DAY_HIGH_BIT | RTC_HALT_BIT | RTC_CARRY_BIT);
+                break;
+            }
+            return;
+        }
+    }
+
+    if (m_ram.empty())
+        return;
+
+    const size_t offset = address - from_enum(MemoryMap::SramStart);
+    if constexpr (T == MbcType::Mbc2) {
+        m_ram.write(offset % MBC2_RAM_SIZE, value & 0x0F);
+    } else {
+        m_ram.write((ram_bank() * RAM_BANK_SIZE + offset) % m_ram.size(), value);
+
+        // NOTE: Writes to directly mapped RAM only get here while their page was still shared.
+        if (is_ram_direct())
+            remap_ram();
+    }
+}
+
+template <enum MbcType T>
+const PagedMemory&
+Mbc<T>::ram() const
+{
+    return m_ram;
+}
+
+template <enum MbcType T>
+const RtcRegisters&
+Mbc<T>::rtc() const
+{
+    return m_rtc_latched;
+}
+
+template <enum MbcType T>
+void
+Mbc<T>::save_state(MapperSnapshot& out) const
+{
+    out = {};
+    out.rtc_base = m_rtc_base;
+    out.rom_bank = m_rom_bank;
+    out.type = static_cast<uint8_t>(T);
+    out.ram_bank = m_ram_bank;
+    out.ram_enabled = m_ram_enabled ? 1 : 0;
+    out.mode = m_mode ? 1 : 0;
+    out.latch = m_latch;
+    out.rtc = m_rtc;
+    out.rtc_latched = m_rtc_latched;
+}
+
+template <enum MbcType T>
+void
+Mbc<T>::load_state(const MapperSnapshot& snapshot, const uint8_t* ram)
+{
+    m_ram.load(ram);
+    restore_registers(snapshot);
+}
+
+template <enum MbcType T>
+void
+Mbc<T>::share_state(Mbc& other)
+{
+    MapperSnapshot snapshot = {};
+    other.save_state(snapshot);
+    m_ram.share(other.m_ram);
+    restore_registers(snapshot);
+
+    // INVARIANT: Both controllers drop write entries of RAM pages that are shared now.
+    other.remap_ram();
+}
+
+template <enum MbcType T>
+void
+Mbc<T>::on_write_rom(void* context, uint16_t address, uint8_t value)
+{
+    static_cast<Mbc<T>*>(context)->write_rom(address, value);
+}
+
+template <enum MbcType T>
+uint8_t
+Mbc<T>::on_read_ram(void* context, uint16_t address)
+{
+    return static_cast<const Mbc<T>*>(context)->read_ram(address);
+}
+
+template <enum MbcType T>
+void
+Mbc<T>::on_write_ram(void* context, uint16_t address, uint8_t value)
+{
+    static_cast<Mbc<T>*>(context)->write_ram(address, value);
+}
+
+template <enum MbcType T>
+void
+Mbc<T>::restore_registers(const MapperSnapshot& snapshot)
+{
+    m_rtc_base = snapshot.rtc_base;
+    m_rom_bank = snapshot.rom_bank;
+    m_ram_bank = snapshot.ram_bank;
+    m_ram_enabled = snapshot.ram_enabled != 0;
+    m_mode = snapshot.mode != 0;
+    m_latch = snapshot.latch;
+    m_rtc = snapshot.rtc;
+    m_rtc_latched = snapshot.rtc_latched;
+    remap_rom();
+    remap_ram();
+}
+
+template <enum MbcType T>
+void
+Mbc<T>::remap_rom()
+{
+    if constexpr (T == MbcType::Mbc1) {
+        // INVARIANT: Mode 1 also banks lower ROM region with upper two bank bits.
+        m_cart.switch_bank0(m_bus, m_mode ? (m_rom_bank & 0x60) : 0);
+    }
+
+    m_cart.switch_bank(m_bus, m_rom_bank);
+}
+
+template <enum MbcType T>
+size_t
+Mbc<T>::ram_bank() const
+{
+    // INVARIANT: MBC1 only banks external RAM in mode 1.
+    if constexpr (T == MbcType::Mbc1)
+        return m_mode ? m_ram_bank : 0;
+    return m_ram_bank;
+}
+
+template <enum MbcType T>
+bool
+Mbc<T>::is_ram_direct() const
+{
+    bool direct = m_ram_enabled && m_ram.size() >= RAM_BANK_SIZE;
+    if constexpr (T == MbcType::Mbc2)
+        direct = false;
+    if constexpr (T == MbcType::Mbc3)
+        direct = direct && m_ram_bank < RTC_SELECT_FIRST;
+    return direct;
+}
+
+template <enum MbcType T>
+void
+Mbc<T>::remap_ram()
+{
+    if (is_ram_direct()) {
+        const size_t first = ((ram_bank() * RAM_BANK_SIZE) % m_ram.size()) / MEMORY_PAGE_SIZE;
+        m_bus.map_paged(
+            from_enum(MemoryMap::SramStart), from_enum(MemoryMap::SramEnd), m_ram, first);
+    } else {
+        m_bus.map_pages(
+            from_enum(MemoryMap::SramStart), from_enum(MemoryMap::SramEnd), nullptr, nullptr);
+    }
+}
+
+template <enum MbcType T>
+RtcRegisters
+Mbc<T>::current_rtc() const
+{
+    if ((m_rtc.days_high & RTC_HALT_BIT) != 0)
+        return m_rtc;
+
+    size_t days = static_cast<size_t>(((m_rtc.days_high & RTC_DAY_HIGH_BIT) << 8) | m_rtc.days_low);
+    size_t seconds = m_rtc.seconds + m_rtc.minutes * size_t(60) + m_rtc.hours * size_t(3600)
+        + days * size_t(86400) + (m_clock - m_rtc_base) / RTC_TSTATES_PER_SECOND;
+
+    RtcRegisters rtc = {};
+    rtc.seconds = static_cast<uint8_t>(seconds % 60);
+    rtc.minutes = static_cast<uint8_t>((seconds / 60) % 60);
+    rtc.hours = static_cast<uint8_t>((seconds / 3600) % 24);
+    days = seconds / 86400;
+    rtc.days_low = static_cast<uint8_t>(days & 0xFF);
+    rtc.days_high = static_cast<uint8_t>((m_rtc.days_high & (RTC_HALT_BIT | RTC_CARRY_BIT))
+        | ((days >> 8) & RTC_DAY_HIGH_BIT) | (days > 511 ? RTC_CARRY_BIT : 0));
+    return rtc;
+}
+
+template <enum MbcType T>
+void
+Mbc<T>::sync_rtc()
+{
+    const size_t elapsed = m_clock - m_rtc_base;
+    m_rtc = current_rtc();
+    m_rtc_base = m_clock - (elapsed % RTC_TSTATES_PER_SECOND);
+}
+} // namespace cocoa::gb
+
+#endif // COCOA_GB_MAPPER_TPP
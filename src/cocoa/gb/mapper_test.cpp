@@ -0,0 +1,230 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <filesystem>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "cocoa/gb/cartridge.hpp"
+#include "cocoa/gb/cartridge_test.hpp"
+#include "cocoa/gb/mapper.hpp"
+#include "cocoa/gb/memory.hpp"
+
+TEST_CASE("cocoa::gb::MbcType cocoa::gb::mbc_type(const CartridgeType)", "[mbc_type]")
+{
+    REQUIRE(cocoa::gb::mbc_type(cocoa::gb::CartridgeType::RomOnly) == cocoa::gb::MbcType::None);
+    REQUIRE(cocoa::gb::mbc_type(cocoa::gb::CartridgeType::Mbc1Ram) == cocoa::gb::MbcType::Mbc1);
+    REQUIRE(cocoa::gb::mbc_type(cocoa::gb::CartridgeType::Mbc2Battery) == cocoa::gb::MbcType::Mbc2);
+    REQUIRE(cocoa::gb::mbc_type(cocoa::gb::CartridgeType::Mbc3TimerBattery)
+        == cocoa::gb::MbcType::Mbc3);
+    REQUIRE(cocoa::gb::mbc_type(cocoa::gb::CartridgeType::Mbc5Rumble) == cocoa::gb::MbcType::Mbc5);
+    REQUIRE_THROWS_AS(cocoa::gb::mbc_type(static_cast<cocoa::gb::CartridgeType>(0xFC)),
+        cocoa::gb::CartridgeError);
+}
+
+TEST_CASE("cocoa::gb::Mapper [MBC1]", "[mapper]")
+{
+    std::filesystem::path path = write_rom("cocoa_mapper_mbc1.gb", 64, 0x03, 0x03);
+    cocoa::gb::Cartridge cart(path);
+    cocoa::gb::MemoryBus bus {};
+    size_t clock = 0;
+    cocoa::gb::Mapper mapper(cart, bus, clock);
+    REQUIRE(mapper.type() == cocoa::gb::MbcType::Mbc1);
+
+    SECTION("Select bank zero as bank one")
+    {
+        bus.write_byte(0x2000, 0x00);
+        REQUIRE(bus.read_byte(0x4000) == 0x01);
+        bus.write_byte(0x2000, 0x05);
+        REQUIRE(bus.read_byte(0x4000) == 0x05);
+    }
+
+    SECTION("Combine upper bank bits")
+    {
+        bus.write_byte(0x2000, 0x02);
+        bus.write_byte(0x4000, 0x01);
+        REQUIRE(bus.read_byte(0x4000) == 0x22);
+        REQUIRE(bus.read_byte(0x0000) == 0x00);
+        bus.write_byte(0x6000, 0x01);
+        REQUIRE(bus.read_byte(0x0000) == 0x20);
+    }
+
+    SECTION("Gate external RAM behind enable")
+    {
+        bus.write_byte(0xA000, 0x42);
+        REQUIRE(bus.read_byte(0xA000) == 0xFF);
+        bus.write_byte(0x0000, 0x0A);
+        bus.write_byte(0xA000, 0x42);
+        REQUIRE(bus.read_byte(0xA000) == 0x42);
+        bus.write_byte(0x6000, 0x01);
+        bus.write_byte(0x4000, 0x02);
+        REQUIRE(bus.read_byte(0xA000) == 0x00);
+        bus.write_byte(0x4000, 0x00);
+        REQUIRE(bus.read_byte(0xA000) == 0x42);
+        bus.write_byte(0x0000, 0x00);
+        REQUIRE(bus.read_byte(0xA000) == 0xFF);
+        REQUIRE(mapper.ram()[0] == 0x42);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("cocoa::gb::Mapper [MBC2]", "[mapper]")
+{
+    std::filesystem::path path = write_rom("cocoa_mapper_mbc2.gb", 16, 0x06, 0x00);
+    cocoa::gb::Cartridge cart(path);
+    cocoa::gb::MemoryBus bus {};
+    size_t clock = 0;
+    cocoa::gb::Mapper mapper(cart, bus, clock);
+    REQUIRE(mapper.type() == cocoa::gb::MbcType::Mbc2);
+
+    bus.write_byte(0x2100, 0x03);
+    REQUIRE(bus.read_byte(0x4000) == 0x03);
+    bus.write_byte(0x2000, 0x0A);
+    REQUIRE(bus.read_byte(0x4000) == 0x03);
+
+    bus.write_byte(0x0000, 0x0A);
+    bus.write_byte(0xA000, 0xAB);
+    REQUIRE(bus.read_byte(0xA000) == 0xFB);
+    REQUIRE(bus.read_byte(0xA200) == 0xFB);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("cocoa::gb::Mapper [MBC3]", "[mapper]")
+{
+    std::filesystem::path path = write_rom("cocoa_mapper_mbc3.gb", 128, 0x10, 0x03);
+    cocoa::gb::Cartridge cart(path);
+    cocoa::gb::MemoryBus bus {};
+    size_t clock = 0;
+    cocoa::gb::Mapper mapper(cart, bus, clock);
+    REQUIRE(mapper.type() == cocoa::gb::MbcType::Mbc3);
+
+    SECTION("Select seven bit ROM bank")
+    {
+        bus.write_byte(0x2000, 0x7F);
+        REQUIRE(bus.read_byte(0x4000) == 0x7F);
+        bus.write_byte(0x2000, 0x00);
+        REQUIRE(bus.read_byte(0x4000) == 0x01);
+    }
+
+    SECTION("Latch real time clock")
+    {
+        bus.write_byte(0x0000, 0x0A);
+        clock = cocoa::gb::RTC_TSTATES_PER_SECOND * 3723;
+        bus.write_byte(0x4000, 0x08);
+        REQUIRE(bus.read_byte(0xA000) == 0x00);
+
+        bus.write_byte(0x6000, 0x00);
+        bus.write_byte(0x6000, 0x01);
+        REQUIRE(bus.read_byte(0xA000) == 3);
+        bus.write_byte(0x4000, 0x09);
+        REQUIRE(bus.read_byte(0xA000) == 2);
+        bus.write_byte(0x4000, 0x0A);
+        REQUIRE(bus.read_byte(0xA000) == 1);
+
+        clock += cocoa::gb::RTC_TSTATES_PER_SECOND;
+        REQUIRE(bus.read_byte(0xA000) == 1);
+        bus.write_byte(0x4000, 0x00);
+        bus.write_byte(0xA000, 0x42);
+        REQUIRE(bus.read_byte(0xA000) == 0x42);
+    }
+
+    SECTION("Halt real time clock")
+    {
+        bus.write_byte(0x0000, 0x0A);
+        bus.write_byte(0x4000, 0x0C);
+        bus.write_byte(0xA000, 0x40);
+        clock = cocoa::gb::RTC_TSTATES_PER_SECOND * 10;
+        bus.write_byte(0x6000, 0x00);
+        bus.write_byte(0x6000, 0x01);
+        bus.write_byte(0x4000, 0x08);
+        REQUIRE(bus.read_byte(0xA000) == 0x00);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("cocoa::gb::Mapper [MBC3 without RAM]", "[mapper]")
+{
+    std::filesystem::path path = write_rom("cocoa_mapper_mbc3_timer.gb", 4, 0x0F, 0x00);
+    cocoa::gb::Cartridge cart(path);
+    cocoa::gb::MemoryBus bus {};
+    size_t clock = 0;
+    cocoa::gb::Mapper mapper(cart, bus, clock);
+    REQUIRE(mapper.type() == cocoa::gb::MbcType::Mbc3);
+    REQUIRE(mapper.ram().empty());
+
+    bus.write_byte(0x0000, 0x0A);
+    bus.write_byte(0x4000, 0x00);
+    REQUIRE(bus.read_byte(0xA000) == 0xFF);
+
+    clock = cocoa::gb::RTC_TSTATES_PER_SECOND * 3723;
+    bus.write_byte(0x6000, 0x00);
+    bus.write_byte(0x6000, 0x01);
+    bus.write_byte(0x4000, 0x08);
+    REQUIRE(bus.read_byte(0xA000) == 3);
+    bus.write_byte(0x4000, 0x0A);
+    REQUIRE(bus.read_byte(0xA000) == 1);
+
+    bus.write_byte(0x0000, 0x00);
+    REQUIRE(bus.read_byte(0xA000) == 0xFF);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("cocoa::gb::Mapper [MBC5]", "[mapper]")
+{
+    std::filesystem::path path = write_rom("cocoa_mapper_mbc5.gb", 512, 0x1B, 0x03);
+    cocoa::gb::Cartridge cart(path);
+    cocoa::gb::MemoryBus bus {};
+    size_t clock = 0;
+    cocoa::gb::Mapper mapper(cart, bus, clock);
+    REQUIRE(mapper.type() == cocoa::gb::MbcType::Mbc5);
+
+    bus.write_byte(0x2000, 0x00);
+    REQUIRE(bus.read_byte(0x4000) == 0x00);
+    bus.write_byte(0x3000, 0x01);
+    REQUIRE(bus.read_byte(0x4000) == 0x00);
+    bus.write_byte(0x2000, 0xFF);
+    REQUIRE(bus.read_byte(0x4000) == 0xFF);
+    bus.write_byte(0x3000, 0x00);
+    bus.write_byte(0x2000, 0x05);
+    REQUIRE(bus.read_byte(0x4000) == 0x05);
+
+    bus.write_byte(0x0000, 0x0A);
+    bus.write_byte(0x4000, 0x03);
+    bus.write_byte(0xA000, 0x33);
+    bus.write_byte(0x4000, 0x00);
+    REQUIRE(bus.read_byte(0xA000) == 0x00);
+    REQUIRE(mapper.ram()[3 * cocoa::gb::RAM_BANK_SIZE] == 0x33);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("void cocoa::gb::Mapper::share_state(Mapper&)", "[share_state]")
+{
+    std::filesystem::path path = write_rom("cocoa_mapper_share_state.gb", 8, 0x1B, 0x03);
+    cocoa::gb::Cartridge cart(path);
+    size_t clock = 0;
+    cocoa::gb::MemoryBus parent_bus {};
+    cocoa::gb::Mapper parent(cart, parent_bus, clock);
+    parent_bus.write_byte(0x0000, 0x0A);
+    parent_bus.write_byte(0x4000, 0x01);
+    parent_bus.write_byte(0xA000, 0x11);
+
+    cocoa::gb::MemoryBus child_bus {};
+    cocoa::gb::Mapper child(cart, child_bus, clock);
+    child.share_state(parent);
+    REQUIRE(child.ram().private_pages() == 0);
+    REQUIRE(parent.ram().private_pages() == 0);
+    REQUIRE(child_bus.read_byte(0xA000) == 0x11);
+
+    child_bus.write_byte(0xA000, 0x22);
+    child_bus.write_byte(0xA001, 0x33);
+    REQUIRE(child.ram().private_pages() == 1);
+    REQUIRE(child_bus.read_byte(0xA001) == 0x33);
+    REQUIRE(parent_bus.read_byte(0xA000) == 0x11);
+
+    parent_bus.write_byte(0xA000, 0x44);
+    REQUIRE(parent.ram().private_pages() == 1);
+    REQUIRE(parent.ram()[cocoa::gb::RAM_BANK_SIZE] == 0x44);
+    REQUIRE(child_bus.read_byte(0xA000) == 0x22);
+    std::filesystem::remove(path);
+}
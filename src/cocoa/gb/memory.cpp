@@ -1,22 +1,129 @@
 // SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
 // SPDX-License-Identifier: MIT
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
 
 #include "cocoa/gb/memory.hpp"
 #include "cocoa/utility.hpp"
 
 namespace cocoa::gb {
-uint8_t
-MemoryBus::read_byte(const uint16_t address) const
+// NOTE: The I/O page also holds HRAM and IE, which always live in plain internal memory.
+constexpr uint8_t IO_PAGE = cocoa::from_high(cocoa::from_enum(MemoryMap::IoStart));
+
+constexpr uint8_t WRAMX_PAGE = cocoa::from_high(cocoa::from_enum(MemoryMap::WramXStart));
+
+// NOTE: Backs reads of every internal page that was never written.
+static constexpr std::array<uint8_t, MEMORY_PAGE_SIZE> ZERO_PAGE = {};
+
+PagedMemory::PagedMemory(const size_t size, const uint8_t fill)
+    : m_pages(size / MEMORY_PAGE_SIZE)
+    , m_owned(size / MEMORY_PAGE_SIZE, true)
 {
-    return m_bus[address];
+    for (std::shared_ptr<Page>& page : m_pages) {
+        page = std::make_shared<Page>();
+        page->fill(fill);
+    }
+}
+
+size_t
+PagedMemory::size() const
+{
+    return m_pages.size() * MEMORY_PAGE_SIZE;
+}
+
+bool
+PagedMemory::empty() const
+{
+    return m_pages.empty();
+}
+
+const uint8_t*
+PagedMemory::page(const size_t index) const
+{
+    return m_pages[index]->data();
+}
+
+uint8_t*
+PagedMemory::writable_page(const size_t index)
+{
+    return m_owned[index] ? m_pages[index]->data() : nullptr;
+}
+
+uint8_t*
+PagedMemory::own(const size_t index)
+{
+    // NOTE: Page is copied even if every other memory dropped it already, since reading their
+    // reference counts would race with forks running on other threads.
+    std::shared_ptr<Page>& page = m_pages[index];
+    if (!m_owned[index]) {
+        page = std::make_shared<Page>(*page);
+        m_owned[index] = true;
+    }
+    return page->data();
+}
+
+void
+PagedMemory::save(uint8_t* out) const
+{
+    for (size_t index = 0; index < m_pages.size(); ++index)
+        std::memcpy(out + index * MEMORY_PAGE_SIZE, m_pages[index]->data(), MEMORY_PAGE_SIZE);
+}
+
+void
+PagedMemory::load(const uint8_t* in)
+{
+    for (size_t index = 0; index < m_pages.size(); ++index) {
+        const uint8_t* source = in + index * MEMORY_PAGE_SIZE;
+        if (std::memcmp(m_pages[index]->data(), source, MEMORY_PAGE_SIZE) != 0)
+            std::memcpy(own(index), source, MEMORY_PAGE_SIZE);
+    }
+}
+
+void
+PagedMemory::share(PagedMemory& other)
+{
+    m_pages = other.m_pages;
+    m_owned.assign(m_pages.size(), false);
+    other.m_owned.assign(other.m_pages.size(), false);
+}
+
+size_t
+PagedMemory::private_pages() const
+{
+    return static_cast<size_t>(std::count(m_owned.begin(), m_owned.end(), true));
+}
+
+MemoryBus::MemoryBus()
+    : m_read_pages {}
+    , m_write_pages {}
+    , m_read_mapped {}
+    , m_write_mapped {}
+    , m_page_handlers {}
+    , m_io_handlers {}
+    , m_memory {}
+    , m_owned {}
+    , m_wram_bank(1)
+    , m_write_internal {}
+    , m_read_only {}
+    , m_read_watches {}
+    , m_write_watches {}
+    , m_read_watched {}
+    , m_write_watched {}
+    , m_watch_handler {}
+{
+    unmap(0x0000, 0xFFFF);
 }
 
 uint16_t
 MemoryBus::read_word(const uint16_t address) const
 {
-    return from_pair(read_byte(address), read_byte(address + 1));
+    return from_pair(read_byte(address + 1), read_byte(address));
 }
 
 uint8_t
@@ -26,22 +133,367 @@ MemoryBus::read_io_reg(const IoMap reg) const
 }
 
 void
-MemoryBus::write_byte(const uint16_t address, const uint8_t value)
+MemoryBus::write_word(const uint16_t address, const uint16_t value)
 {
-    m_bus[address] = value;
+    write_byte(address, from_low(value));
+    write_byte(address + 1, from_high(value));
 }
 
 void
-MemoryBus::write_word(const uint16_t address, const uint16_t value)
+MemoryBus::write_io_reg(const IoMap reg, const uint8_t value)
+{
+    write_byte(from_enum(reg), value);
+}
+
+void
+MemoryBus::map_pages(
+    const uint16_t start, const uint16_t end, const uint8_t* read, uint8_t* write)
 {
-    write_byte(address, from_high(value));
-    write_byte(address + 1, from_low(value));
+    const size_t first = from_high(start);
+    const size_t last = from_high(end);
+    for (size_t page = first; page <= last; ++page) {
+        const size_t offset = (page - first) * MEMORY_PAGE_SIZE;
+        set_read(page, (read != nullptr) ? read + offset : nullptr);
+        set_write(page, (write != nullptr) ? write + offset : nullptr);
+        m_write_internal[page] = false;
+        m_read_only[page] = read != nullptr && write == nullptr;
+    }
 }
 
 void
-MemoryBus::write_io_reg(const IoMap reg, const uint8_t value)
+MemoryBus::map_paged(
+    const uint16_t start, const uint16_t end, PagedMemory& memory, const size_t first)
 {
-    write_byte(from_enum(reg), value);
+    const size_t first_page = from_high(start);
+    const size_t last_page = from_high(end);
+    for (size_t page = first_page; page <= last_page; ++page) {
+        set_read(page, memory.page(first + page - first_page));
+        set_write(page, memory.writable_page(first + page - first_page));
+        m_write_internal[page] = false;
+        m_read_only[page] = false;
+    }
+}
+
+void
+MemoryBus::map_handler(const uint16_t start, const uint16_t end, const MemoryHandler& handler)
+{
+    const size_t first = from_high(start);
+    const size_t last = from_high(end);
+    for (size_t page = first; page <= last; ++page) {
+        m_page_handlers[page] = handler;
+        if (handler.read != nullptr) {
+            set_read(page, nullptr);
+            m_read_only[page] = false;
+        }
+        if (handler.write != nullptr) {
+            set_write(page, nullptr);
+            m_write_internal[page] = false;
+        }
+    }
+}
+
+void
+MemoryBus::map_io_handler(const IoMap reg, const MemoryHandler& handler)
+{
+    m_io_handlers[from_low(from_enum(reg))] = handler;
+}
+
+void
+MemoryBus::unmap(const uint16_t start, const uint16_t end)
+{
+    const size_t first = from_high(start);
+    const size_t last = from_high(end);
+    for (size_t page = first; page <= last; ++page) {
+        m_page_handlers[page] = MemoryHandler {};
+        set_read(page, (page != IO_PAGE) ? internal(page) : nullptr);
+        set_write(page, nullptr);
+        m_write_internal[page] = page != IO_PAGE;
+        m_read_only[page] = false;
+        refresh_write(page);
+    }
+}
+
+void
+MemoryBus::copy(const uint16_t dest, const uint16_t source, const size_t size)
+{
+    for (size_t done = 0; done < size;) {
+        const auto from = static_cast<uint16_t>(source + done);
+        const auto to = static_cast<uint16_t>(dest + done);
+        const size_t span = std::min({ size - done, MEMORY_PAGE_SIZE - from_low(from),
+            MEMORY_PAGE_SIZE - from_low(to) });
+
+        // NOTE: Internal page not yet owned has no write entry, but owning it keeps it fast.
+        const uint8_t* read = m_read_pages[from_high(from)];
+        uint8_t* write = m_write_pages[from_high(to)];
+        if (write == nullptr && m_write_internal[from_high(to)] && !m_write_watched[from_high(to)])
+            write = own(from_high(to));
+
+        if (read != nullptr && write != nullptr) {
+            std::memmove(write + from_low(to), read + from_low(from), span);
+        } else {
+            for (size_t i = 0; i < span; ++i) {
+                const uint8_t value = read_byte(static_cast<uint16_t>(from + i));
+                write_byte(static_cast<uint16_t>(to + i), value);
+            }
+        }
+        done += span;
+    }
+}
+
+uint8_t
+MemoryBus::peek(const uint16_t address) const
+{
+    return internal(from_high(address))[from_low(address)];
+}
+
+void
+MemoryBus::poke(const uint16_t address, const uint8_t value)
+{
+    own(from_high(address))[from_low(address)] = value;
+}
+
+void
+MemoryBus::switch_wram_bank(const uint8_t bank)
+{
+    const uint8_t next = std::max(static_cast<uint8_t>(bank & 0x07), uint8_t(1));
+    if (next == m_wram_bank)
+        return;
+
+    std::array<const uint8_t*, WRAM_BANK_PAGES> previous = {};
+    for (size_t i = 0; i < WRAM_BANK_PAGES; ++i)
+        previous[i] = internal(WRAMX_PAGE + i);
+
+    m_wram_bank = next;
+    for (size_t i = 0; i < WRAM_BANK_PAGES; ++i) {
+        const size_t page = WRAMX_PAGE + i;
+        if (m_read_mapped[page] == previous[i])
+            set_read(page, internal(page));
+        if (m_write_internal[page]) {
+            set_write(page, nullptr);
+            refresh_write(page);
+        }
+    }
+}
+
+uint8_t
+MemoryBus::wram_bank() const
+{
+    return m_wram_bank;
+}
+
+void
+MemoryBus::save_memory(uint8_t* out) const
+{
+    for (size_t slot = 0; slot < MEMORY_SLOT_COUNT; ++slot)
+        std::memcpy(out + slot * MEMORY_PAGE_SIZE, stored(slot), MEMORY_PAGE_SIZE);
+}
+
+void
+MemoryBus::load_memory(const uint8_t* in)
+{
+    for (size_t slot = 0; slot < MEMORY_SLOT_COUNT; ++slot) {
+        const uint8_t* source = in + slot * MEMORY_PAGE_SIZE;
+        if (std::memcmp(stored(slot), source, MEMORY_PAGE_SIZE) != 0)
+            std::memcpy(own_slot(slot), source, MEMORY_PAGE_SIZE);
+    }
+}
+
+void
+MemoryBus::share_memory(MemoryBus& other)
+{
+    std::array<const uint8_t*, MEMORY_PAGE_COUNT> previous = {};
+    for (size_t page = 0; page < MEMORY_PAGE_COUNT; ++page)
+        previous[page] = internal(page);
+
+    m_memory = other.m_memory;
+    m_owned = {};
+    other.m_owned = {};
+    for (size_t page = 0; page < MEMORY_PAGE_COUNT; ++page) {
+        if (m_read_mapped[page] == previous[page])
+            set_read(page, internal(page));
+        if (m_write_internal[page])
+            set_write(page, nullptr);
+        if (other.m_write_internal[page])
+            other.set_write(page, nullptr);
+    }
+}
+
+size_t
+MemoryBus::private_pages() const
+{
+    return static_cast<size_t>(std::count(m_owned.begin(), m_owned.end(), true));
+}
+
+void
+MemoryBus::watch(const uint16_t address, const WatchKind kind)
+{
+    if (kind == WatchKind::Read)
+        m_read_watches.set(address);
+    else
+        m_write_watches.set(address);
+    refresh_watch(from_high(address));
+}
+
+void
+MemoryBus::unwatch(const uint16_t address, const WatchKind kind)
+{
+    if (kind == WatchKind::Read)
+        m_read_watches.reset(address);
+    else
+        m_write_watches.reset(address);
+    refresh_watch(from_high(address));
+}
+
+void
+MemoryBus::clear_watches()
+{
+    m_read_watches.reset();
+    m_write_watches.reset();
+    for (size_t page = 0; page < MEMORY_PAGE_COUNT; ++page)
+        refresh_watch(page);
+}
+
+bool
+MemoryBus::is_watched(const uint16_t address, const WatchKind kind) const
+{
+    return (kind == WatchKind::Read) ? m_read_watches[address] : m_write_watches[address];
+}
+
+void
+MemoryBus::set_watch_handler(const WatchHandler& handler)
+{
+    m_watch_handler = handler;
+}
+
+uint8_t
+MemoryBus::read_slow(const uint16_t address) const
+{
+    const uint8_t page = from_high(address);
+    const MemoryHandler& handler
+        = (page == IO_PAGE) ? m_io_handlers[from_low(address)] : m_page_handlers[page];
+    uint8_t value = 0;
+    if (m_read_mapped[page] != nullptr)
+        value = m_read_mapped[page][from_low(address)];
+    else if (handler.read != nullptr)
+        value = handler.read(handler.context, address);
+    else
+        value = peek(address);
+
+    if (m_read_watches[address] && m_watch_handler.hit != nullptr)
+        m_watch_handler.hit(m_watch_handler.context, address, value, WatchKind::Read);
+    return value;
 }
 
+void
+MemoryBus::write_slow(const uint16_t address, const uint8_t value)
+{
+    const uint8_t page = from_high(address);
+    const MemoryHandler& handler
+        = (page == IO_PAGE) ? m_io_handlers[from_low(address)] : m_page_handlers[page];
+    if (m_write_mapped[page] != nullptr)
+        m_write_mapped[page][from_low(address)] = value;
+    else if (handler.write != nullptr)
+        handler.write(handler.context, address, value);
+    else
+        poke(address, value);
+
+    if (m_write_watches[address] && m_watch_handler.hit != nullptr)
+        m_watch_handler.hit(m_watch_handler.context, address, value, WatchKind::Write);
+}
+
+size_t
+MemoryBus::slot(const size_t page) const
+{
+    if (m_wram_bank == 1 || page < WRAMX_PAGE || page >= WRAMX_PAGE + WRAM_BANK_PAGES)
+        return page;
+    return MEMORY_PAGE_COUNT + (m_wram_bank - size_t(2)) * WRAM_BANK_PAGES + (page - WRAMX_PAGE);
+}
+
+size_t
+MemoryBus::page_of(const size_t slot) const
+{
+    const bool is_wramx = slot >= WRAMX_PAGE && slot < WRAMX_PAGE + WRAM_BANK_PAGES;
+    if (slot < MEMORY_PAGE_COUNT)
+        return (is_wramx && m_wram_bank != 1) ? MEMORY_PAGE_COUNT : slot;
+
+    const size_t bank = (slot - MEMORY_PAGE_COUNT) / WRAM_BANK_PAGES + 2;
+    const size_t offset = (slot - MEMORY_PAGE_COUNT) % WRAM_BANK_PAGES;
+    return (bank == m_wram_bank) ? WRAMX_PAGE + offset : MEMORY_PAGE_COUNT;
+}
+
+const uint8_t*
+MemoryBus::internal(const size_t page) const
+{
+    return stored(slot(page));
+}
+
+const uint8_t*
+MemoryBus::stored(const size_t slot) const
+{
+    return m_memory[slot] ? m_memory[slot]->data() : ZERO_PAGE.data();
+}
+
+uint8_t*
+MemoryBus::own(const size_t page)
+{
+    return own_slot(slot(page));
+}
+
+uint8_t*
+MemoryBus::own_slot(const size_t slot)
+{
+    // NOTE: Slot is copied even if every other bus dropped it already, since reading their
+    // reference counts would race with forks running on other threads.
+    std::shared_ptr<Page>& memory = m_memory[slot];
+    const size_t page = page_of(slot);
+    if (!m_owned[slot]) {
+        const uint8_t* previous = stored(slot);
+        memory = memory ? std::make_shared<Page>(*memory) : std::make_shared<Page>();
+        m_owned[slot] = true;
+        if (page != MEMORY_PAGE_COUNT && m_read_mapped[page] == previous)
+            set_read(page, memory->data());
+    }
+
+    if (page != MEMORY_PAGE_COUNT)
+        refresh_write(page);
+    return memory->data();
+}
+
+void
+MemoryBus::refresh_write(const size_t page)
+{
+    const size_t index = slot(page);
+    if (m_write_internal[page] && m_owned[index])
+        set_write(page, m_memory[index]->data());
+}
+
+void
+MemoryBus::set_read(const size_t page, const uint8_t* read)
+{
+    m_read_mapped[page] = read;
+    m_read_pages[page] = m_read_watched[page] ? nullptr : read;
+}
+
+void
+MemoryBus::set_write(const size_t page, uint8_t* write)
+{
+    m_write_mapped[page] = write;
+    m_write_pages[page] = m_write_watched[page] ? nullptr : write;
+}
+
+void
+MemoryBus::refresh_watch(const size_t page)
+{
+    bool read = false;
+    bool write = false;
+    for (size_t offset = 0; offset < MEMORY_PAGE_SIZE; ++offset) {
+        read = read || m_read_watches[page * MEMORY_PAGE_SIZE + offset];
+        write = write || m_write_watches[page * MEMORY_PAGE_SIZE + offset];
+    }
+
+    m_read_watched[page] = read;
+    m_write_watched[page] = write;
+    set_read(page, m_read_mapped[page]);
+    set_write(page, m_write_mapped[page]);
+}
 } // namespace cocoa::gb
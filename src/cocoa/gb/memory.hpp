@@ -5,13 +5,31 @@
 #define COCOA_GB_MEMORY_HPP
 
 #include <array>
+#include <bitset>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <memory>
 #include <type_traits>
+#include <vector>
+
+#include "cocoa/utility.hpp"
 
 namespace cocoa::gb {
-constexpr size_t MEMORY_BUS_SIZE = 65535;
+/// @brief Amount of bytes covered by one entry of memory bus page table.
+constexpr size_t MEMORY_PAGE_SIZE = 256;
+
+/// @brief Amount of entries in memory bus page table, one per high byte of an address.
+constexpr size_t MEMORY_PAGE_COUNT = 256;
+
+/// @brief Amount of addresses on memory bus, i.e., every value of a 16-bit address.
+constexpr size_t MEMORY_BUS_SIZE = MEMORY_PAGE_COUNT * MEMORY_PAGE_SIZE;
+
+// INVARIANT: High and low byte of any address index page table and page in range, so neither
+// access needs a bounds check, and checked builds can prove theirs away.
+static_assert(MEMORY_BUS_SIZE == size_t(std::numeric_limits<uint16_t>::max()) + 1);
+static_assert(MEMORY_PAGE_COUNT == size_t(std::numeric_limits<uint8_t>::max()) + 1);
+static_assert(MEMORY_PAGE_SIZE == size_t(std::numeric_limits<uint8_t>::max()) + 1);
 
 /// @brief GameBoy memory map ranges.
 ///
@@ -148,6 +166,15 @@ enum class IoMap : uint16_t {
     /// Background viewport X position register.
     SCX = 0xFF43,
 
+    /// LCD Y coordinate register (read-only).
+    LY = 0xFF44,
+
+    /// LY compare register.
+    LYC = 0xFF45,
+
+    /// OAM DMA source address & start register.
+    DMA = 0xFF46,
+
     /// Window Y position register.
     WY = 0xFF4A,
 
@@ -157,6 +184,12 @@ enum class IoMap : uint16_t {
     /// BG palette data register.
     BGP = 0xFF47,
 
+    /// Object palette 0 data register.
+    OBP0 = 0xFF48,
+
+    /// Object palette 1 data register.
+    OBP1 = 0xFF49,
+
     /// Background color palette index register.
     BCPI = 0xFF68,
 
@@ -206,6 +239,143 @@ enum class InterruptVector : uint16_t {
     Joypad = 0x0060,
 };
 
+/// @brief Amount of switchable WRAM banks of CGB, which take turns at `WramXStart..WramXEnd`.
+constexpr size_t WRAM_BANK_COUNT = 7;
+
+/// @brief Amount of pages in one WRAM bank.
+constexpr size_t WRAM_BANK_PAGES = 0x1000 / MEMORY_PAGE_SIZE;
+
+/// @brief Amount of pages of internal memory, i.e., one per page table entry, plus those of WRAM
+///        banks 2 to 7, which bank 1 hides unless switched in.
+constexpr size_t MEMORY_SLOT_COUNT = MEMORY_PAGE_COUNT + (WRAM_BANK_COUNT - 1) * WRAM_BANK_PAGES;
+
+/// @brief Callbacks servicing memory accesses that cannot be done through direct host pointers.
+///
+/// Used for I/O registers, OAM, and MBC controlled ranges, i.e., anything with side effects. Either
+/// callback can be left null, which makes that kind of access use plain memory instead.
+struct MemoryHandler final {
+    uint8_t (*read)(void* context, uint16_t address) = nullptr;
+    void (*write)(void* context, uint16_t address, uint8_t value) = nullptr;
+    void* context = nullptr;
+};
+
+/// @brief Kinds of memory access that a watchpoint can trigger on.
+enum class WatchKind : uint8_t {
+    Read,
+    Write,
+};
+
+/// @brief Callback notified of every access to a watched address.
+///
+/// Called once access has completed, with the value that was read or written.
+struct WatchHandler final {
+    void (*hit)(void* context, uint16_t address, uint8_t value, WatchKind kind) = nullptr;
+    void* context = nullptr;
+};
+
+/// @brief Host memory of a peripheral, split into pages shared copy-on-write between forks.
+///
+/// Meant for memory that peripherals map into the bus themselves, e.g., VRAM and external RAM.
+/// Pages are shared by reference until one owner writes to them, exactly like internal memory of
+/// the bus, so a fork costs one reference per page, and afterwards only the pages it dirties.
+/// Ownership is tracked per page rather than read off reference counts, so forks running on other
+/// threads never race with their parent over whether a page is shared.
+///
+/// @see `MemoryBus::map_paged()`
+class PagedMemory final {
+public:
+    /// @brief Allocate memory with every byte set to fill value.
+    ///
+    /// @pre Size must be a multiple of `MEMORY_PAGE_SIZE`.
+    ///
+    /// @param [in] size Size in bytes.
+    /// @param [in] fill Initial value of every byte.
+    PagedMemory(const size_t size, const uint8_t fill);
+
+    PagedMemory(const PagedMemory&) = delete;
+
+    PagedMemory&
+    operator=(const PagedMemory&) = delete;
+
+    ~PagedMemory() noexcept = default;
+
+    [[nodiscard]]
+    inline uint8_t
+    operator[](const size_t offset) const;
+
+    /// @brief Write byte, copying its page first if it is shared.
+    inline void
+    write(const size_t offset, const uint8_t value);
+
+    /// @brief Get size in bytes.
+    [[nodiscard]]
+    size_t
+    size() const;
+
+    [[nodiscard]]
+    bool
+    empty() const;
+
+    /// @brief Get host memory of page for reads.
+    [[nodiscard]]
+    const uint8_t*
+    page(const size_t index) const;
+
+    /// @brief Get host memory of page for writes if this memory owns it.
+    ///
+    /// @return Host memory of page, or null if page was shared and not yet copied.
+    [[nodiscard]]
+    uint8_t*
+    writable_page(const size_t index);
+
+    /// @brief Make page writable by this memory alone, copying it unless already owned.
+    ///
+    /// @return Writable host memory of page.
+    uint8_t*
+    own(const size_t index);
+
+    /// @brief Copy contents out as one contiguous block.
+    ///
+    /// @param [out] out Buffer of `size()` bytes.
+    void
+    save(uint8_t* out) const;
+
+    /// @brief Replace contents with contiguous block.
+    ///
+    /// Pages whose contents do not change are left alone, so they stay shared with forks.
+    ///
+    /// @param [in] in Buffer of `size()` bytes.
+    void
+    load(const uint8_t* in);
+
+    /// @brief Share pages of other memory copy-on-write.
+    ///
+    /// Neither memory owns any page afterwards, so each copies a page on its first write to it,
+    /// even once the other memory is gone.
+    ///
+    /// @note Owners of both memories must map their pages again afterwards, since pages they
+    ///       mapped for writes are shared now.
+    ///
+    /// @pre Other memory has the same size.
+    ///
+    /// @param [in,out] other Memory to share pages with.
+    void
+    share(PagedMemory& other);
+
+    /// @brief Get amount of pages owned by this memory, i.e., written since sharing.
+    [[nodiscard]]
+    size_t
+    private_pages() const;
+
+private:
+    using Page = std::array<uint8_t, MEMORY_PAGE_SIZE>;
+
+    std::vector<std::shared_ptr<Page>> m_pages;
+
+    /// Pages this memory allocated or copied itself, which no other memory references.
+    std::vector<bool> m_owned;
+};
+
 /// @brief GameBoy memory bus.
 ///
 /// The GameBoy uses a 16-bit address bus with an 8-bit data bus, resulting in a 64 KiB memory bus.
@@ -214,17 +384,46 @@ enum class InterruptVector : uint16_t {
 /// implementations of the GameBoy hardware for data transmission and communication with each other
 /// much like how the original hardware does.
 ///
+/// Addresses are decoded through a 256 entry page table keyed by the high byte of an address. Each
+/// page either holds a direct host pointer, which makes an access one load of the page entry plus
+/// one indexed load, or a null pointer, which routes the access to a registered `MemoryHandler`.
+/// Banking is done by repointing page entries, never by copying memory.
+///
+/// CGB WRAM banks are internal memory too. Pages of every bank besides bank 1 live past the 256
+/// pages of the bus, and switching banks only repoints the 16 page entries of `WramXStart` to
+/// `WramXEnd`.
+///
+/// By default every page is backed by plain internal memory, except the I/O page, which always
+/// routes through handlers so peripherals can be attached to individual I/O registers.
+///
+/// Internal memory is allocated page by page on first write, and shared copy-on-write between a
+/// bus and its forks. Reads of a shared page stay on the fast path, while its write entry is left
+/// null, so the first write to it takes the slow path once to copy the page and repoint it. A
+/// fork thus costs a page table copy plus one reference per page, and afterwards only the pages
+/// it dirties.
+///
+/// Watched addresses are found through one watch bit per page and kind of access. Entries of
+/// pages holding a watched address are left null, so accesses to them take the slow path, which
+/// checks the address against a bitmap of watched addresses. Accesses to every other page stay
+/// exactly as fast as without any watch.
+///
 /// @see https://gbdev.io/pandocs/Memory_Map.html
 class MemoryBus final {
 public:
-    MemoryBus() = default;
+    MemoryBus();
+
+    MemoryBus(const MemoryBus&) = delete;
+
+    MemoryBus&
+    operator=(const MemoryBus&) = delete;
 
     ~MemoryBus() noexcept = default;
 
     [[nodiscard]]
-    uint8_t
+    inline uint8_t
     read_byte(const uint16_t address) const;
 
+    /// @brief Read little-endian word.
     [[nodiscard]]
     uint16_t
     read_word(const uint16_t address) const;
@@ -233,18 +432,335 @@ class MemoryBus final {
     uint8_t
     read_io_reg(const IoMap reg) const;
 
-    void
+    inline void
     write_byte(const uint16_t address, const uint8_t value);
 
+    /// @brief Write little-endian word.
     void
     write_word(const uint16_t address, const uint16_t value);
 
     void
     write_io_reg(const IoMap reg, const uint8_t value);
 
+    /// @brief Map range of pages directly to host memory.
+    ///
+    /// Page _n_ of range is pointed at `base + n * MEMORY_PAGE_SIZE`. A null pointer routes that
+    /// kind of access to the handler of each page instead.
+    ///
+    /// Memory mapped for reads but not for writes is read-only, e.g., cartridge ROM. CPU caches
+    /// code decoded from read-only memory, so its contents must never change while mapped.
+    ///
+    /// @pre Range must be page aligned.
+    ///
+    /// @param [in] start First address of range.
+    /// @param [in] end Last address of range.
+    /// @param [in] read Base of host memory used for reads.
+    /// @param [in] write Base of host memory used for writes.
+    void
+    map_pages(const uint16_t start, const uint16_t end, const uint8_t* read, uint8_t* write);
+
+    /// @brief Map range of pages to pages of copy-on-write memory.
+    ///
+    /// Page _n_ of range is pointed at page `first + n` of memory. Unlike `map_pages()`, pages
+    /// still shared with a fork are not read-only. Their write entry is left null, so the first
+    /// write to each goes to the handler of that page, which copies it through
+    /// `PagedMemory::own()` and maps it again.
+    ///
+    /// @pre Range must be page aligned, and memory must hold every page of it past `first`.
+    ///
+    /// @param [in] start First address of range.
+    /// @param [in] end Last address of range.
+    /// @param [in] memory Memory to map.
+    /// @param [in] first Page of memory shown at start of range.
+    void
+    map_paged(const uint16_t start, const uint16_t end, PagedMemory& memory, const size_t first);
+
+    /// @brief Route accesses of range of pages to handler.
+    ///
+    /// Direct pointers are dropped for whichever kind of access the handler services.
+    ///
+    /// @pre Range must be page aligned.
+    ///
+    /// @param [in] start First address of range.
+    /// @param [in] end Last address of range.
+    /// @param [in] handler Callbacks servicing range.
+    void
+    map_handler(const uint16_t start, const uint16_t end, const MemoryHandler& handler);
+
+    /// @brief Route accesses of I/O register to handler.
+    ///
+    /// @param [in] reg I/O register to service.
+    /// @param [in] handler Callbacks servicing I/O register.
+    void
+    map_io_handler(const IoMap reg, const MemoryHandler& handler);
+
+    /// @brief Restore range of pages back to plain internal memory.
+    ///
+    /// @pre Range must be page aligned.
+    ///
+    /// @param [in] start First address of range.
+    /// @param [in] end Last address of range.
+    void
+    unmap(const uint16_t start, const uint16_t end);
+
+    /// @brief Copy block of memory exactly like byte-wise reads and writes would, but in bulk.
+    ///
+    /// Spans whose source and destination pages both have fast path entries are copied straight
+    /// between host memory. Only spans touching handlers or watched pages go byte by byte through
+    /// slow path. Addresses wrap around at end of bus.
+    ///
+    /// @note Meant for DMA, which moves whole blocks between plain memory nearly every time.
+    ///
+    /// @param [in] dest First address to write.
+    /// @param [in] source First address to read.
+    /// @param [in] size Amount of bytes to copy.
+    void
+    copy(const uint16_t dest, const uint16_t source, const size_t size);
+
+    /// @brief Read plain internal memory, bypassing page table and handlers.
+    ///
+    /// @note Meant for handlers that keep their register state inside the bus.
+    [[nodiscard]]
+    uint8_t
+    peek(const uint16_t address) const;
+
+    /// @brief Write plain internal memory, bypassing page table and handlers.
+    ///
+    /// @note Meant for handlers that keep their register state inside the bus.
+    void
+    poke(const uint16_t address, const uint8_t value);
+
+    /// @brief Show WRAM bank at `WramXStart` to `WramXEnd`, like SVBK does on CGB.
+    ///
+    /// Costs one repoint per page of bank, since memory of every bank stays where it is. Mapped
+    /// pages and handlers of that range are kept.
+    ///
+    /// @param [in] bank WRAM bank from 1 to 7 in its low three bits, where 0 selects bank 1.
+    void
+    switch_wram_bank(const uint8_t bank);
+
+    /// @brief Get WRAM bank shown at `WramXStart` to `WramXEnd`.
+    [[nodiscard]]
+    uint8_t
+    wram_bank() const;
+
+    /// @brief Copy plain internal memory out as one contiguous block.
+    ///
+    /// Every page of bus comes first, showing WRAM bank 1, followed by WRAM banks 2 to 7.
+    ///
+    /// Page table is not part of it, because owners of mapped memory rebuild their mappings.
+    ///
+    /// @note Meant for save states.
+    ///
+    /// @param [out] out Buffer of `size()` bytes.
+    void
+    save_memory(uint8_t* out) const;
+
+    /// @brief Replace plain internal memory with contiguous block.
+    ///
+    /// Pages whose contents do not change are left alone, so they stay shared with forks.
+    ///
+    /// @param [in] in Buffer of `size()` bytes.
+    void
+    load_memory(const uint8_t* in);
+
+    /// @brief Share plain internal memory of other bus copy-on-write.
+    ///
+    /// Page table of this bus is kept, apart from entries pointing at internal memory. Either bus
+    /// copies a shared page the first time it writes to it.
+    ///
+    /// @note Not thread-safe with respect to other bus, since its write entries are reset. Fork
+    ///       from one thread, then run forks on as many threads as needed.
+    ///
+    /// @param [in,out] other Bus to share internal memory with.
+    void
+    share_memory(MemoryBus& other);
+
+    /// @brief Get amount of internal pages owned by this bus, i.e., written since sharing.
+    [[nodiscard]]
+    size_t
+    private_pages() const;
+
+    /// @brief Watch address for given kind of access.
+    ///
+    /// @note Instruction fetches are reads too, so a read watch on code triggers on execution.
+    ///
+    /// @param [in] address Address to watch.
+    /// @param [in] kind Kind of access to watch for.
+    void
+    watch(const uint16_t address, const WatchKind kind);
+
+    /// @brief Stop watching address for given kind of access.
+    ///
+    /// @param [in] address Address to stop watching.
+    /// @param [in] kind Kind of access to stop watching for.
+    void
+    unwatch(const uint16_t address, const WatchKind kind);
+
+    /// @brief Stop watching every address.
+    void
+    clear_watches();
+
+    /// @brief Check if address is watched for given kind of access.
+    [[nodiscard]]
+    bool
+    is_watched(const uint16_t address, const WatchKind kind) const;
+
+    /// @brief Set callback notified of accesses to watched addresses.
+    ///
+    /// @param [in] handler Callback to notify, or empty handler to notify nobody.
+    void
+    set_watch_handler(const WatchHandler& handler);
+
+    /// @brief Get host memory of page if it is mapped read-only and unwatched.
+    ///
+    /// @return Host memory of page, or null if page is writable, routed to a handler, or read
+    ///         through slow path.
+    [[nodiscard]]
+    inline const uint8_t*
+    read_only_page(const uint8_t page) const;
+
+    /// @brief Get size of plain internal memory in bytes.
+    [[nodiscard]]
+    static constexpr size_t
+    size()
+    {
+        return MEMORY_SLOT_COUNT * MEMORY_PAGE_SIZE;
+    }
+
 private:
-    std::array<uint8_t, MEMORY_BUS_SIZE> m_bus;
+    [[nodiscard]]
+    uint8_t
+    read_slow(const uint16_t address) const;
+
+    void
+    write_slow(const uint16_t address, const uint8_t value);
+
+    using Page = std::array<uint8_t, MEMORY_PAGE_SIZE>;
+
+    /// @brief Get slot of internal memory that page currently shows.
+    [[nodiscard]]
+    size_t
+    slot(const size_t page) const;
+
+    /// @brief Get page that currently shows slot of internal memory.
+    ///
+    /// @return Page showing slot, or `MEMORY_PAGE_COUNT` if its WRAM bank is switched out.
+    [[nodiscard]]
+    size_t
+    page_of(const size_t slot) const;
+
+    /// @brief Get internal memory of page, which reads as zero until first written.
+    [[nodiscard]]
+    const uint8_t*
+    internal(const size_t page) const;
+
+    /// @brief Get internal memory of slot, which reads as zero until first written.
+    [[nodiscard]]
+    const uint8_t*
+    stored(const size_t slot) const;
+
+    /// @brief Make internal memory of page writable by this bus alone.
+    ///
+    /// @return Writable internal memory of page.
+    uint8_t*
+    own(const size_t page);
+
+    /// @brief Make internal memory of slot writable by this bus alone.
+    ///
+    /// Allocates slot on first write, or copies it if not owned yet, then repoints page table
+    /// entries that pointed at its previous memory.
+    ///
+    /// @return Writable internal memory of slot.
+    uint8_t*
+    own_slot(const size_t slot);
+
+    /// @brief Point write entry of page at internal memory if it is mapped there and owned.
+    void
+    refresh_write(const size_t page);
+
+    /// @brief Set where reads of page go, keeping its fast path entry null while it is watched.
+    void
+    set_read(const size_t page, const uint8_t* read);
+
+    /// @brief Set where writes of page go, keeping its fast path entry null while it is watched.
+    void
+    set_write(const size_t page, uint8_t* write);
+
+    /// @brief Recompute watch bit of page, and update its fast path entries to match.
+    void
+    refresh_watch(const size_t page);
+
+    /// Entries used by fast path, which equal mapped entries apart from watched pages.
+    std::array<const uint8_t*, MEMORY_PAGE_COUNT> m_read_pages;
+    std::array<uint8_t*, MEMORY_PAGE_COUNT> m_write_pages;
+
+    /// Host memory that each page is mapped to, if any.
+    std::array<const uint8_t*, MEMORY_PAGE_COUNT> m_read_mapped;
+    std::array<uint8_t*, MEMORY_PAGE_COUNT> m_write_mapped;
+
+    std::array<MemoryHandler, MEMORY_PAGE_COUNT> m_page_handlers;
+    std::array<MemoryHandler, MEMORY_PAGE_SIZE> m_io_handlers;
+    std::array<std::shared_ptr<Page>, MEMORY_SLOT_COUNT> m_memory;
+
+    /// Slots this bus allocated or copied itself, which no other bus references.
+    std::array<bool, MEMORY_SLOT_COUNT> m_owned;
+
+    /// WRAM bank shown at `WramXStart` to `WramXEnd`, from 1 to 7.
+    uint8_t m_wram_bank;
+
+    /// Pages whose writes go to internal memory, whether or not their write entry is set yet.
+    std::array<bool, MEMORY_PAGE_COUNT> m_write_internal;
+
+    /// Pages mapped for reads but not for writes.
+    std::array<bool, MEMORY_PAGE_COUNT> m_read_only;
+
+    std::bitset<MEMORY_BUS_SIZE> m_read_watches;
+    std::bitset<MEMORY_BUS_SIZE> m_write_watches;
+
+    /// Pages holding at least one watched address, per kind of access.
+    std::bitset<MEMORY_PAGE_COUNT> m_read_watched;
+    std::bitset<MEMORY_PAGE_COUNT> m_write_watched;
+
+    WatchHandler m_watch_handler;
 };
+
+inline uint8_t
+PagedMemory::operator[](const size_t offset) const
+{
+    return (*m_pages[offset / MEMORY_PAGE_SIZE])[offset % MEMORY_PAGE_SIZE];
+}
+
+inline void
+PagedMemory::write(const size_t offset, const uint8_t value)
+{
+    own(offset / MEMORY_PAGE_SIZE)[offset % MEMORY_PAGE_SIZE] = value;
+}
+
+inline uint8_t
+MemoryBus::read_byte(const uint16_t address) const
+{
+    const uint8_t* page = m_read_pages[from_high(address)];
+    if (page != nullptr)
+        return page[from_low(address)];
+    return read_slow(address);
+}
+
+inline const uint8_t*
+MemoryBus::read_only_page(const uint8_t page) const
+{
+    return m_read_only[page] ? m_read_pages[page] : nullptr;
+}
+
+inline void
+MemoryBus::write_byte(const uint16_t address, const uint8_t value)
+{
+    uint8_t* page = m_write_pages[from_high(address)];
+    if (page != nullptr)
+        page[from_low(address)] = value;
+    else
+        write_slow(address, value);
+}
 } // namespace cocoa::gb
 
 #endif // COOCA_GB_MEMORY_HPP
@@ -0,0 +1,432 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "cocoa/gb/memory.hpp"
+
+struct Recorder final {
+    uint16_t address = 0;
+    uint8_t value = 0;
+    int writes = 0;
+};
+
+static uint8_t
+read_recorder(void* context, uint16_t address)
+{
+    return static_cast<uint8_t>(static_cast<Recorder*>(context)->value + (address & 0x0F));
+}
+
+static void
+write_recorder(void* context, uint16_t address, uint8_t value)
+{
+    Recorder* recorder = static_cast<Recorder*>(context);
+    recorder->address = address;
+    recorder->value = value;
+    ++recorder->writes;
+}
+
+/// @brief Peripheral owning paged memory mapped at `SramStart..SramEnd`.
+struct PagedDevice final {
+    cocoa::gb::MemoryBus& bus;
+    cocoa::gb::PagedMemory memory;
+};
+
+static void
+write_paged(void* context, uint16_t address, uint8_t value)
+{
+    PagedDevice* device = static_cast<PagedDevice*>(context);
+    device->memory.write(address - size_t(0xA000), value);
+    device->bus.map_paged(0xA000, 0xBFFF, device->memory, 0);
+}
+
+struct WatchLog final {
+    std::vector<uint16_t> addresses;
+    std::vector<uint8_t> values;
+    std::vector<cocoa::gb::WatchKind> kinds;
+};
+
+static void
+log_watch(void* context, uint16_t address, uint8_t value, cocoa::gb::WatchKind kind)
+{
+    WatchLog* log = static_cast<WatchLog*>(context);
+    log->addresses.push_back(address);
+    log->values.push_back(value);
+    log->kinds.push_back(kind);
+}
+
+TEST_CASE("uint16_t cocoa::gb::MemoryBus::read_word(const uint16_t)", "[read_word]")
+{
+    cocoa::gb::MemoryBus bus;
+    bus.write_byte(0xC000, 0xEF);
+    bus.write_byte(0xC001, 0xBE);
+    REQUIRE(bus.read_word(0xC000) == 0xBEEF);
+
+    bus.write_word(0xC002, 0x1234);
+    REQUIRE(bus.read_byte(0xC002) == 0x34);
+    REQUIRE(bus.read_byte(0xC003) == 0x12);
+}
+
+TEST_CASE("uint8_t cocoa::gb::MemoryBus::read_io_reg(const IoMap) const", "[read_io_reg]")
+{
+    WatchLog log;
+    cocoa::gb::MemoryBus bus;
+    bus.set_watch_handler({ log_watch, &log });
+    bus.watch(0xFFFF, cocoa::gb::WatchKind::Write);
+
+    // NOTE: IE sits at last address of bus, which is backed like any other.
+    bus.write_io_reg(cocoa::gb::IoMap::IE, 0x1F);
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::IE) == 0x1F);
+    REQUIRE(bus.peek(0xFFFF) == 0x1F);
+    REQUIRE(log.addresses == std::vector<uint16_t> { 0xFFFF });
+
+    bus.write_byte(0x0000, 0x12);
+    REQUIRE(bus.read_word(0xFFFF) == 0x121F);
+}
+
+TEST_CASE("void cocoa::gb::MemoryBus::map_pages(...)", "[map_pages]")
+{
+    std::array<uint8_t, 0x8000> banks {};
+    banks[0x0000] = 0x11;
+    banks[0x4000] = 0x22;
+
+    cocoa::gb::MemoryBus bus;
+    bus.map_pages(0x4000, 0x7FFF, banks.data(), nullptr);
+    REQUIRE(bus.read_byte(0x4000) == 0x11);
+
+    bus.map_pages(0x4000, 0x7FFF, banks.data() + 0x4000, nullptr);
+    REQUIRE(bus.read_byte(0x4000) == 0x22);
+    REQUIRE(bus.read_only_page(0x40) == banks.data() + 0x4000);
+    REQUIRE(bus.read_only_page(0x00) == nullptr);
+
+    // INVARIANT: Writes to read-only pages without handler land in internal memory.
+    bus.write_byte(0x4000, 0x33);
+    REQUIRE(bus.read_byte(0x4000) == 0x22);
+    REQUIRE(bus.peek(0x4000) == 0x33);
+
+    bus.unmap(0x4000, 0x7FFF);
+    REQUIRE(bus.read_byte(0x4000) == 0x33);
+    REQUIRE(bus.read_only_page(0x40) == nullptr);
+}
+
+TEST_CASE("void cocoa::gb::MemoryBus::map_handler(...)", "[map_handler]")
+{
+    Recorder recorder;
+    cocoa::gb::MemoryBus bus;
+    bus.map_handler(0x2000, 0x3FFF, { nullptr, write_recorder, &recorder });
+
+    bus.write_byte(0x0100, 0x42);
+    bus.write_byte(0x2100, 0x05);
+    REQUIRE(recorder.writes == 1);
+    REQUIRE(recorder.address == 0x2100);
+    REQUIRE(recorder.value == 0x05);
+    REQUIRE(bus.read_byte(0x0100) == 0x42);
+}
+
+TEST_CASE("void cocoa::gb::MemoryBus::map_io_handler(...)", "[map_io_handler]")
+{
+    Recorder recorder;
+    recorder.value = 0x40;
+
+    cocoa::gb::MemoryBus bus;
+    bus.map_io_handler(cocoa::gb::IoMap::TIMA, { read_recorder, nullptr, &recorder });
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::TIMA) == 0x45);
+
+    bus.write_io_reg(cocoa::gb::IoMap::TIMA, 0x10);
+    REQUIRE(bus.peek(0xFF05) == 0x10);
+
+    bus.write_byte(0xFF80, 0x24);
+    REQUIRE(bus.read_byte(0xFF80) == 0x24);
+}
+
+TEST_CASE("void cocoa::gb::MemoryBus::map_paged(...)", "[map_paged]")
+{
+    cocoa::gb::MemoryBus parent;
+    PagedDevice parent_device { parent, cocoa::gb::PagedMemory(0x2000, 0xFF) };
+    parent.map_handler(0xA000, 0xBFFF, { nullptr, write_paged, &parent_device });
+    parent.map_paged(0xA000, 0xBFFF, parent_device.memory, 0);
+    REQUIRE(parent.read_byte(0xA000) == 0xFF);
+    REQUIRE(parent.read_only_page(0xA0) == nullptr);
+
+    parent.write_byte(0xA000, 0x11);
+    REQUIRE(parent_device.memory[0x0000] == 0x11);
+    REQUIRE(parent_device.memory.private_pages() == 32);
+
+    cocoa::gb::MemoryBus child;
+    PagedDevice child_device { child, cocoa::gb::PagedMemory(0x2000, 0x00) };
+    child.map_handler(0xA000, 0xBFFF, { nullptr, write_paged, &child_device });
+    child_device.memory.share(parent_device.memory);
+    child.map_paged(0xA000, 0xBFFF, child_device.memory, 0);
+    parent.map_paged(0xA000, 0xBFFF, parent_device.memory, 0);
+
+    SECTION("Share pages until written")
+    {
+        REQUIRE(child_device.memory.private_pages() == 0);
+        REQUIRE(parent_device.memory.private_pages() == 0);
+        REQUIRE(child.read_byte(0xA000) == 0x11);
+        REQUIRE(child.read_only_page(0xA0) == nullptr);
+    }
+
+    SECTION("Copy only page that gets written")
+    {
+        child.write_byte(0xA001, 0x22);
+        child.write_byte(0xA002, 0x33);
+        REQUIRE(child_device.memory.private_pages() == 1);
+        REQUIRE(child.read_byte(0xA000) == 0x11);
+        REQUIRE(child.read_byte(0xA002) == 0x33);
+        REQUIRE(parent.read_byte(0xA001) == 0xFF);
+
+        parent.write_byte(0xB000, 0x44);
+        REQUIRE(parent_device.memory.private_pages() == 1);
+        REQUIRE(child.read_byte(0xB000) == 0xFF);
+    }
+
+    SECTION("Round trip through contiguous image")
+    {
+        std::vector<uint8_t> image(child_device.memory.size());
+        child_device.memory.save(image.data());
+        REQUIRE(image[0x0000] == 0x11);
+        REQUIRE(image[0x1FFF] == 0xFF);
+
+        image[0x1FFF] = 0x55;
+        child_device.memory.load(image.data());
+        REQUIRE(child_device.memory[0x1FFF] == 0x55);
+        REQUIRE(child_device.memory.private_pages() == 1);
+    }
+}
+
+TEST_CASE("void cocoa::gb::MemoryBus::share_memory(MemoryBus&)", "[share_memory]")
+{
+    cocoa::gb::MemoryBus parent;
+    parent.write_byte(0xC000, 0x11);
+    parent.write_byte(0xD000, 0x22);
+    parent.write_byte(0xFF80, 0x33);
+    REQUIRE(parent.private_pages() == 3);
+
+    cocoa::gb::MemoryBus child;
+    std::array<uint8_t, 0x2000> vram = {};
+    child.map_pages(0x8000, 0x9FFF, vram.data(), vram.data());
+    child.share_memory(parent);
+
+    SECTION("Share pages until written")
+    {
+        REQUIRE(child.private_pages() == 0);
+        REQUIRE(parent.private_pages() == 0);
+        REQUIRE(child.read_byte(0xC000) == 0x11);
+        REQUIRE(child.read_byte(0xD000) == 0x22);
+        REQUIRE(child.read_byte(0xFF80) == 0x33);
+    }
+
+    SECTION("Copy only page that gets written")
+    {
+        child.write_byte(0xC001, 0x44);
+        REQUIRE(child.private_pages() == 1);
+        REQUIRE(child.read_byte(0xC000) == 0x11);
+        REQUIRE(child.read_byte(0xC001) == 0x44);
+        REQUIRE(parent.read_byte(0xC001) == 0x00);
+
+        parent.write_byte(0xD000, 0x55);
+        REQUIRE(child.read_byte(0xD000) == 0x22);
+        REQUIRE(parent.read_byte(0xD000) == 0x55);
+
+        child.poke(0xFF80, 0x66);
+        REQUIRE(parent.peek(0xFF80) == 0x33);
+    }
+
+    SECTION("Copy shared page on first write even once other bus is gone")
+    {
+        cocoa::gb::MemoryBus bus;
+        bus.write_byte(0xC000, 0x11);
+        {
+            cocoa::gb::MemoryBus other;
+            other.share_memory(bus);
+        }
+        REQUIRE(bus.private_pages() == 0);
+        bus.write_byte(0xC000, 0x88);
+        REQUIRE(bus.private_pages() == 1);
+        REQUIRE(bus.read_byte(0xC000) == 0x88);
+    }
+
+    SECTION("Keep own mappings")
+    {
+        child.write_byte(0x8000, 0x77);
+        REQUIRE(vram[0] == 0x77);
+        REQUIRE(parent.read_byte(0x8000) == 0x00);
+    }
+
+    SECTION("Round trip through contiguous image")
+    {
+        std::vector<uint8_t> image(cocoa::gb::MemoryBus::size());
+        child.save_memory(image.data());
+        REQUIRE(image[0xC000] == 0x11);
+        REQUIRE(image[0xFF80] == 0x33);
+
+        image[0xC000] = 0x99;
+        child.load_memory(image.data());
+        REQUIRE(child.read_byte(0xC000) == 0x99);
+        REQUIRE(child.private_pages() == 1);
+    }
+}
+
+TEST_CASE("void cocoa::gb::MemoryBus::watch(const uint16_t, const WatchKind)", "[watch]")
+{
+    WatchLog log;
+    cocoa::gb::MemoryBus bus;
+    bus.set_watch_handler({ log_watch, &log });
+
+    SECTION("Notify only accesses of watched address and kind")
+    {
+        bus.watch(0xC010, cocoa::gb::WatchKind::Write);
+        bus.write_byte(0xC010, 0x12);
+        bus.write_byte(0xC011, 0x34);
+        REQUIRE(bus.read_byte(0xC010) == 0x12);
+        REQUIRE(bus.read_byte(0xC011) == 0x34);
+        REQUIRE(log.addresses == std::vector<uint16_t> { 0xC010 });
+        REQUIRE(log.values == std::vector<uint8_t> { 0x12 });
+        REQUIRE(log.kinds == std::vector<cocoa::gb::WatchKind> { cocoa::gb::WatchKind::Write });
+
+        bus.watch(0xC011, cocoa::gb::WatchKind::Read);
+        REQUIRE(bus.read_byte(0xC011) == 0x34);
+        REQUIRE(log.kinds.back() == cocoa::gb::WatchKind::Read);
+        REQUIRE(log.values.back() == 0x34);
+    }
+
+    SECTION("Keep mappings and handlers of watched pages")
+    {
+        std::array<uint8_t, 0x4000> bank = {};
+        bank[0x0010] = 0x77;
+        Recorder recorder;
+        bus.map_pages(0x4000, 0x7FFF, bank.data(), nullptr);
+        bus.map_handler(0x2000, 0x3FFF, { nullptr, write_recorder, &recorder });
+        bus.watch(0x4010, cocoa::gb::WatchKind::Read);
+        bus.watch(0x2000, cocoa::gb::WatchKind::Write);
+
+        REQUIRE(bus.read_byte(0x4010) == 0x77);
+        bus.write_byte(0x2000, 0x01);
+        REQUIRE(recorder.writes == 1);
+        REQUIRE(log.addresses == std::vector<uint16_t> { 0x4010, 0x2000 });
+
+        bus.map_pages(0x4000, 0x7FFF, bank.data() + 0x1000, nullptr);
+        REQUIRE(bus.read_byte(0x4010) == 0x00);
+        REQUIRE(log.addresses.size() == 3);
+    }
+
+    SECTION("Stop notifying once unwatched")
+    {
+        bus.watch(0xC000, cocoa::gb::WatchKind::Write);
+        bus.watch(0xFF80, cocoa::gb::WatchKind::Write);
+        bus.unwatch(0xC000, cocoa::gb::WatchKind::Write);
+        REQUIRE(!bus.is_watched(0xC000, cocoa::gb::WatchKind::Write));
+        REQUIRE(bus.is_watched(0xFF80, cocoa::gb::WatchKind::Write));
+        bus.write_byte(0xC000, 0x01);
+        REQUIRE(log.addresses.empty());
+
+        bus.clear_watches();
+        bus.write_byte(0xFF80, 0x02);
+        REQUIRE(log.addresses.empty());
+        REQUIRE(bus.read_byte(0xC000) == 0x01);
+        REQUIRE(bus.read_byte(0xFF80) == 0x02);
+    }
+}
+
+TEST_CASE("void cocoa::gb::MemoryBus::copy(const uint16_t, const uint16_t, const size_t)", "[copy]")
+{
+    cocoa::gb::MemoryBus bus;
+    std::vector<uint8_t> rom(0x4000);
+    for (size_t i = 0; i < rom.size(); ++i)
+        rom[i] = static_cast<uint8_t>(i * 7);
+    bus.map_pages(0x0000, 0x3FFF, rom.data(), nullptr);
+
+    SECTION("Copy across unaligned page boundaries in bulk")
+    {
+        bus.copy(0xC0F0, 0x0123, 0x300);
+        for (uint16_t i = 0; i < 0x300; ++i)
+            REQUIRE(bus.read_byte(static_cast<uint16_t>(0xC0F0 + i)) == rom[0x0123 + i]);
+        REQUIRE(bus.read_byte(0xC3F0) == 0x00);
+    }
+
+    SECTION("Go through handlers and watches byte by byte")
+    {
+        Recorder recorder;
+        bus.map_handler(0x8000, 0x80FF, { nullptr, write_recorder, &recorder });
+        bus.copy(0x8000, 0x0010, 0x10);
+        REQUIRE(recorder.writes == 0x10);
+        REQUIRE(recorder.address == 0x800F);
+        REQUIRE(recorder.value == rom[0x001F]);
+
+        WatchLog log;
+        bus.set_watch_handler({ log_watch, &log });
+        bus.watch(0xD004, cocoa::gb::WatchKind::Write);
+        bus.copy(0xD000, 0x0000, 0x10);
+        REQUIRE(log.addresses == std::vector<uint16_t> { 0xD004 });
+        REQUIRE(bus.read_byte(0xD004) == rom[0x0004]);
+    }
+
+    SECTION("Copy into pages still shared with fork")
+    {
+        bus.write_byte(0xC000, 0x11);
+        cocoa::gb::MemoryBus other;
+        other.share_memory(bus);
+        other.copy(0xC000, 0xC001, 1);
+        REQUIRE(other.read_byte(0xC000) == 0x00);
+        REQUIRE(bus.read_byte(0xC000) == 0x11);
+    }
+}
+
+TEST_CASE("void cocoa::gb::MemoryBus::switch_wram_bank(const uint8_t)", "[switch_wram_bank]")
+{
+    cocoa::gb::MemoryBus bus;
+    bus.write_byte(0xC000, 0x01);
+    bus.write_byte(0xD000, 0x11);
+    bus.switch_wram_bank(0x02);
+    REQUIRE(bus.wram_bank() == 2);
+    REQUIRE(bus.read_byte(0xC000) == 0x01);
+    REQUIRE(bus.read_byte(0xD000) == 0x00);
+    bus.write_byte(0xD000, 0x22);
+    bus.write_byte(0xDFFF, 0x23);
+
+    SECTION("Keep contents of every bank")
+    {
+        bus.switch_wram_bank(0x00);
+        REQUIRE(bus.wram_bank() == 1);
+        REQUIRE(bus.read_byte(0xD000) == 0x11);
+        REQUIRE(bus.read_byte(0xDFFF) == 0x00);
+        bus.switch_wram_bank(0xFA);
+        REQUIRE(bus.read_byte(0xD000) == 0x22);
+        REQUIRE(bus.peek(0xDFFF) == 0x23);
+    }
+
+    SECTION("Store every bank in contiguous image")
+    {
+        std::vector<uint8_t> image(cocoa::gb::MemoryBus::size());
+        bus.save_memory(image.data());
+        REQUIRE(image[0xD000] == 0x11);
+        REQUIRE(image[0x10000] == 0x22);
+
+        image[0x10000] = 0x33;
+        image[0x10000 + 6 * 0x1000 - 1] = 0x77;
+        bus.load_memory(image.data());
+        REQUIRE(bus.read_byte(0xD000) == 0x33);
+        bus.switch_wram_bank(0x07);
+        REQUIRE(bus.read_byte(0xDFFF) == 0x77);
+    }
+
+    SECTION("Share every bank with fork")
+    {
+        cocoa::gb::MemoryBus child;
+        child.share_memory(bus);
+        REQUIRE(child.read_byte(0xD000) == 0x11);
+        child.switch_wram_bank(0x02);
+        REQUIRE(child.read_byte(0xD000) == 0x22);
+        REQUIRE(child.private_pages() == 0);
+
+        child.write_byte(0xD000, 0x44);
+        REQUIRE(child.private_pages() == 1);
+        REQUIRE(bus.read_byte(0xD000) == 0x22);
+    }
+}
@@ -0,0 +1,504 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define COCOA_HAS_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define COCOA_HAS_NEON 1
+#endif
+
+#include "cocoa/gb/interrupt.hpp"
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/ppu.hpp"
+#include "cocoa/utility.hpp"
+
+namespace cocoa::gb {
+constexpr size_t OAM_SCAN_DOTS = 80;
+constexpr size_t TRANSFER_DOTS = 172;
+constexpr size_t HBLANK_DOTS = DOTS_PER_LINE - OAM_SCAN_DOTS - TRANSFER_DOTS;
+
+constexpr size_t TILE_SIZE = 16;
+constexpr size_t TILE_MAP_SIZE = 32;
+constexpr size_t OBJECT_COUNT = 40;
+constexpr size_t OBJECTS_PER_LINE = 10;
+
+// NOTE: Offsets into VRAM, which starts at 0x8000 on memory bus.
+constexpr uint16_t TILE_BLOCK0 = 0x0000;
+constexpr uint16_t TILE_BLOCK2 = 0x1000;
+constexpr uint16_t TILE_MAP0 = 0x1800;
+constexpr uint16_t TILE_MAP1 = 0x1C00;
+
+// NOTE: Enough room to decode one extra tile for fine scrolling.
+using LineBuffer = std::array<uint8_t, LCD_WIDTH + 8>;
+
+void
+decode_tile_row(const uint8_t low, const uint8_t high, const bool flip, uint8_t* out)
+{
+#if defined(COCOA_HAS_SSE2)
+    const __m128i bits = flip ? _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0)
+                              : _mm_setr_epi8(-128, 64, 32, 16, 8, 4, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i lo
+        = _mm_cmpeq_epi8(_mm_and_si128(_mm_set1_epi8(static_cast<char>(low)), bits), bits);
+    const __m128i hi
+        = _mm_cmpeq_epi8(_mm_and_si128(_mm_set1_epi8(static_cast<char>(high)), bits), bits);
+    const __m128i indices = _mm_or_si128(
+        _mm_and_si128(lo, _mm_set1_epi8(1)), _mm_and_si128(hi, _mm_set1_epi8(2)));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out), indices);
+#elif defined(COCOA_HAS_NEON)
+    static const uint8_t normal[8] = { 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 };
+    static const uint8_t flipped[8] = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80 };
+    const uint8x8_t bits = vld1_u8(flip ? flipped : normal);
+    const uint8x8_t lo = vand_u8(vtst_u8(vdup_n_u8(low), bits), vdup_n_u8(1));
+    const uint8x8_t hi = vand_u8(vtst_u8(vdup_n_u8(high), bits), vdup_n_u8(2));
+    vst1_u8(out, vorr_u8(lo, hi));
+#else
+    for (size_t i = 0; i < 8; ++i) {
+        const size_t bit = flip ? i : 7 - i;
+        out[i] = static_cast<uint8_t>(((low >> bit) & 1) | (((high >> bit) & 1) << 1));
+    }
+#endif
+}
+
+Ppu::Ppu(MemoryBus& bus, const bool cgb)
+    : m_bus(bus)
+    , m_vram { { PagedMemory(VRAM_BANK_SIZE, 0x00), PagedMemory(VRAM_BANK_SIZE, 0x00) } }
+    , m_vram_bank(0)
+    , m_oam {}
+    , m_framebuffer(std::make_shared<Framebuffer>())
+    , m_framebuffer_owned(true)
+    , m_mode(PpuMode::OamScan)
+    , m_ly(0)
+    , m_window_line(0)
+    , m_stat_line(false)
+    , m_dots(0)
+    , m_mode_length(OAM_SCAN_DOTS)
+    , m_frames(0)
+    , m_hblank_handler {}
+{
+    m_bus.map_handler(from_enum(MemoryMap::VramStart), from_enum(MemoryMap::VramEnd),
+        { nullptr, on_write_vram, this });
+    map_vram(0);
+    map_oam();
+    m_bus.map_io_handler(IoMap::LCDC, { nullptr, on_write_lcdc, this });
+    m_bus.map_io_handler(IoMap::STAT, { nullptr, on_write_stat, this });
+    m_bus.map_io_handler(IoMap::LY, { nullptr, on_write_ly, this });
+    m_bus.map_io_handler(IoMap::LYC, { nullptr, on_write_lyc, this });
+    set_ly(0);
+    update_stat();
+    if (cgb) {
+        m_bus.map_io_handler(IoMap::VBK, { nullptr, on_write_vbk, this });
+        m_bus.poke(from_enum(IoMap::VBK), 0xFE);
+    }
+}
+
+void
+Ppu::step(const size_t tstates)
+{
+    if (!is_bit_set<uint8_t, 7>(m_bus.peek(from_enum(IoMap::LCDC))))
+        return;
+
+    m_dots += tstates;
+    while (m_dots >= m_mode_length) {
+        m_dots -= m_mode_length;
+        switch (m_mode) {
+        case PpuMode::OamScan:
+            enter_mode(PpuMode::Transfer, TRANSFER_DOTS);
+            break;
+        case PpuMode::Transfer:
+            render_scanline();
+            enter_mode(PpuMode::HBlank, HBLANK_DOTS);
+            if (m_hblank_handler.enter != nullptr)
+                m_hblank_handler.enter(m_hblank_handler.context);
+            break;
+        case PpuMode::HBlank:
+            set_ly(static_cast<uint8_t>(m_ly + 1));
+            if (m_ly == LCD_HEIGHT) {
+                m_window_line = 0;
+                ++m_frames;
+                request_interrupt<Interrupt::VBlank>(m_bus);
+                enter_mode(PpuMode::VBlank, DOTS_PER_LINE);
+            } else {
+                enter_mode(PpuMode::OamScan, OAM_SCAN_DOTS);
+            }
+            break;
+        case PpuMode::VBlank:
+            if (m_ly + size_t(1) == LINES_PER_FRAME) {
+                set_ly(0);
+                enter_mode(PpuMode::OamScan, OAM_SCAN_DOTS);
+            } else {
+                set_ly(static_cast<uint8_t>(m_ly + 1));
+                update_stat();
+            }
+            break;
+        }
+    }
+}
+
+const Framebuffer&
+Ppu::framebuffer() const
+{
+    return *m_framebuffer;
+}
+
+size_t
+Ppu::frames() const
+{
+    return m_frames;
+}
+
+PpuMode
+Ppu::mode() const
+{
+    return m_mode;
+}
+
+uint8_t
+Ppu::ly() const
+{
+    return m_ly;
+}
+
+std::array<uint8_t, MEMORY_PAGE_SIZE>&
+Ppu::oam()
+{
+    return m_oam;
+}
+
+void
+Ppu::map_oam()
+{
+    m_bus.map_pages(from_enum(MemoryMap::OamStart), from_enum(MemoryMap::UnusableAreaEnd),
+        m_oam.data(), m_oam.data());
+}
+
+uint8_t
+Ppu::vram_bank() const
+{
+    return m_vram_bank;
+}
+
+void
+Ppu::set_hblank_handler(const HBlankHandler& handler)
+{
+    m_hblank_handler = handler;
+}
+
+size_t
+Ppu::dots_until_event() const
+{
+    if (!is_bit_set<uint8_t, 7>(m_bus.peek(from_enum(IoMap::LCDC))))
+        return DOTS_PER_FRAME;
+    return m_mode_length - m_dots;
+}
+
+void
+Ppu::save_state(PpuSnapshot& out) const
+{
+    out.dots = m_dots;
+    out.mode_length = m_mode_length;
+    out.frames = m_frames;
+    out.framebuffer = *m_framebuffer;
+    for (size_t bank = 0; bank < VRAM_BANK_COUNT; ++bank)
+        m_vram[bank].save(out.vram[bank].data());
+    out.oam = m_oam;
+    out.mode = from_enum(m_mode);
+    out.ly = m_ly;
+    out.window_line = m_window_line;
+    out.stat_line = m_stat_line ? 1 : 0;
+    out.vram_bank = m_vram_bank;
+    out.reserved = {};
+}
+
+void
+Ppu::load_state(const PpuSnapshot& snapshot)
+{
+    m_dots = snapshot.dots;
+    m_mode_length = snapshot.mode_length;
+    m_frames = snapshot.frames;
+    own_framebuffer() = snapshot.framebuffer;
+    for (size_t bank = 0; bank < VRAM_BANK_COUNT; ++bank)
+        m_vram[bank].load(snapshot.vram[bank].data());
+    m_oam = snapshot.oam;
+    m_mode = static_cast<PpuMode>(snapshot.mode);
+    m_ly = snapshot.ly;
+    m_window_line = snapshot.window_line;
+    m_stat_line = snapshot.stat_line != 0;
+    map_vram(snapshot.vram_bank);
+}
+
+void
+Ppu::share_state(Ppu& other)
+{
+    m_dots = other.m_dots;
+    m_mode_length = other.m_mode_length;
+    m_frames = other.m_frames;
+    m_framebuffer = other.m_framebuffer;
+    m_framebuffer_owned = false;
+    other.m_framebuffer_owned = false;
+    m_oam = other.m_oam;
+    m_mode = other.m_mode;
+    m_ly = other.m_ly;
+    m_window_line = other.m_window_line;
+    m_stat_line = other.m_stat_line;
+    for (size_t bank = 0; bank < VRAM_BANK_COUNT; ++bank)
+        m_vram[bank].share(other.m_vram[bank]);
+
+    // INVARIANT: Both PPUs drop write entries of VRAM pages that are shared now.
+    map_vram(other.m_vram_bank);
+    other.map_vram(other.m_vram_bank);
+}
+
+void
+Ppu::on_write_lcdc(void* context, uint16_t address, uint8_t value)
+{
+    Ppu* ppu = static_cast<Ppu*>(context);
+    const bool was_enabled = is_bit_set<uint8_t, 7>(ppu->m_bus.peek(address));
+    const bool is_enabled = is_bit_set<uint8_t, 7>(value);
+    ppu->m_bus.poke(address, value);
+
+    // INVARIANT: Turning LCD off parks PPU at start of frame until it is turned back on.
+    if (was_enabled && !is_enabled) {
+        ppu->m_dots = 0;
+        ppu->m_window_line = 0;
+        ppu->set_ly(0);
+        ppu->enter_mode(PpuMode::HBlank, HBLANK_DOTS);
+    } else if (!was_enabled && is_enabled) {
+        ppu->m_dots = 0;
+        ppu->enter_mode(PpuMode::OamScan, OAM_SCAN_DOTS);
+    }
+}
+
+void
+Ppu::on_write_stat(void* context, uint16_t address, uint8_t value)
+{
+    Ppu* ppu = static_cast<Ppu*>(context);
+    const uint8_t mode = ppu->m_bus.peek(address) & 0x07;
+    ppu->m_bus.poke(address, static_cast<uint8_t>((value & 0x78) | mode));
+    ppu->update_stat();
+}
+
+void
+Ppu::on_write_ly(void* context, uint16_t address, uint8_t value)
+{
+    // NOTE: LY is read-only.
+    (void)context;
+    (void)address;
+    (void)value;
+}
+
+void
+Ppu::on_write_lyc(void* context, uint16_t address, uint8_t value)
+{
+    Ppu* ppu = static_cast<Ppu*>(context);
+    ppu->m_bus.poke(address, value);
+    ppu->update_stat();
+}
+
+void
+Ppu::on_write_vbk(void* context, uint16_t address, uint8_t value)
+{
+    Ppu* ppu = static_cast<Ppu*>(context);
+    ppu->m_bus.poke(address, static_cast<uint8_t>(0xFE | value));
+    ppu->map_vram(value);
+}
+
+void
+Ppu::on_write_vram(void* context, uint16_t address, uint8_t value)
+{
+    Ppu* ppu = static_cast<Ppu*>(context);
+    ppu->m_vram[ppu->m_vram_bank].write(address - from_enum(MemoryMap::VramStart), value);
+    ppu->map_vram(ppu->m_vram_bank);
+}
+
+void
+Ppu::map_vram(const uint8_t bank)
+{
+    m_vram_bank = bank & 0x01;
+    m_bus.map_paged(
+        from_enum(MemoryMap::VramStart), from_enum(MemoryMap::VramEnd), m_vram[m_vram_bank], 0);
+}
+
+Framebuffer&
+Ppu::own_framebuffer()
+{
+    // NOTE: Tracked by flag rather than reference count, same as bus pages.
+    if (!m_framebuffer_owned) {
+        m_framebuffer = std::make_shared<Framebuffer>(*m_framebuffer);
+        m_framebuffer_owned = true;
+    }
+    return *m_framebuffer;
+}
+
+void
+Ppu::enter_mode(const PpuMode mode, const size_t length)
+{
+    m_mode = mode;
+    m_mode_length = length;
+    update_stat();
+}
+
+void
+Ppu::set_ly(const uint8_t line)
+{
+    m_ly = line;
+    m_bus.poke(from_enum(IoMap::LY), line);
+}
+
+void
+Ppu::update_stat()
+{
+    const uint8_t stat = m_bus.peek(from_enum(IoMap::STAT));
+    const bool coincidence = m_ly == m_bus.peek(from_enum(IoMap::LYC));
+    m_bus.poke(from_enum(IoMap::STAT),
+        static_cast<uint8_t>(
+            0x80 | (stat & 0x78) | (coincidence ? 0x04 : 0x00) | from_enum(m_mode)));
+
+    // INVARIANT: LCD interrupt only fires on rising edge of OR of all enabled STAT sources.
+    const bool line = (is_bit_set<uint8_t, 3>(stat) && m_mode == PpuMode::HBlank)
+        || (is_bit_set<uint8_t, 4>(stat) && m_mode == PpuMode::VBlank)
+        || (is_bit_set<uint8_t, 5>(stat) && m_mode == PpuMode::OamScan)
+        || (is_bit_set<uint8_t, 6>(stat) && coincidence);
+    if (line && !m_stat_line)
+        request_interrupt<Interrupt::Lcd>(m_bus);
+    m_stat_line = line;
+}
+
+void
+Ppu::render_scanline()
+{
+    const uint8_t lcdc = m_bus.peek(from_enum(IoMap::LCDC));
+    uint8_t* row = own_framebuffer().data() + m_ly * LCD_WIDTH;
+
+    std::array<uint8_t, LCD_WIDTH> line {};
+    if (is_bit_set<uint8_t, 0>(lcdc)) {
+        render_background(line, lcdc);
+        render_window(line, lcdc);
+
+        const uint8_t bgp = m_bus.peek(from_enum(IoMap::BGP));
+        const std::array<uint8_t, 4> shades = { static_cast<uint8_t>(bgp & 0x03),
+            static_cast<uint8_t>((bgp >> 2) & 0x03), static_cast<uint8_t>((bgp >> 4) & 0x03),
+            static_cast<uint8_t>((bgp >> 6) & 0x03) };
+        for (size_t x = 0; x < LCD_WIDTH; ++x)
+            row[x] = shades[line[x]];
+    } else {
+        std::memset(row, 0, LCD_WIDTH);
+    }
+
+    if (is_bit_set<uint8_t, 1>(lcdc))
+        render_objects(line, lcdc);
+}
+
+/// @brief Decode row of tile referenced by tile map entry.
+static void
+decode_map_tile(const PagedMemory& vram, const uint8_t lcdc, const uint8_t tile,
+    const size_t fine_y, uint8_t* out)
+{
+    // INVARIANT: Block 2 addressing treats tile index as signed, reaching down into block 1.
+    const size_t base = is_bit_set<uint8_t, 4>(lcdc)
+        ? TILE_BLOCK0 + tile * TILE_SIZE
+        : static_cast<size_t>(
+              TILE_BLOCK2 + static_cast<int8_t>(tile) * static_cast<int>(TILE_SIZE));
+    const size_t address = base + fine_y * 2;
+    decode_tile_row(vram[address], vram[address + 1], false, out);
+}
+
+void
+Ppu::render_background(std::array<uint8_t, LCD_WIDTH>& line, const uint8_t lcdc)
+{
+    const uint8_t scy = m_bus.peek(from_enum(IoMap::SCY));
+    const uint8_t scx = m_bus.peek(from_enum(IoMap::SCX));
+    const size_t y = static_cast<uint8_t>(m_ly + scy);
+    const size_t map = (is_bit_set<uint8_t, 3>(lcdc) ? TILE_MAP1 : TILE_MAP0)
+        + (y / 8) * TILE_MAP_SIZE;
+
+    LineBuffer buffer;
+    const PagedMemory& vram = m_vram[0];
+    for (size_t i = 0; i <= LCD_WIDTH / 8; ++i) {
+        const size_t column = (scx / 8 + i) % TILE_MAP_SIZE;
+        decode_map_tile(vram, lcdc, vram[map + column], y % 8, buffer.data() + i * 8);
+    }
+    std::memcpy(line.data(), buffer.data() + (scx % 8), LCD_WIDTH);
+}
+
+void
+Ppu::render_window(std::array<uint8_t, LCD_WIDTH>& line, const uint8_t lcdc)
+{
+    const uint8_t wy = m_bus.peek(from_enum(IoMap::WY));
+    const uint8_t wx = m_bus.peek(from_enum(IoMap::WX));
+    if (!is_bit_set<uint8_t, 5>(lcdc) || m_ly < wy || wx > LCD_WIDTH + 6)
+        return;
+
+    // NOTE: WX is offset by 7, so window can start up to 7 pixels left of screen.
+    const size_t skip = (wx < 7) ? size_t(7) - wx : 0;
+    const size_t start = (wx < 7) ? 0 : size_t(wx) - 7;
+    const size_t map = (is_bit_set<uint8_t, 6>(lcdc) ? TILE_MAP1 : TILE_MAP0)
+        + (m_window_line / 8) * TILE_MAP_SIZE;
+
+    LineBuffer buffer;
+    const PagedMemory& vram = m_vram[0];
+    const size_t count = LCD_WIDTH - start;
+    for (size_t i = 0; i * 8 < count + skip; ++i)
+        decode_map_tile(vram, lcdc, vram[map + i], m_window_line % 8, buffer.data() + i * 8);
+    std::memcpy(line.data() + start, buffer.data() + skip, count);
+    ++m_window_line;
+}
+
+void
+Ppu::render_objects(const std::array<uint8_t, LCD_WIDTH>& bg, const uint8_t lcdc)
+{
+    const size_t height = is_bit_set<uint8_t, 2>(lcdc) ? 16 : 8;
+    const size_t line = m_ly + size_t(16);
+
+    std::array<const uint8_t*, OBJECTS_PER_LINE> objects {};
+    size_t count = 0;
+    for (size_t i = 0; i < OBJECT_COUNT && count < OBJECTS_PER_LINE; ++i) {
+        const uint8_t* object = m_oam.data() + i * 4;
+        if (line >= object[0] && line < object[0] + height)
+            objects[count++] = object;
+    }
+
+    // INVARIANT: On DMG, smaller X wins, and OAM order breaks ties, hence stable sort.
+    std::stable_sort(objects.begin(), objects.begin() + static_cast<std::ptrdiff_t>(count),
+        [](const uint8_t* lhs, const uint8_t* rhs) { return lhs[1] < rhs[1]; });
+
+    const std::array<uint8_t, 2> palettes
+        = { m_bus.peek(from_enum(IoMap::OBP0)), m_bus.peek(from_enum(IoMap::OBP1)) };
+    uint8_t* row = m_framebuffer->data() + m_ly * LCD_WIDTH;
+    std::array<bool, LCD_WIDTH> drawn {};
+    for (size_t i = 0; i < count; ++i) {
+        const uint8_t* object = objects[i];
+        const uint8_t attributes = object[3];
+        const uint8_t tile = (height == 16) ? static_cast<uint8_t>(object[2] & 0xFE) : object[2];
+        size_t fine_y = line - object[0];
+        if (is_bit_set<uint8_t, 6>(attributes))
+            fine_y = height - 1 - fine_y;
+
+        std::array<uint8_t, 8> pixels;
+        const size_t address = TILE_BLOCK0 + tile * TILE_SIZE + fine_y * 2;
+        decode_tile_row(m_vram[0][address], m_vram[0][address + 1],
+            is_bit_set<uint8_t, 5>(attributes), pixels.data());
+
+        const uint8_t palette = palettes[is_bit_set<uint8_t, 4>(attributes) ? 1 : 0];
+        for (size_t px = 0; px < 8; ++px) {
+            // NOTE: Object X is offset by 8, so it can start up to 8 pixels left of screen.
+            const size_t x = object[1] + px;
+            if (x < 8 || x >= LCD_WIDTH + 8 || pixels[px] == 0 || drawn[x - 8])
+                continue;
+
+            drawn[x - 8] = true;
+            if (is_bit_set<uint8_t, 7>(attributes) && bg[x - 8] != 0)
+                continue;
+            row[x - 8] = static_cast<uint8_t>((palette >> (pixels[px] * 2)) & 0x03);
+        }
+    }
+}
+} // namespace cocoa::gb
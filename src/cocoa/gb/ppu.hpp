@@ -0,0 +1,274 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_GB_PPU_HPP
+#define COCOA_GB_PPU_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "cocoa/gb/memory.hpp"
+
+namespace cocoa::gb {
+/// @brief Width of LCD in pixels.
+constexpr size_t LCD_WIDTH = 160;
+
+/// @brief Height of LCD in pixels.
+constexpr size_t LCD_HEIGHT = 144;
+
+/// @brief Amount of dots, i.e., t-states, spent on one scanline.
+constexpr size_t DOTS_PER_LINE = 456;
+
+/// @brief Amount of scanlines in one frame, including VBlank.
+constexpr size_t LINES_PER_FRAME = 154;
+
+/// @brief Amount of t-states spent on one frame.
+constexpr size_t DOTS_PER_FRAME = DOTS_PER_LINE * LINES_PER_FRAME;
+
+/// @brief Size of one VRAM bank in bytes.
+constexpr size_t VRAM_BANK_SIZE = 0x2000;
+
+/// @brief Amount of VRAM banks, of which DMG only has the first.
+constexpr size_t VRAM_BANK_COUNT = 2;
+
+/// @brief Frame of shades from 0 (lightest) to 3 (darkest), stored row by row.
+using Framebuffer = std::array<uint8_t, LCD_WIDTH * LCD_HEIGHT>;
+
+/// @brief PPU modes as reported by bits 0 and 1 of STAT register.
+///
+/// @see https://gbdev.io/pandocs/Rendering.html#ppu-modes
+enum class PpuMode : uint8_t {
+    HBlank = 0,
+    VBlank = 1,
+    OamScan = 2,
+    Transfer = 3,
+};
+
+/// @brief Plain image of PPU state stored in save states.
+///
+/// @invariant Fields are fixed width and explicitly padded, so layout is identical across builds.
+struct PpuSnapshot final {
+    uint64_t dots;
+    uint64_t mode_length;
+    uint64_t frames;
+    Framebuffer framebuffer;
+    std::array<std::array<uint8_t, VRAM_BANK_SIZE>, VRAM_BANK_COUNT> vram;
+    std::array<uint8_t, MEMORY_PAGE_SIZE> oam;
+    uint8_t mode;
+    uint8_t ly;
+    uint8_t window_line;
+    uint8_t stat_line;
+    uint8_t vram_bank;
+    std::array<uint8_t, 3> reserved;
+};
+
+static_assert(sizeof(PpuSnapshot)
+    == 24 + LCD_WIDTH * LCD_HEIGHT + VRAM_BANK_SIZE * VRAM_BANK_COUNT + MEMORY_PAGE_SIZE + 8);
+
+/// @brief Callback notified whenever PPU enters HBlank of a visible scanline.
+///
+/// Called once scanline is rendered, at the point in time that PPU was caught up to.
+struct HBlankHandler final {
+    void (*enter)(void* context) = nullptr;
+    void* context = nullptr;
+};
+
+/// @brief Decode one row of 2bpp tile data into palette indices.
+///
+/// Tile rows are stored as two bit planes, where bit 7 is leftmost pixel. Decoding interleaves
+/// both planes into eight indices from 0 to 3. Uses SSE2 or NEON when available, and a scalar
+/// fallback otherwise.
+///
+/// @param [in] low Bit plane holding low bit of each index.
+/// @param [in] high Bit plane holding high bit of each index.
+/// @param [in] flip Decode row mirrored horizontally.
+/// @param [out] out Eight decoded palette indices.
+///
+/// @see https://gbdev.io/pandocs/Tile_Data.html
+void
+decode_tile_row(const uint8_t low, const uint8_t high, const bool flip, uint8_t* out);
+
+/// @brief GameBoy picture processing unit.
+///
+/// Renders whole scanlines at once when a line enters HBlank, instead of emulating pixel FIFO
+/// fetches dot by dot. Mid-scanline register writes are thus only observed at line granularity,
+/// which is all that nearly every game relies on.
+///
+/// VRAM and OAM are owned by PPU and mapped straight into memory bus pages, so CPU access to
+/// them stays on the fast path. VRAM pages and the framebuffer are shared copy-on-write with
+/// forks. LCDC, STAT, LY, and LYC are serviced through I/O handlers. Other LCD registers are read
+/// from plain bus memory when a scanline is rendered.
+///
+/// On CGB, VBK switches VRAM banks by repointing those pages. Scanlines are still rendered from
+/// bank 0 alone, since CGB tile attributes and palettes are not drawn.
+///
+/// @see https://gbdev.io/pandocs/Rendering.html
+class Ppu final {
+public:
+    /// @brief Attach PPU to memory bus.
+    ///
+    /// @param [in] bus Memory bus to map VRAM, OAM, and LCD registers into.
+    /// @param [in] cgb Attach VBK too, so both VRAM banks can be switched in.
+    explicit Ppu(MemoryBus& bus, const bool cgb = false);
+
+    Ppu(const Ppu&) = delete;
+
+    Ppu&
+    operator=(const Ppu&) = delete;
+
+    ~Ppu() noexcept = default;
+
+    /// @brief Advance PPU by given amount of t-states.
+    ///
+    /// @param [in] tstates Amount of t-states, i.e., dots, to advance by.
+    void
+    step(const size_t tstates);
+
+    /// @brief Get last rendered frame.
+    [[nodiscard]]
+    const Framebuffer&
+    framebuffer() const;
+
+    /// @brief Get amount of frames completed, i.e., times VBlank was entered.
+    [[nodiscard]]
+    size_t
+    frames() const;
+
+    [[nodiscard]]
+    PpuMode
+    mode() const;
+
+    [[nodiscard]]
+    uint8_t
+    ly() const;
+
+    /// @brief Get OAM, e.g., for DMA to access while CPU is locked out of it.
+    [[nodiscard]]
+    std::array<uint8_t, MEMORY_PAGE_SIZE>&
+    oam();
+
+    /// @brief Map OAM straight into memory bus, e.g., once DMA stops locking CPU out of it.
+    void
+    map_oam();
+
+    /// @brief Get VRAM bank mapped into memory bus.
+    [[nodiscard]]
+    uint8_t
+    vram_bank() const;
+
+    /// @brief Set callback notified whenever PPU enters HBlank of a visible scanline.
+    ///
+    /// @param [in] handler Callback to notify, or empty handler to notify nobody.
+    void
+    set_hblank_handler(const HBlankHandler& handler);
+
+    /// @brief Get amount of dots until PPU next changes mode or scanline.
+    ///
+    /// Interrupts are only ever raised at these points, so CPU can safely run this far ahead of
+    /// PPU in one slice.
+    ///
+    /// @return Amount of dots until next event, or one frame worth of dots if LCD is off.
+    [[nodiscard]]
+    size_t
+    dots_until_event() const;
+
+    /// @brief Capture PPU state for save state.
+    ///
+    /// @param [out] out Snapshot to fill.
+    void
+    save_state(PpuSnapshot& out) const;
+
+    /// @brief Restore PPU state from save state.
+    ///
+    /// VRAM and OAM stay mapped into memory bus, so only their contents get replaced, and VRAM
+    /// bank of snapshot is switched back in.
+    ///
+    /// @param [in] snapshot Snapshot to restore from.
+    ///
+    /// @pre Snapshot holds a valid `PpuMode`.
+    void
+    load_state(const PpuSnapshot& snapshot);
+
+    /// @brief Take over state of other PPU, sharing its VRAM and framebuffer copy-on-write.
+    ///
+    /// VRAM pages are copied on first write by either PPU. The framebuffer is copied whole the
+    /// first time either PPU renders a scanline, since every frame overwrites all of it anyway.
+    ///
+    /// @note Not thread-safe with respect to other PPU, since its VRAM gets mapped again.
+    ///
+    /// @param [in,out] other PPU to take over state from.
+    void
+    share_state(Ppu& other);
+
+private:
+    static void
+    on_write_lcdc(void* context, uint16_t address, uint8_t value);
+
+    static void
+    on_write_stat(void* context, uint16_t address, uint8_t value);
+
+    static void
+    on_write_ly(void* context, uint16_t address, uint8_t value);
+
+    static void
+    on_write_lyc(void* context, uint16_t address, uint8_t value);
+
+    static void
+    on_write_vbk(void* context, uint16_t address, uint8_t value);
+
+    /// @brief Copy VRAM page that is still shared with a fork, then write to it.
+    static void
+    on_write_vram(void* context, uint16_t address, uint8_t value);
+
+    /// @brief Map VRAM bank straight into memory bus.
+    void
+    map_vram(const uint8_t bank);
+
+    /// @brief Make framebuffer writable by this PPU alone, copying it unless already owned.
+    Framebuffer&
+    own_framebuffer();
+
+    void
+    enter_mode(const PpuMode mode, const size_t length);
+
+    void
+    set_ly(const uint8_t line);
+
+    void
+    update_stat();
+
+    void
+    render_scanline();
+
+    void
+    render_background(std::array<uint8_t, LCD_WIDTH>& line, const uint8_t lcdc);
+
+    void
+    render_window(std::array<uint8_t, LCD_WIDTH>& line, const uint8_t lcdc);
+
+    void
+    render_objects(const std::array<uint8_t, LCD_WIDTH>& bg, const uint8_t lcdc);
+
+    MemoryBus& m_bus;
+    std::array<PagedMemory, VRAM_BANK_COUNT> m_vram;
+    uint8_t m_vram_bank;
+    std::array<uint8_t, MEMORY_PAGE_SIZE> m_oam;
+    std::shared_ptr<Framebuffer> m_framebuffer;
+
+    /// Whether this PPU copied framebuffer itself since it was last shared.
+    bool m_framebuffer_owned;
+
+    PpuMode m_mode;
+    uint8_t m_ly;
+    uint8_t m_window_line;
+    bool m_stat_line;
+    size_t m_dots;
+    size_t m_mode_length;
+    size_t m_frames;
+    HBlankHandler m_hblank_handler;
+};
+} // namespace cocoa::gb
+
+#endif // COCOA_GB_PPU_HPP
@@ -0,0 +1,177 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "cocoa/gb/interrupt.hpp"
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/ppu.hpp"
+#include "cocoa/utility.hpp"
+
+TEST_CASE("void cocoa::gb::decode_tile_row(const uint8_t, const uint8_t, const bool, uint8_t*)",
+    "[decode_tile_row]")
+{
+    std::array<uint8_t, 8> result {};
+    for (size_t low = 0; low < 256; ++low) {
+        for (size_t high = 0; high < 256; ++high) {
+            for (bool flip : { false, true }) {
+                cocoa::gb::decode_tile_row(static_cast<uint8_t>(low), static_cast<uint8_t>(high),
+                    flip, result.data());
+                for (size_t i = 0; i < 8; ++i) {
+                    const size_t bit = flip ? i : 7 - i;
+                    const size_t expect = ((low >> bit) & 1) | (((high >> bit) & 1) << 1);
+                    if (result[i] != expect)
+                        FAIL("Mismatch at low " << low << ", high " << high << ", pixel " << i);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("void cocoa::gb::Ppu::step(const size_t)", "[step]")
+{
+    cocoa::gb::MemoryBus bus {};
+    cocoa::gb::Ppu ppu(bus);
+    bus.write_io_reg(cocoa::gb::IoMap::LCDC, 0x91);
+
+    SECTION("Walk through modes of one scanline")
+    {
+        REQUIRE(ppu.mode() == cocoa::gb::PpuMode::OamScan);
+        ppu.step(80);
+        REQUIRE(ppu.mode() == cocoa::gb::PpuMode::Transfer);
+        REQUIRE((bus.read_io_reg(cocoa::gb::IoMap::STAT) & 0x03) == 0x03);
+        ppu.step(172);
+        REQUIRE(ppu.mode() == cocoa::gb::PpuMode::HBlank);
+        ppu.step(204);
+        REQUIRE(ppu.mode() == cocoa::gb::PpuMode::OamScan);
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::LY) == 1);
+    }
+
+    SECTION("Request VBlank once per frame")
+    {
+        ppu.step(cocoa::gb::DOTS_PER_LINE * cocoa::gb::LCD_HEIGHT);
+        REQUIRE(ppu.mode() == cocoa::gb::PpuMode::VBlank);
+        REQUIRE(ppu.frames() == 1);
+        REQUIRE(cocoa::is_bit_set<uint8_t, 0>(bus.read_io_reg(cocoa::gb::IoMap::IF)));
+
+        ppu.step(cocoa::gb::DOTS_PER_LINE * 10);
+        REQUIRE(ppu.ly() == 0);
+        REQUIRE(ppu.mode() == cocoa::gb::PpuMode::OamScan);
+    }
+
+    SECTION("Request LCD interrupt on LY coincidence")
+    {
+        bus.write_io_reg(cocoa::gb::IoMap::LYC, 2);
+        bus.write_io_reg(cocoa::gb::IoMap::STAT, 0x40);
+        ppu.step(cocoa::gb::DOTS_PER_LINE);
+        REQUIRE_FALSE(cocoa::is_bit_set<uint8_t, 1>(bus.read_io_reg(cocoa::gb::IoMap::IF)));
+        ppu.step(cocoa::gb::DOTS_PER_LINE);
+        REQUIRE(cocoa::is_bit_set<uint8_t, 1>(bus.read_io_reg(cocoa::gb::IoMap::IF)));
+        REQUIRE(cocoa::is_bit_set<uint8_t, 2>(bus.read_io_reg(cocoa::gb::IoMap::STAT)));
+    }
+
+    SECTION("Park at LY 0 while LCD is off")
+    {
+        ppu.step(cocoa::gb::DOTS_PER_LINE * 5);
+        bus.write_io_reg(cocoa::gb::IoMap::LCDC, 0x11);
+        ppu.step(cocoa::gb::DOTS_PER_FRAME);
+        REQUIRE(ppu.ly() == 0);
+        REQUIRE(ppu.frames() == 0);
+        REQUIRE(ppu.mode() == cocoa::gb::PpuMode::HBlank);
+    }
+}
+
+TEST_CASE("const cocoa::gb::Framebuffer& cocoa::gb::Ppu::framebuffer() const", "[framebuffer]")
+{
+    cocoa::gb::MemoryBus bus {};
+    cocoa::gb::Ppu ppu(bus);
+
+    // Tile 1 has color 3 in its leftmost column only, while tile map stays on tile 0.
+    for (uint16_t row = 0; row < 8; ++row)
+        bus.write_word(static_cast<uint16_t>(0x8010 + row * 2), 0x8080);
+    bus.write_byte(0x9800, 0x01);
+    bus.write_io_reg(cocoa::gb::IoMap::BGP, 0xE4);
+    bus.write_io_reg(cocoa::gb::IoMap::OBP0, 0xE4);
+
+    SECTION("Render background with fine scroll")
+    {
+        bus.write_io_reg(cocoa::gb::IoMap::SCX, 0xFE);
+        bus.write_io_reg(cocoa::gb::IoMap::LCDC, 0x91);
+        ppu.step(cocoa::gb::DOTS_PER_LINE);
+        REQUIRE(ppu.framebuffer()[1] == 0);
+        REQUIRE(ppu.framebuffer()[2] == 3);
+        REQUIRE(ppu.framebuffer()[3] == 0);
+
+        bus.write_io_reg(cocoa::gb::IoMap::SCX, 0x00);
+        ppu.step(cocoa::gb::DOTS_PER_LINE);
+        REQUIRE(ppu.framebuffer()[cocoa::gb::LCD_WIDTH] == 3);
+        REQUIRE(ppu.framebuffer()[cocoa::gb::LCD_WIDTH + 1] == 0);
+    }
+
+    SECTION("Render flipped object above background")
+    {
+        bus.write_byte(0xFE00, 16);
+        bus.write_byte(0xFE01, 8 + 20);
+        bus.write_byte(0xFE02, 0x01);
+        bus.write_byte(0xFE03, 0x20);
+        bus.write_io_reg(cocoa::gb::IoMap::LCDC, 0x93);
+        ppu.step(cocoa::gb::DOTS_PER_LINE);
+        REQUIRE(ppu.framebuffer()[20] == 0);
+        REQUIRE(ppu.framebuffer()[27] == 3);
+        REQUIRE(ppu.framebuffer()[0] == 3);
+    }
+
+    SECTION("Hide object behind opaque background")
+    {
+        bus.write_byte(0xFE00, 16);
+        bus.write_byte(0xFE01, 8);
+        bus.write_byte(0xFE02, 0x01);
+        bus.write_byte(0xFE03, 0x90);
+        bus.write_io_reg(cocoa::gb::IoMap::OBP1, 0x00);
+        bus.write_io_reg(cocoa::gb::IoMap::LCDC, 0x93);
+        ppu.step(cocoa::gb::DOTS_PER_LINE);
+        REQUIRE(ppu.framebuffer()[0] == 3);
+    }
+
+    SECTION("Render window over background")
+    {
+        bus.write_byte(0x9C00, 0x01);
+        bus.write_io_reg(cocoa::gb::IoMap::WX, 7 + 40);
+        bus.write_io_reg(cocoa::gb::IoMap::WY, 0);
+        bus.write_io_reg(cocoa::gb::IoMap::LCDC, 0xF1);
+        ppu.step(cocoa::gb::DOTS_PER_LINE);
+        REQUIRE(ppu.framebuffer()[0] == 3);
+        REQUIRE(ppu.framebuffer()[40] == 3);
+        REQUIRE(ppu.framebuffer()[41] == 0);
+    }
+}
+
+TEST_CASE("cocoa::gb::Ppu::Ppu(MemoryBus&, const bool)", "[vbk]")
+{
+    cocoa::gb::MemoryBus bus {};
+    cocoa::gb::Ppu ppu(bus, true);
+    bus.write_byte(0x8000, 0x11);
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::VBK) == 0xFE);
+
+    bus.write_io_reg(cocoa::gb::IoMap::VBK, 0x01);
+    REQUIRE(ppu.vram_bank() == 1);
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::VBK) == 0xFF);
+    REQUIRE(bus.read_byte(0x8000) == 0x00);
+    bus.write_byte(0x9FFF, 0x22);
+
+    cocoa::gb::PpuSnapshot snapshot = {};
+    ppu.save_state(snapshot);
+    REQUIRE(snapshot.vram[0][0x0000] == 0x11);
+    REQUIRE(snapshot.vram[1][0x1FFF] == 0x22);
+
+    bus.write_io_reg(cocoa::gb::IoMap::VBK, 0x00);
+    REQUIRE(bus.read_byte(0x8000) == 0x11);
+    REQUIRE(bus.read_byte(0x9FFF) == 0x00);
+
+    ppu.load_state(snapshot);
+    REQUIRE(bus.read_byte(0x9FFF) == 0x22);
+}
@@ -0,0 +1,212 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "cocoa/gb/scheduler.hpp"
+#include "cocoa/utility.hpp"
+
+namespace cocoa::gb {
+// NOTE: Heap is rebuilt without stale entries once it grows past this many entries per source.
+constexpr size_t STALE_ENTRY_LIMIT = 8;
+
+Scheduler::Scheduler(const size_t& clock)
+    : m_clock(clock)
+    , m_clock_base(clock)
+    , m_peripheral_base(clock)
+    , m_double_speed(false)
+    , m_heap()
+    , m_sources {}
+    , m_sequence(0)
+{
+    m_heap.reserve(EVENT_KIND_COUNT * STALE_ENTRY_LIMIT);
+}
+
+void
+Scheduler::attach(const EventKind kind, const EventHandler handler)
+{
+    m_sources[from_enum(kind)].handler = handler;
+}
+
+void
+Scheduler::schedule(const EventKind kind, const size_t deadline)
+{
+    Source& source = m_sources[from_enum(kind)];
+    source.deadline = deadline;
+    source.sequence = m_sequence++;
+    source.pending = true;
+    ++source.generation;
+
+    m_heap.push_back({ deadline, source.sequence, source.generation, kind });
+    std::push_heap(m_heap.begin(), m_heap.end(), is_later);
+    prune();
+}
+
+void
+Scheduler::schedule_in(const EventKind kind, const size_t delay)
+{
+    schedule(kind, m_clock + delay);
+}
+
+void
+Scheduler::cancel(const EventKind kind)
+{
+    Source& source = m_sources[from_enum(kind)];
+    source.pending = false;
+    ++source.generation;
+    prune();
+}
+
+bool
+Scheduler::is_scheduled(const EventKind kind) const
+{
+    return m_sources[from_enum(kind)].pending;
+}
+
+size_t
+Scheduler::deadline(const EventKind kind) const
+{
+    const Source& source = m_sources[from_enum(kind)];
+    return source.pending ? source.deadline : NO_DEADLINE;
+}
+
+size_t
+Scheduler::next_deadline() const
+{
+    return m_heap.empty() ? NO_DEADLINE : m_heap.front().deadline;
+}
+
+size_t
+Scheduler::until_next_deadline() const
+{
+    const size_t deadline = next_deadline();
+    if (deadline == NO_DEADLINE)
+        return NO_DEADLINE;
+    return (deadline > m_clock) ? deadline - m_clock : 0;
+}
+
+size_t
+Scheduler::dispatch()
+{
+    size_t fired = 0;
+    while (!m_heap.empty() && m_heap.front().deadline <= m_clock) {
+        std::pop_heap(m_heap.begin(), m_heap.end(), is_later);
+        const Entry entry = m_heap.back();
+        m_heap.pop_back();
+
+        // INVARIANT: Source is marked idle before its handler runs, so handler can reschedule it.
+        Source& source = m_sources[from_enum(entry.kind)];
+        source.pending = false;
+        prune();
+        if (source.handler.fire)
+            source.handler.fire(source.handler.context, entry.deadline);
+        ++fired;
+    }
+
+    return fired;
+}
+
+size_t
+Scheduler::now() const
+{
+    return m_clock;
+}
+
+size_t
+Scheduler::peripheral_now() const
+{
+    return m_peripheral_base + ((m_clock - m_clock_base) >> (m_double_speed ? 1 : 0));
+}
+
+size_t
+Scheduler::peripheral_deadline(const size_t time) const
+{
+    return m_clock_base + ((time - m_peripheral_base) << (m_double_speed ? 1 : 0));
+}
+
+void
+Scheduler::set_double_speed(const bool enabled)
+{
+    m_peripheral_base = peripheral_now();
+    m_clock_base = m_clock;
+    m_double_speed = enabled;
+}
+
+bool
+Scheduler::is_double_speed() const
+{
+    return m_double_speed;
+}
+
+void
+Scheduler::save_state(SchedulerSnapshot& out) const
+{
+    for (size_t i = 0; i < EVENT_KIND_COUNT; ++i) {
+        out.deadlines[i] = m_sources[i].pending ? m_sources[i].deadline : NO_DEADLINE;
+        out.sequences[i] = m_sources[i].pending ? m_sources[i].sequence : 0;
+    }
+    out.clock_base = m_clock_base;
+    out.peripheral_base = m_peripheral_base;
+    out.double_speed = m_double_speed ? 1 : 0;
+    out.reserved = {};
+}
+
+void
+Scheduler::load_state(const SchedulerSnapshot& snapshot)
+{
+    m_clock_base = snapshot.clock_base;
+    m_peripheral_base = snapshot.peripheral_base;
+    m_double_speed = snapshot.double_speed != 0;
+
+    m_heap.clear();
+    m_sequence = 0;
+    for (size_t i = 0; i < EVENT_KIND_COUNT; ++i) {
+        Source& source = m_sources[i];
+        ++source.generation;
+        source.pending = snapshot.deadlines[i] != NO_DEADLINE;
+        if (!source.pending)
+            continue;
+
+        source.deadline = snapshot.deadlines[i];
+        source.sequence = snapshot.sequences[i];
+        m_sequence = std::max(m_sequence, source.sequence + 1);
+        m_heap.push_back(
+            { source.deadline, source.sequence, source.generation, static_cast<EventKind>(i) });
+    }
+    std::make_heap(m_heap.begin(), m_heap.end(), is_later);
+}
+
+bool
+Scheduler::is_later(const Entry& lhs, const Entry& rhs)
+{
+    if (lhs.deadline != rhs.deadline)
+        return lhs.deadline > rhs.deadline;
+    return lhs.sequence > rhs.sequence;
+}
+
+bool
+Scheduler::is_stale(const Entry& entry) const
+{
+    const Source& source = m_sources[from_enum(entry.kind)];
+    return !source.pending || source.generation != entry.generation;
+}
+
+void
+Scheduler::prune()
+{
+    if (m_heap.size() > EVENT_KIND_COUNT * STALE_ENTRY_LIMIT) {
+        m_heap.erase(std::remove_if(m_heap.begin(), m_heap.end(),
+                         [this](const Entry& entry) { return is_stale(entry); }),
+            m_heap.end());
+        std::make_heap(m_heap.begin(), m_heap.end(), is_later);
+    }
+
+    while (!m_heap.empty() && is_stale(m_heap.front())) {
+        std::pop_heap(m_heap.begin(), m_heap.end(), is_later);
+        m_heap.pop_back();
+    }
+}
+} // namespace cocoa::gb
@@ -0,0 +1,243 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_GB_SCHEDULER_HPP
+#define COCOA_GB_SCHEDULER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace cocoa::gb {
+/// @brief Sources of timed events.
+///
+/// Each source has at most one pending event at a time.
+enum class EventKind : uint8_t {
+    Ppu,
+    Timer,
+    Serial,
+};
+
+/// @brief Amount of event sources available.
+constexpr size_t EVENT_KIND_COUNT = 3;
+
+/// @brief Deadline reported when no event is pending.
+constexpr size_t NO_DEADLINE = std::numeric_limits<size_t>::max();
+
+/// @brief Plain image of pending events stored in save states.
+///
+/// @invariant Fields are fixed width and explicitly padded, so layout is identical across builds.
+struct SchedulerSnapshot final {
+    /// Deadline per source, or `NO_DEADLINE` if source has no pending event.
+    std::array<uint64_t, EVENT_KIND_COUNT> deadlines;
+
+    /// Posting order per source, which breaks ties between equal deadlines.
+    std::array<uint64_t, EVENT_KIND_COUNT> sequences;
+
+    /// CPU and peripheral time at which speed was last switched.
+    uint64_t clock_base;
+    uint64_t peripheral_base;
+
+    uint8_t double_speed;
+    std::array<uint8_t, 7> reserved;
+};
+
+static_assert(sizeof(SchedulerSnapshot) == 2 * 8 * EVENT_KIND_COUNT + 24);
+
+/// @brief Callback servicing an event once its deadline is reached.
+///
+/// Deadline is passed along, because events are dispatched at instruction boundaries and thus
+/// usually a few t-states late. Periodic sources should schedule their next event relative to
+/// deadline rather than to current time, so lateness never accumulates.
+struct EventHandler final {
+    void (*fire)(void* context, size_t deadline) = nullptr;
+    void* context = nullptr;
+};
+
+/// @brief Timestamped event queue driving peripherals.
+///
+/// Peripherals post events for the t-state at which they next need to act, e.g., PPU changing
+/// mode, TIMA overflowing, or serial finishing a shift. CPU then runs in bulk until the earliest
+/// deadline, after which every due event is dispatched in deadline order. Nothing gets ticked per
+/// m-cycle.
+///
+/// Events live in a binary min-heap keyed by deadline. Rescheduling or cancelling an event does
+/// not search the heap. It bumps generation of event source instead, so stale heap entries are
+/// discarded once they surface at top.
+///
+/// Time is read from a clock owned elsewhere, i.e., t-state counter of CPU, so scheduler never
+/// needs to be told that time has passed.
+///
+/// Deadlines are always in CPU t-states. Peripherals clocked independently of CPU speed, i.e., PPU
+/// and APU, read peripheral time instead, which equals CPU time at normal speed, but only advances
+/// by half of the CPU t-states in CGB double speed mode. Peripheral time is derived from CPU time
+/// relative to the point speed last switched at, so CPU never converts anything while it runs.
+class Scheduler final {
+public:
+    /// @brief Construct empty event queue.
+    ///
+    /// @param [in] clock Global t-state counter, which must outlive scheduler.
+    explicit Scheduler(const size_t& clock);
+
+    Scheduler(const Scheduler&) = delete;
+
+    Scheduler&
+    operator=(const Scheduler&) = delete;
+
+    ~Scheduler() noexcept = default;
+
+    /// @brief Attach handler to event source.
+    ///
+    /// @param [in] kind Event source.
+    /// @param [in] handler Callback to fire once event of source is due.
+    void
+    attach(const EventKind kind, const EventHandler handler);
+
+    /// @brief Post event at absolute t-state.
+    ///
+    /// Replaces any pending event of the same source.
+    ///
+    /// @param [in] kind Event source.
+    /// @param [in] deadline T-state to fire event at.
+    void
+    schedule(const EventKind kind, const size_t deadline);
+
+    /// @brief Post event relative to current time.
+    ///
+    /// @param [in] kind Event source.
+    /// @param [in] delay Amount of t-states from now to fire event at.
+    void
+    schedule_in(const EventKind kind, const size_t delay);
+
+    /// @brief Drop pending event of source, if any.
+    ///
+    /// @param [in] kind Event source.
+    void
+    cancel(const EventKind kind);
+
+    /// @brief Check if source has a pending event.
+    [[nodiscard]]
+    bool
+    is_scheduled(const EventKind kind) const;
+
+    /// @brief Get deadline of pending event of source.
+    ///
+    /// @return Deadline of event, or `NO_DEADLINE` if source has no pending event.
+    [[nodiscard]]
+    size_t
+    deadline(const EventKind kind) const;
+
+    /// @brief Get earliest deadline across all sources.
+    ///
+    /// @return Earliest deadline, or `NO_DEADLINE` if no event is pending.
+    [[nodiscard]]
+    size_t
+    next_deadline() const;
+
+    /// @brief Get amount of t-states until earliest deadline.
+    ///
+    /// @return Zero if an event is already due, or `NO_DEADLINE` if no event is pending.
+    [[nodiscard]]
+    size_t
+    until_next_deadline() const;
+
+    /// @brief Fire every event that is due by now, in deadline order.
+    ///
+    /// Events with equal deadlines fire in the order they were posted. Handlers may post new
+    /// events, and those that are already due fire within the same call.
+    ///
+    /// @return Amount of events fired.
+    size_t
+    dispatch();
+
+    /// @brief Get current time.
+    [[nodiscard]]
+    size_t
+    now() const;
+
+    /// @brief Get current peripheral time, i.e., t-states of the 4 MiHz system clock.
+    [[nodiscard]]
+    size_t
+    peripheral_now() const;
+
+    /// @brief Convert point in peripheral time to deadline in CPU t-states.
+    ///
+    /// @param [in] time Peripheral time, which must not lie before last speed switch.
+    /// @return CPU t-state at which peripheral time is reached at current speed.
+    [[nodiscard]]
+    size_t
+    peripheral_deadline(const size_t time) const;
+
+    /// @brief Switch CPU between normal and CGB double speed.
+    ///
+    /// Pending deadlines are kept as they are, so sources posting in peripheral time must repost
+    /// their events afterwards.
+    ///
+    /// @param [in] enabled Run CPU at double speed.
+    void
+    set_double_speed(const bool enabled);
+
+    [[nodiscard]]
+    bool
+    is_double_speed() const;
+
+    /// @brief Capture pending events for save state.
+    ///
+    /// @param [out] out Snapshot to fill.
+    void
+    save_state(SchedulerSnapshot& out) const;
+
+    /// @brief Replace pending events with those of save state.
+    ///
+    /// Handlers stay attached as they are.
+    ///
+    /// @param [in] snapshot Snapshot to restore from.
+    void
+    load_state(const SchedulerSnapshot& snapshot);
+
+private:
+    struct Entry final {
+        size_t deadline;
+        uint64_t sequence;
+        uint32_t generation;
+        EventKind kind;
+    };
+
+    struct Source final {
+        EventHandler handler;
+        size_t deadline;
+        uint64_t sequence;
+        uint32_t generation;
+        bool pending;
+    };
+
+    [[nodiscard]]
+    static bool
+    is_later(const Entry& lhs, const Entry& rhs);
+
+    [[nodiscard]]
+    bool
+    is_stale(const Entry& entry) const;
+
+    /// @brief Pop stale entries off top of heap, or rebuild heap once mostly stale.
+    ///
+    /// @invariant Top of heap is always a live entry afterwards, if any.
+    void
+    prune();
+
+    const size_t& m_clock;
+
+    /// CPU and peripheral time at which speed was last switched.
+    size_t m_clock_base;
+    size_t m_peripheral_base;
+    bool m_double_speed;
+
+    std::vector<Entry> m_heap;
+    std::array<Source, EVENT_KIND_COUNT> m_sources;
+    uint64_t m_sequence;
+};
+} // namespace cocoa::gb
+
+#endif // COCOA_GB_SCHEDULER_HPP
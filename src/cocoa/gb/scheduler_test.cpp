@@ -0,0 +1,161 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "cocoa/gb/scheduler.hpp"
+
+/// @brief Record of fired events shared by test handlers.
+struct FireLog final {
+    std::vector<cocoa::gb::EventKind> kinds;
+    std::vector<size_t> deadlines;
+};
+
+static void
+on_ppu(void* context, size_t deadline)
+{
+    FireLog* log = static_cast<FireLog*>(context);
+    log->kinds.push_back(cocoa::gb::EventKind::Ppu);
+    log->deadlines.push_back(deadline);
+}
+
+static void
+on_serial(void* context, size_t deadline)
+{
+    FireLog* log = static_cast<FireLog*>(context);
+    log->kinds.push_back(cocoa::gb::EventKind::Serial);
+    log->deadlines.push_back(deadline);
+}
+
+TEST_CASE("size_t cocoa::gb::Scheduler::dispatch()", "[dispatch]")
+{
+    size_t clock = 0;
+    FireLog log {};
+    cocoa::gb::Scheduler scheduler(clock);
+    scheduler.attach(cocoa::gb::EventKind::Ppu, { on_ppu, &log });
+    scheduler.attach(cocoa::gb::EventKind::Serial, { on_serial, &log });
+
+    SECTION("Fire due events in deadline order")
+    {
+        scheduler.schedule(cocoa::gb::EventKind::Serial, 100);
+        scheduler.schedule_in(cocoa::gb::EventKind::Ppu, 40);
+        REQUIRE(scheduler.next_deadline() == 40);
+        REQUIRE(scheduler.until_next_deadline() == 40);
+
+        clock = 39;
+        REQUIRE(scheduler.dispatch() == 0);
+
+        clock = 120;
+        REQUIRE(scheduler.until_next_deadline() == 0);
+        REQUIRE(scheduler.dispatch() == 2);
+        REQUIRE(log.kinds
+            == std::vector { cocoa::gb::EventKind::Ppu, cocoa::gb::EventKind::Serial });
+        REQUIRE(log.deadlines == std::vector<size_t> { 40, 100 });
+        REQUIRE(scheduler.next_deadline() == cocoa::gb::NO_DEADLINE);
+        REQUIRE(scheduler.until_next_deadline() == cocoa::gb::NO_DEADLINE);
+    }
+
+    SECTION("Fire equal deadlines in posting order")
+    {
+        scheduler.schedule(cocoa::gb::EventKind::Serial, 8);
+        scheduler.schedule(cocoa::gb::EventKind::Ppu, 8);
+        clock = 8;
+        REQUIRE(scheduler.dispatch() == 2);
+        REQUIRE(log.kinds
+            == std::vector { cocoa::gb::EventKind::Serial, cocoa::gb::EventKind::Ppu });
+    }
+
+    SECTION("Replace pending event when rescheduled")
+    {
+        scheduler.schedule(cocoa::gb::EventKind::Ppu, 10);
+        scheduler.schedule(cocoa::gb::EventKind::Ppu, 50);
+        REQUIRE(scheduler.deadline(cocoa::gb::EventKind::Ppu) == 50);
+        REQUIRE(scheduler.next_deadline() == 50);
+
+        clock = 60;
+        REQUIRE(scheduler.dispatch() == 1);
+        REQUIRE(log.deadlines == std::vector<size_t> { 50 });
+    }
+
+    SECTION("Drop cancelled events")
+    {
+        scheduler.schedule(cocoa::gb::EventKind::Ppu, 10);
+        scheduler.schedule(cocoa::gb::EventKind::Serial, 20);
+        scheduler.cancel(cocoa::gb::EventKind::Ppu);
+        REQUIRE(!scheduler.is_scheduled(cocoa::gb::EventKind::Ppu));
+        REQUIRE(scheduler.deadline(cocoa::gb::EventKind::Ppu) == cocoa::gb::NO_DEADLINE);
+        REQUIRE(scheduler.next_deadline() == 20);
+
+        clock = 30;
+        REQUIRE(scheduler.dispatch() == 1);
+        REQUIRE(log.kinds == std::vector { cocoa::gb::EventKind::Serial });
+    }
+
+    SECTION("Stay bounded under heavy rescheduling")
+    {
+        for (size_t i = 0; i < 10000; ++i)
+            scheduler.schedule(cocoa::gb::EventKind::Ppu, 10000 - i);
+        REQUIRE(scheduler.next_deadline() == 1);
+
+        clock = 10000;
+        REQUIRE(scheduler.dispatch() == 1);
+        REQUIRE(log.deadlines == std::vector<size_t> { 1 });
+    }
+}
+
+/// @brief Periodic handler that reposts itself relative to its deadline.
+static void
+on_periodic(void* context, size_t deadline)
+{
+    cocoa::gb::Scheduler* scheduler = static_cast<cocoa::gb::Scheduler*>(context);
+    scheduler->schedule(cocoa::gb::EventKind::Ppu, deadline + 10);
+}
+
+TEST_CASE("void cocoa::gb::Scheduler::schedule(const EventKind, const size_t)", "[schedule]")
+{
+    size_t clock = 0;
+    cocoa::gb::Scheduler scheduler(clock);
+    scheduler.attach(cocoa::gb::EventKind::Ppu, { on_periodic, &scheduler });
+    scheduler.schedule(cocoa::gb::EventKind::Ppu, 10);
+
+    // NOTE: Dispatching late must not accumulate drift for periodic events.
+    clock = 35;
+    REQUIRE(scheduler.dispatch() == 3);
+    REQUIRE(scheduler.next_deadline() == 40);
+    REQUIRE(scheduler.is_scheduled(cocoa::gb::EventKind::Ppu));
+}
+
+TEST_CASE("void cocoa::gb::Scheduler::set_double_speed(const bool)", "[set_double_speed]")
+{
+    size_t clock = 100;
+    cocoa::gb::Scheduler scheduler(clock);
+    REQUIRE(scheduler.peripheral_now() == 100);
+    REQUIRE(scheduler.peripheral_deadline(150) == 150);
+
+    scheduler.set_double_speed(true);
+    REQUIRE(scheduler.is_double_speed());
+    clock = 140;
+    REQUIRE(scheduler.peripheral_now() == 120);
+    REQUIRE(scheduler.peripheral_deadline(150) == 200);
+
+    SECTION("Keep peripheral time continuous across switches")
+    {
+        scheduler.set_double_speed(false);
+        clock = 150;
+        REQUIRE(scheduler.peripheral_now() == 130);
+        REQUIRE(scheduler.peripheral_deadline(150) == 170);
+    }
+
+    SECTION("Restore time base from save state")
+    {
+        cocoa::gb::SchedulerSnapshot snapshot = {};
+        scheduler.save_state(snapshot);
+        cocoa::gb::Scheduler other(clock);
+        other.load_state(snapshot);
+        REQUIRE(other.is_double_speed());
+        REQUIRE(other.peripheral_now() == 120);
+    }
+}
@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "cocoa/gb/interrupt.hpp"
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/scheduler.hpp"
+#include "cocoa/gb/serial.hpp"
+#include "cocoa/utility.hpp"
+
+namespace cocoa::gb {
+Serial::Serial(MemoryBus& bus, Scheduler& scheduler)
+    : m_bus(bus)
+    , m_scheduler(scheduler)
+    , m_output()
+{
+    m_bus.map_io_handler(IoMap::SC, { nullptr, on_write_sc, this });
+    m_scheduler.attach(EventKind::Serial, { on_transfer_done, this });
+}
+
+const std::string&
+Serial::output() const
+{
+    return m_output;
+}
+
+void
+Serial::on_write_sc(void* context, uint16_t address, uint8_t value)
+{
+    Serial* serial = static_cast<Serial*>(context);
+    serial->m_bus.poke(address, value);
+    if (!is_bit_set<uint8_t, 7>(value) || !is_bit_set<uint8_t, 0>(value)) {
+        serial->m_scheduler.cancel(EventKind::Serial);
+        return;
+    }
+
+    serial->m_output.push_back(static_cast<char>(serial->m_bus.peek(from_enum(IoMap::SB))));
+    serial->m_scheduler.schedule_in(EventKind::Serial, SERIAL_TRANSFER_TSTATES);
+}
+
+void
+Serial::on_transfer_done(void* context, size_t)
+{
+    Serial* serial = static_cast<Serial*>(context);
+    const uint16_t sc = from_enum(IoMap::SC);
+    serial->m_bus.poke(from_enum(IoMap::SB), 0xFF);
+    serial->m_bus.poke(sc, static_cast<uint8_t>(serial->m_bus.peek(sc) & 0x7F));
+    request_interrupt<Interrupt::Serial>(serial->m_bus);
+}
+} // namespace cocoa::gb
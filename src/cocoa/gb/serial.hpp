@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_GB_SERIAL_HPP
+#define COCOA_GB_SERIAL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/scheduler.hpp"
+
+namespace cocoa::gb {
+/// @brief Amount of t-states needed to shift one byte out on internal clock, i.e., 8192 Hz.
+constexpr size_t SERIAL_TRANSFER_TSTATES = 4096;
+
+/// @brief GameBoy serial port without a link partner.
+///
+/// Transfers started on internal clock complete after `SERIAL_TRANSFER_TSTATES` through a
+/// scheduled event, as if no cable is connected, i.e., 0xFF is shifted in. Every byte shifted out
+/// is captured as soon as its transfer starts, since test ROMs report their results over serial.
+///
+/// @see https://gbdev.io/pandocs/Serial_Data_Transfer_(Link_Cable).html
+class Serial final {
+public:
+    /// @brief Attach serial port to SB and SC registers of memory bus.
+    ///
+    /// @param [in] bus Memory bus to attach to.
+    /// @param [in] scheduler Scheduler to post transfer completion to.
+    Serial(MemoryBus& bus, Scheduler& scheduler);
+
+    Serial(const Serial&) = delete;
+
+    Serial&
+    operator=(const Serial&) = delete;
+
+    ~Serial() noexcept = default;
+
+    /// @brief Get every byte shifted out so far.
+    [[nodiscard]]
+    const std::string&
+    output() const;
+
+private:
+    static void
+    on_write_sc(void* context, uint16_t address, uint8_t value);
+
+    static void
+    on_transfer_done(void* context, size_t deadline);
+
+    MemoryBus& m_bus;
+    Scheduler& m_scheduler;
+    std::string m_output;
+};
+} // namespace cocoa::gb
+
+#endif // COCOA_GB_SERIAL_HPP
@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/scheduler.hpp"
+#include "cocoa/gb/serial.hpp"
+#include "cocoa/utility.hpp"
+
+TEST_CASE("const std::string& cocoa::gb::Serial::output() const", "[output]")
+{
+    size_t clock = 0;
+    cocoa::gb::MemoryBus bus {};
+    cocoa::gb::Scheduler scheduler(clock);
+    cocoa::gb::Serial serial(bus, scheduler);
+
+    bus.write_io_reg(cocoa::gb::IoMap::SB, 'O');
+    bus.write_io_reg(cocoa::gb::IoMap::SC, 0x80);
+    REQUIRE(serial.output().empty());
+    REQUIRE(!scheduler.is_scheduled(cocoa::gb::EventKind::Serial));
+
+    bus.write_io_reg(cocoa::gb::IoMap::SC, 0x81);
+    REQUIRE(serial.output() == "O");
+    clock += cocoa::gb::SERIAL_TRANSFER_TSTATES;
+    REQUIRE(scheduler.dispatch() == 1);
+
+    bus.write_io_reg(cocoa::gb::IoMap::SB, 'K');
+    bus.write_io_reg(cocoa::gb::IoMap::SC, 0x81);
+    REQUIRE(serial.output() == "OK");
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::SC) == 0x81);
+
+    clock += cocoa::gb::SERIAL_TRANSFER_TSTATES - 1;
+    REQUIRE(scheduler.dispatch() == 0);
+    clock += 1;
+    REQUIRE(scheduler.dispatch() == 1);
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::SB) == 0xFF);
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::SC) == 0x01);
+    REQUIRE(cocoa::is_bit_set<uint8_t, 3>(bus.read_io_reg(cocoa::gb::IoMap::IF)));
+}
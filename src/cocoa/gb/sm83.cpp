@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #include <array>
+#include <bitset>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -111,7 +112,7 @@ enum Load : uint8_t {
 enum Stack : uint8_t {
     AddRegHLRegSP = 0x39,
     AddRegSPOffset = 0xE8,
-    DecRegSP = 0x38,
+    DecRegSP = 0x3B,
     IncRegSP = 0x33,
     IndirImm16RegSP = 0x08,
     RegSPImm16 = 0x31,
@@ -516,7 +517,7 @@ enum CtrlFlow : uint8_t {
     CallNZImm16 = 0xC4,
     CallNCImm16 = 0xD4,
     CallZImm16 = 0xCC,
-    CallCImm16 = 0xEC,
+    CallCImm16 = 0xDC,
     Return = 0xC9,
     ReturnNZ = 0xC0,
     ReturnNC = 0xD0,
@@ -535,22 +536,22 @@ enum CtrlFlow : uint8_t {
 
 enum Misc : uint8_t {
     Nop = 0x00,
-    Stop = 0x01,
+    Stop = 0x10,
     Halt = 0x76,
     DisableIR = 0xF3,
-    EnableIR = 0xF8,
+    EnableIR = 0xFB,
     Prefix = 0xCB,
     Illegal0 = 0xD3,
-    Illegal1 = 0xE3,
-    Illegal2 = 0xE4,
-    Illegal3 = 0xF4,
-    Illegal4 = 0xDB,
+    Illegal1 = 0xDB,
+    Illegal2 = 0xDD,
+    Illegal3 = 0xE3,
+    Illegal4 = 0xE4,
     Illegal5 = 0xEB,
     Illegal6 = 0xEC,
-    Illegal7 = 0xEF,
-    Illegal8 = 0xDD,
-    Illegal9 = 0xDE,
-    IllegalA = 0xDF,
+    Illegal7 = 0xED,
+    Illegal8 = 0xF4,
+    Illegal9 = 0xFC,
+    IllegalA = 0xFD,
 };
 
 enum class Operation {
@@ -698,9 +699,7 @@ inc(Sm83State& cpu)
     uint8_t operand = cpu.load_reg8<Dst>();
     uint8_t result = operand + 1;
     cpu.store_reg8<Dst>(result);
-    cpu.conditional_flag_toggle<Flag::Z>(result == 0);
-    cpu.clear_flag<Flag::N>();
-    cpu.conditional_flag_toggle<Flag::H>(is_half_carry<Operation::Add>(operand, 1));
+    cpu.record_flags<FlagOp::Inc>(result, operand, 1, cpu.is_flag_set<Flag::C>());
 }
 
 template <enum Reg8 Dst>
@@ -710,9 +709,7 @@ dec(Sm83State& cpu)
     uint8_t operand = cpu.load_reg8<Dst>();
     uint8_t result = operand - 1;
     cpu.store_reg8<Dst>(result);
-    cpu.conditional_flag_toggle<Flag::Z>(result == 0);
-    cpu.set_flag<Flag::N>();
-    cpu.conditional_flag_toggle<Flag::H>(is_half_carry<Operation::Sub>(operand, 1));
+    cpu.record_flags<FlagOp::Dec>(result, operand, 1, cpu.is_flag_set<Flag::C>());
 }
 
 template <enum Reg16 Dst>
@@ -733,10 +730,8 @@ static inline constexpr void
 add_update_flags(
     Sm83State& cpu, const uint8_t result, const uint8_t operand1, const uint8_t operand2)
 {
-    cpu.conditional_flag_toggle<Flag::Z>(result == 0);
-    cpu.clear_flag<Flag::N>();
-    cpu.conditional_flag_toggle<Flag::H>(is_half_carry<Operation::Add>(operand1, operand2));
-    cpu.conditional_flag_toggle<Flag::C>(is_carry<Operation::Add>(result, operand1));
+    cpu.record_flags<FlagOp::Add>(
+        result, operand1, operand2, is_carry<Operation::Add>(result, operand1));
 }
 
 template <enum Reg8 Src, enum UseCarry C>
@@ -777,10 +772,8 @@ static inline constexpr void
 sub_update_flags(
     Sm83State& cpu, const uint8_t result, const uint8_t operand1, const uint8_t operand2)
 {
-    cpu.conditional_flag_toggle<Flag::Z>(result == 0);
-    cpu.set_flag<Flag::N>();
-    cpu.conditional_flag_toggle<Flag::H>(is_half_carry<Operation::Sub>(operand1, operand2));
-    cpu.conditional_flag_toggle<Flag::C>(is_carry<Operation::Sub>(result, operand1));
+    cpu.record_flags<FlagOp::Sub>(
+        result, operand1, operand2, is_carry<Operation::Sub>(result, operand1));
 }
 
 template <enum Reg8 Src, enum UseCarry C>
@@ -846,10 +839,7 @@ add_hl(Sm83State& cpu)
 static inline constexpr void
 and_update_flags(Sm83State& cpu, const uint8_t result)
 {
-    cpu.conditional_flag_toggle<Flag::Z>(result == 0);
-    cpu.clear_flag<Flag::N>();
-    cpu.set_flag<Flag::H>();
-    cpu.clear_flag<Flag::C>();
+    cpu.record_flags<FlagOp::And>(result);
 }
 
 template <enum Reg8 Src>
@@ -875,10 +865,7 @@ and_a(Sm83State& cpu)
 static inline constexpr void
 or_xor_update_flags(Sm83State& cpu, const uint8_t result)
 {
-    cpu.conditional_flag_toggle<Flag::Z>(result == 0);
-    cpu.clear_flag<Flag::N>();
-    cpu.clear_flag<Flag::H>();
-    cpu.clear_flag<Flag::C>();
+    cpu.record_flags<FlagOp::OrXor>(result);
 }
 
 template <enum Reg8 Src>
@@ -1012,13 +999,12 @@ rotate(Sm83State& cpu)
 
     if constexpr (Z == UseZero::No) {
         cpu.clear_flag<Flag::Z>();
+        cpu.clear_flag<Flag::N>();
+        cpu.clear_flag<Flag::H>();
+        cpu.conditional_flag_toggle<Flag::C>(carry == 1);
     } else {
-        cpu.conditional_flag_toggle<Flag::Z>(result == 0);
+        cpu.record_flags<FlagOp::Shift>(result, 0, 0, carry == 1);
     }
-
-    cpu.clear_flag<Flag::N>();
-    cpu.clear_flag<Flag::H>();
-    cpu.conditional_flag_toggle<Flag::C>(carry == 1);
 }
 
 template <enum Reg8 Dst, enum Direction D, enum Shift S>
@@ -1044,10 +1030,7 @@ shift(Sm83State& cpu)
     }
 
     cpu.store_reg8<Dst>(result);
-    cpu.conditional_flag_toggle<Flag::Z>(result == 0);
-    cpu.clear_flag<Flag::N>();
-    cpu.clear_flag<Flag::H>();
-    cpu.conditional_flag_toggle<Flag::C>(carry == 1);
+    cpu.record_flags<FlagOp::Shift>(result, 0, 0, carry == 1);
 }
 
 template <enum Reg8 Dst>
@@ -1057,10 +1040,7 @@ swap(Sm83State& cpu)
     uint8_t result = cpu.load_reg8<Dst>();
     result = static_cast<uint8_t>((result << 4) | (result >> 4));
     cpu.store_reg8<Dst>(result);
-    cpu.conditional_flag_toggle<Flag::Z>(result == 0);
-    cpu.clear_flag<Flag::N>();
-    cpu.clear_flag<Flag::H>();
-    cpu.clear_flag<Flag::C>();
+    cpu.record_flags<FlagOp::OrXor>(result);
 }
 
 template <size_t Bit, enum Reg8 Src>
@@ -1119,7 +1099,7 @@ static void
 jump_rel_imm8(Sm83State& cpu)
 {
     int8_t offset = static_cast<int8_t>(cpu.load_imm8<Imm8::Direct>());
-    cpu.pc = static_cast<uint8_t>(cpu.pc + offset);
+    cpu.pc = static_cast<uint16_t>(cpu.pc + offset);
 }
 
 template <enum Condition C>
@@ -1128,7 +1108,7 @@ jump_cond_rel_imm8(Sm83State& cpu)
 {
     int8_t offset = static_cast<int8_t>(cpu.load_imm8<Imm8::Direct>());
     if (cpu.is_condition_set<C>()) {
-        cpu.pc = static_cast<uint8_t>(cpu.pc + offset);
+        cpu.pc = static_cast<uint16_t>(cpu.pc + offset);
         cpu.mcycles += 1;
         cpu.tstates += 4;
     }
@@ -1227,649 +1207,772 @@ disable_interrupt(Sm83State& cpu)
     cpu.ime = false;
 }
 
-constexpr std::array<Instruction, NO_PREFIX_INSTR_TABLE_SIZE>
+/// @brief Full definition of instruction.
+///
+/// Only used to build instruction tables at compile time, where it is split into hot `Instruction`
+/// and cold `InstructionInfo` halves.
+struct InstructionDef final {
+    std::string_view mnemonic;
+    uint8_t length;
+    uint8_t mcycles;
+    void (*execute)(Sm83State&) = nullptr;
+};
+
+constexpr std::array<InstructionDef, NO_PREFIX_INSTR_TABLE_SIZE>
 new_no_prefix_instr()
 {
-    std::array<Instruction, NO_PREFIX_INSTR_TABLE_SIZE> instr = {};
-    instr[Load::RegBRegB] = Instruction { "LD B, B", 1, 1, 4, load<Reg8::B, Reg8::B> };
-    instr[Load::RegBRegC] = Instruction { "LD B, C", 1, 1, 4, load<Reg8::B, Reg8::C> };
-    instr[Load::RegBRegD] = Instruction { "LD B, D", 1, 1, 4, load<Reg8::B, Reg8::D> };
-    instr[Load::RegBRegE] = Instruction { "LD B, E", 1, 1, 4, load<Reg8::B, Reg8::E> };
-    instr[Load::RegBRegH] = Instruction { "LD B, H", 1, 1, 4, load<Reg8::B, Reg8::H> };
-    instr[Load::RegBRegL] = Instruction { "LD B, L", 1, 1, 4, load<Reg8::B, Reg8::L> };
-    instr[Load::RegBRegA] = Instruction { "LD C, A", 1, 1, 4, load<Reg8::B, Reg8::A> };
-    instr[Load::RegCRegB] = Instruction { "LD C, B", 1, 1, 4, load<Reg8::C, Reg8::B> };
-    instr[Load::RegCRegC] = Instruction { "LD C, C", 1, 1, 4, load<Reg8::C, Reg8::C> };
-    instr[Load::RegCRegD] = Instruction { "LD C, D", 1, 1, 4, load<Reg8::C, Reg8::D> };
-    instr[Load::RegCRegE] = Instruction { "LD C, E", 1, 1, 4, load<Reg8::C, Reg8::E> };
-    instr[Load::RegCRegH] = Instruction { "LD C, H", 1, 1, 4, load<Reg8::C, Reg8::H> };
-    instr[Load::RegCRegL] = Instruction { "LD C, L", 1, 1, 4, load<Reg8::C, Reg8::L> };
-    instr[Load::RegCRegA] = Instruction { "LD C, A", 1, 1, 4, load<Reg8::C, Reg8::A> };
-    instr[Load::RegDRegB] = Instruction { "LD D, B", 1, 1, 4, load<Reg8::D, Reg8::B> };
-    instr[Load::RegDRegC] = Instruction { "LD D, C", 1, 1, 4, load<Reg8::D, Reg8::C> };
-    instr[Load::RegDRegD] = Instruction { "LD D, D", 1, 1, 4, load<Reg8::D, Reg8::D> };
-    instr[Load::RegDRegE] = Instruction { "LD D, E", 1, 1, 4, load<Reg8::D, Reg8::E> };
-    instr[Load::RegDRegH] = Instruction { "LD D, H", 1, 1, 4, load<Reg8::D, Reg8::H> };
-    instr[Load::RegDRegL] = Instruction { "LD D, L", 1, 1, 4, load<Reg8::D, Reg8::L> };
-    instr[Load::RegDRegA] = Instruction { "LD D, A", 1, 1, 4, load<Reg8::D, Reg8::A> };
-    instr[Load::RegERegB] = Instruction { "LD E, B", 1, 1, 4, load<Reg8::E, Reg8::B> };
-    instr[Load::RegERegC] = Instruction { "LD E, C", 1, 1, 4, load<Reg8::E, Reg8::C> };
-    instr[Load::RegERegD] = Instruction { "LD E, D", 1, 1, 4, load<Reg8::E, Reg8::D> };
-    instr[Load::RegERegE] = Instruction { "LD E, E", 1, 1, 4, load<Reg8::E, Reg8::E> };
-    instr[Load::RegERegH] = Instruction { "LD E, H", 1, 1, 4, load<Reg8::E, Reg8::H> };
-    instr[Load::RegERegL] = Instruction { "LD E, L", 1, 1, 4, load<Reg8::E, Reg8::L> };
-    instr[Load::RegERegA] = Instruction { "LD E, A", 1, 1, 4, load<Reg8::E, Reg8::A> };
-    instr[Load::RegHRegB] = Instruction { "LD H, B", 1, 1, 4, load<Reg8::H, Reg8::B> };
-    instr[Load::RegHRegC] = Instruction { "LD H, C", 1, 1, 4, load<Reg8::H, Reg8::C> };
-    instr[Load::RegHRegD] = Instruction { "LD H, D", 1, 1, 4, load<Reg8::H, Reg8::D> };
-    instr[Load::RegHRegE] = Instruction { "LD H, E", 1, 1, 4, load<Reg8::H, Reg8::E> };
-    instr[Load::RegHRegH] = Instruction { "LD H, H", 1, 1, 4, load<Reg8::H, Reg8::H> };
-    instr[Load::RegHRegL] = Instruction { "LD H, L", 1, 1, 4, load<Reg8::H, Reg8::L> };
-    instr[Load::RegHRegA] = Instruction { "LD H, A", 1, 1, 4, load<Reg8::H, Reg8::A> };
-    instr[Load::RegLRegB] = Instruction { "LD L, B", 1, 1, 4, load<Reg8::L, Reg8::B> };
-    instr[Load::RegLRegC] = Instruction { "LD L, C", 1, 1, 4, load<Reg8::L, Reg8::C> };
-    instr[Load::RegLRegD] = Instruction { "LD L, D", 1, 1, 4, load<Reg8::L, Reg8::D> };
-    instr[Load::RegLRegE] = Instruction { "LD L, E", 1, 1, 4, load<Reg8::L, Reg8::E> };
-    instr[Load::RegLRegH] = Instruction { "LD L, H", 1, 1, 4, load<Reg8::L, Reg8::H> };
-    instr[Load::RegLRegL] = Instruction { "LD L, L", 1, 1, 4, load<Reg8::L, Reg8::L> };
-    instr[Load::RegLRegA] = Instruction { "LD L, A", 1, 1, 4, load<Reg8::L, Reg8::A> };
-    instr[Load::RegARegB] = Instruction { "LD A, B", 1, 1, 4, load<Reg8::A, Reg8::B> };
-    instr[Load::RegARegC] = Instruction { "LD A, C", 1, 1, 4, load<Reg8::A, Reg8::C> };
-    instr[Load::RegARegD] = Instruction { "LD A, D", 1, 1, 4, load<Reg8::A, Reg8::D> };
-    instr[Load::RegARegE] = Instruction { "LD A, E", 1, 1, 4, load<Reg8::A, Reg8::E> };
-    instr[Load::RegARegH] = Instruction { "LD A, H", 1, 1, 4, load<Reg8::A, Reg8::H> };
-    instr[Load::RegARegL] = Instruction { "LD A, L", 1, 1, 4, load<Reg8::A, Reg8::L> };
-    instr[Load::RegARegA] = Instruction { "LD A, A", 1, 1, 4, load<Reg8::A, Reg8::A> };
-    instr[Load::RegBImm8] = Instruction { "LD B, n8", 2, 2, 8, load<Reg8::B, Imm8::Direct> };
-    instr[Load::RegCImm8] = Instruction { "LD C, n8", 2, 2, 8, load<Reg8::C, Imm8::Direct> };
-    instr[Load::RegDImm8] = Instruction { "LD D, n8", 2, 2, 8, load<Reg8::D, Imm8::Direct> };
-    instr[Load::RegEImm8] = Instruction { "LD E, n8", 2, 2, 8, load<Reg8::E, Imm8::Direct> };
-    instr[Load::RegHImm8] = Instruction { "LD H, n8", 2, 2, 8, load<Reg8::H, Imm8::Direct> };
-    instr[Load::RegLImm8] = Instruction { "LD L, n8", 2, 2, 8, load<Reg8::L, Imm8::Direct> };
-    instr[Load::RegAImm8] = Instruction { "LD A, n8", 2, 2, 8, load<Reg8::A, Imm8::Direct> };
-    instr[Load::RegBIndirHL] = Instruction { "LD B, [HL]", 1, 2, 8, load<Reg8::B, Reg8::IndirHL> };
-    instr[Load::RegCIndirHL] = Instruction { "LD C, [HL]", 1, 2, 8, load<Reg8::C, Reg8::IndirHL> };
-    instr[Load::RegDIndirHL] = Instruction { "LD D, [HL]", 1, 2, 8, load<Reg8::D, Reg8::IndirHL> };
-    instr[Load::RegEIndirHL] = Instruction { "LD E, [HL]", 1, 2, 8, load<Reg8::E, Reg8::IndirHL> };
-    instr[Load::RegHIndirHL] = Instruction { "LD H, [HL]", 1, 2, 8, load<Reg8::H, Reg8::IndirHL> };
-    instr[Load::RegLIndirHL] = Instruction { "LD L, [HL]", 1, 2, 8, load<Reg8::L, Reg8::IndirHL> };
-    instr[Load::RegAIndirHL] = Instruction { "LD A, [HL]", 1, 2, 8, load<Reg8::A, Reg8::IndirHL> };
-    instr[Load::IndirHLRegB] = Instruction { "LD [HL], B", 1, 2, 8, load<Reg8::IndirHL, Reg8::B> };
-    instr[Load::IndirHLRegC] = Instruction { "LD [HL], C", 1, 2, 8, load<Reg8::IndirHL, Reg8::C> };
-    instr[Load::IndirHLRegD] = Instruction { "LD [HL], D", 1, 2, 8, load<Reg8::IndirHL, Reg8::D> };
-    instr[Load::IndirHLRegE] = Instruction { "LD [HL], E", 1, 2, 8, load<Reg8::IndirHL, Reg8::E> };
-    instr[Load::IndirHLRegH] = Instruction { "LD [HL], H", 1, 2, 8, load<Reg8::IndirHL, Reg8::H> };
-    instr[Load::IndirHLRegL] = Instruction { "LD [HL], L", 1, 2, 8, load<Reg8::IndirHL, Reg8::L> };
-    instr[Load::IndirHLRegA] = Instruction { "LD [HL], A", 1, 2, 8, load<Reg8::IndirHL, Reg8::A> };
+    std::array<InstructionDef, NO_PREFIX_INSTR_TABLE_SIZE> instr = {};
+    instr[Load::RegBRegB] = InstructionDef { "LD B, B", 1, 1, load<Reg8::B, Reg8::B> };
+    instr[Load::RegBRegC] = InstructionDef { "LD B, C", 1, 1, load<Reg8::B, Reg8::C> };
+    instr[Load::RegBRegD] = InstructionDef { "LD B, D", 1, 1, load<Reg8::B, Reg8::D> };
+    instr[Load::RegBRegE] = InstructionDef { "LD B, E", 1, 1, load<Reg8::B, Reg8::E> };
+    instr[Load::RegBRegH] = InstructionDef { "LD B, H", 1, 1, load<Reg8::B, Reg8::H> };
+    instr[Load::RegBRegL] = InstructionDef { "LD B, L", 1, 1, load<Reg8::B, Reg8::L> };
+    instr[Load::RegBRegA] = InstructionDef { "LD B, A", 1, 1, load<Reg8::B, Reg8::A> };
+    instr[Load::RegCRegB] = InstructionDef { "LD C, B", 1, 1, load<Reg8::C, Reg8::B> };
+    instr[Load::RegCRegC] = InstructionDef { "LD C, C", 1, 1, load<Reg8::C, Reg8::C> };
+    instr[Load::RegCRegD] = InstructionDef { "LD C, D", 1, 1, load<Reg8::C, Reg8::D> };
+    instr[Load::RegCRegE] = InstructionDef { "LD C, E", 1, 1, load<Reg8::C, Reg8::E> };
+    instr[Load::RegCRegH] = InstructionDef { "LD C, H", 1, 1, load<Reg8::C, Reg8::H> };
+    instr[Load::RegCRegL] = InstructionDef { "LD C, L", 1, 1, load<Reg8::C, Reg8::L> };
+    instr[Load::RegCRegA] = InstructionDef { "LD C, A", 1, 1, load<Reg8::C, Reg8::A> };
+    instr[Load::RegDRegB] = InstructionDef { "LD D, B", 1, 1, load<Reg8::D, Reg8::B> };
+    instr[Load::RegDRegC] = InstructionDef { "LD D, C", 1, 1, load<Reg8::D, Reg8::C> };
+    instr[Load::RegDRegD] = InstructionDef { "LD D, D", 1, 1, load<Reg8::D, Reg8::D> };
+    instr[Load::RegDRegE] = InstructionDef { "LD D, E", 1, 1, load<Reg8::D, Reg8::E> };
+    instr[Load::RegDRegH] = InstructionDef { "LD D, H", 1, 1, load<Reg8::D, Reg8::H> };
+    instr[Load::RegDRegL] = InstructionDef { "LD D, L", 1, 1, load<Reg8::D, Reg8::L> };
+    instr[Load::RegDRegA] = InstructionDef { "LD D, A", 1, 1, load<Reg8::D, Reg8::A> };
+    instr[Load::RegERegB] = InstructionDef { "LD E, B", 1, 1, load<Reg8::E, Reg8::B> };
+    instr[Load::RegERegC] = InstructionDef { "LD E, C", 1, 1, load<Reg8::E, Reg8::C> };
+    instr[Load::RegERegD] = InstructionDef { "LD E, D", 1, 1, load<Reg8::E, Reg8::D> };
+    instr[Load::RegERegE] = InstructionDef { "LD E, E", 1, 1, load<Reg8::E, Reg8::E> };
+    instr[Load::RegERegH] = InstructionDef { "LD E, H", 1, 1, load<Reg8::E, Reg8::H> };
+    instr[Load::RegERegL] = InstructionDef { "LD E, L", 1, 1, load<Reg8::E, Reg8::L> };
+    instr[Load::RegERegA] = InstructionDef { "LD E, A", 1, 1, load<Reg8::E, Reg8::A> };
+    instr[Load::RegHRegB] = InstructionDef { "LD H, B", 1, 1, load<Reg8::H, Reg8::B> };
+    instr[Load::RegHRegC] = InstructionDef { "LD H, C", 1, 1, load<Reg8::H, Reg8::C> };
+    instr[Load::RegHRegD] = InstructionDef { "LD H, D", 1, 1, load<Reg8::H, Reg8::D> };
+    instr[Load::RegHRegE] = InstructionDef { "LD H, E", 1, 1, load<Reg8::H, Reg8::E> };
+    instr[Load::RegHRegH] = InstructionDef { "LD H, H", 1, 1, load<Reg8::H, Reg8::H> };
+    instr[Load::RegHRegL] = InstructionDef { "LD H, L", 1, 1, load<Reg8::H, Reg8::L> };
+    instr[Load::RegHRegA] = InstructionDef { "LD H, A", 1, 1, load<Reg8::H, Reg8::A> };
+    instr[Load::RegLRegB] = InstructionDef { "LD L, B", 1, 1, load<Reg8::L, Reg8::B> };
+    instr[Load::RegLRegC] = InstructionDef { "LD L, C", 1, 1, load<Reg8::L, Reg8::C> };
+    instr[Load::RegLRegD] = InstructionDef { "LD L, D", 1, 1, load<Reg8::L, Reg8::D> };
+    instr[Load::RegLRegE] = InstructionDef { "LD L, E", 1, 1, load<Reg8::L, Reg8::E> };
+    instr[Load::RegLRegH] = InstructionDef { "LD L, H", 1, 1, load<Reg8::L, Reg8::H> };
+    instr[Load::RegLRegL] = InstructionDef { "LD L, L", 1, 1, load<Reg8::L, Reg8::L> };
+    instr[Load::RegLRegA] = InstructionDef { "LD L, A", 1, 1, load<Reg8::L, Reg8::A> };
+    instr[Load::RegARegB] = InstructionDef { "LD A, B", 1, 1, load<Reg8::A, Reg8::B> };
+    instr[Load::RegARegC] = InstructionDef { "LD A, C", 1, 1, load<Reg8::A, Reg8::C> };
+    instr[Load::RegARegD] = InstructionDef { "LD A, D", 1, 1, load<Reg8::A, Reg8::D> };
+    instr[Load::RegARegE] = InstructionDef { "LD A, E", 1, 1, load<Reg8::A, Reg8::E> };
+    instr[Load::RegARegH] = InstructionDef { "LD A, H", 1, 1, load<Reg8::A, Reg8::H> };
+    instr[Load::RegARegL] = InstructionDef { "LD A, L", 1, 1, load<Reg8::A, Reg8::L> };
+    instr[Load::RegARegA] = InstructionDef { "LD A, A", 1, 1, load<Reg8::A, Reg8::A> };
+    instr[Load::RegBImm8] = InstructionDef { "LD B, n8", 2, 2, load<Reg8::B, Imm8::Direct> };
+    instr[Load::RegCImm8] = InstructionDef { "LD C, n8", 2, 2, load<Reg8::C, Imm8::Direct> };
+    instr[Load::RegDImm8] = InstructionDef { "LD D, n8", 2, 2, load<Reg8::D, Imm8::Direct> };
+    instr[Load::RegEImm8] = InstructionDef { "LD E, n8", 2, 2, load<Reg8::E, Imm8::Direct> };
+    instr[Load::RegHImm8] = InstructionDef { "LD H, n8", 2, 2, load<Reg8::H, Imm8::Direct> };
+    instr[Load::RegLImm8] = InstructionDef { "LD L, n8", 2, 2, load<Reg8::L, Imm8::Direct> };
+    instr[Load::RegAImm8] = InstructionDef { "LD A, n8", 2, 2, load<Reg8::A, Imm8::Direct> };
+    instr[Load::RegBIndirHL] = InstructionDef { "LD B, [HL]", 1, 2, load<Reg8::B, Reg8::IndirHL> };
+    instr[Load::RegCIndirHL] = InstructionDef { "LD C, [HL]", 1, 2, load<Reg8::C, Reg8::IndirHL> };
+    instr[Load::RegDIndirHL] = InstructionDef { "LD D, [HL]", 1, 2, load<Reg8::D, Reg8::IndirHL> };
+    instr[Load::RegEIndirHL] = InstructionDef { "LD E, [HL]", 1, 2, load<Reg8::E, Reg8::IndirHL> };
+    instr[Load::RegHIndirHL] = InstructionDef { "LD H, [HL]", 1, 2, load<Reg8::H, Reg8::IndirHL> };
+    instr[Load::RegLIndirHL] = InstructionDef { "LD L, [HL]", 1, 2, load<Reg8::L, Reg8::IndirHL> };
+    instr[Load::RegAIndirHL] = InstructionDef { "LD A, [HL]", 1, 2, load<Reg8::A, Reg8::IndirHL> };
+    instr[Load::IndirHLRegB] = InstructionDef { "LD [HL], B", 1, 2, load<Reg8::IndirHL, Reg8::B> };
+    instr[Load::IndirHLRegC] = InstructionDef { "LD [HL], C", 1, 2, load<Reg8::IndirHL, Reg8::C> };
+    instr[Load::IndirHLRegD] = InstructionDef { "LD [HL], D", 1, 2, load<Reg8::IndirHL, Reg8::D> };
+    instr[Load::IndirHLRegE] = InstructionDef { "LD [HL], E", 1, 2, load<Reg8::IndirHL, Reg8::E> };
+    instr[Load::IndirHLRegH] = InstructionDef { "LD [HL], H", 1, 2, load<Reg8::IndirHL, Reg8::H> };
+    instr[Load::IndirHLRegL] = InstructionDef { "LD [HL], L", 1, 2, load<Reg8::IndirHL, Reg8::L> };
+    instr[Load::IndirHLRegA] = InstructionDef { "LD [HL], A", 1, 2, load<Reg8::IndirHL, Reg8::A> };
     instr[Load::IndirHLImm8]
-        = Instruction { "LD [HL], n8", 2, 3, 12, load<Reg8::IndirHL, Imm8::Direct> };
+        = InstructionDef { "LD [HL], n8", 2, 3, load<Reg8::IndirHL, Imm8::Direct> };
     instr[Load::RegAIndirImm16]
-        = Instruction { "LD A, [n16]", 3, 4, 16, load<Reg8::A, Imm8::IndirAbsolute> };
+        = InstructionDef { "LD A, [n16]", 3, 4, load<Reg8::A, Imm8::IndirAbsolute> };
     instr[Load::IndirImm16RegA]
-        = Instruction { "LD [n16], A", 3, 4, 16, load<Imm8::IndirAbsolute, Reg8::A> };
+        = InstructionDef { "LD [n16], A", 3, 4, load<Imm8::IndirAbsolute, Reg8::A> };
     instr[Load::HramRegAIndirC]
-        = Instruction { "LDH A, [C]", 1, 2, 8, load<Reg8::A, Reg8::IndirHramC> };
+        = InstructionDef { "LDH A, [C]", 1, 2, load<Reg8::A, Reg8::IndirHramC> };
     instr[Load::HramIndirCRegA]
-        = Instruction { "LDH [C], A", 1, 2, 8, load<Reg8::IndirHramC, Reg8::A> };
+        = InstructionDef { "LDH [C], A", 1, 2, load<Reg8::IndirHramC, Reg8::A> };
     instr[Load::HramRegAImm8]
-        = Instruction { "LDH A, [n8]", 2, 3, 12, load<Reg8::A, Imm8::IndirHram> };
+        = InstructionDef { "LDH A, [n8]", 2, 3, load<Reg8::A, Imm8::IndirHram> };
     instr[Load::HramImm8RegA]
-        = Instruction { "LDH [n8], A", 2, 3, 12, load<Imm8::IndirHram, Reg8::A> };
+        = InstructionDef { "LDH [n8], A", 2, 3, load<Imm8::IndirHram, Reg8::A> };
     instr[Load::RegBCImm16]
-        = Instruction { "LD BC, n16", 3, 3, 12, load<Reg16::BC, Imm16::Direct> };
+        = InstructionDef { "LD BC, n16", 3, 3, load<Reg16::BC, Imm16::Direct> };
     instr[Load::RegDEImm16]
-        = Instruction { "LD DE, n16", 3, 3, 12, load<Reg16::DE, Imm16::Direct> };
+        = InstructionDef { "LD DE, n16", 3, 3, load<Reg16::DE, Imm16::Direct> };
     instr[Load::RegHLImm16]
-        = Instruction { "LD HL, n16", 3, 3, 12, load<Reg16::HL, Imm16::Direct> };
-    instr[Load::IndirBCRegA] = Instruction { "LD [BC], A", 1, 2, 8, load<Reg16Indir::BC, Reg8::A> };
-    instr[Load::IndirDERegA] = Instruction { "LD [DE], A", 1, 2, 8, load<Reg16Indir::DE, Reg8::A> };
+        = InstructionDef { "LD HL, n16", 3, 3, load<Reg16::HL, Imm16::Direct> };
+    instr[Load::IndirBCRegA] = InstructionDef { "LD [BC], A", 1, 2, load<Reg16Indir::BC, Reg8::A> };
+    instr[Load::IndirDERegA] = InstructionDef { "LD [DE], A", 1, 2, load<Reg16Indir::DE, Reg8::A> };
     instr[Load::IndirHLIRegA]
-        = Instruction { "LD [HL+], A", 1, 2, 8, load<Reg16Indir::HLI, Reg8::A> };
+        = InstructionDef { "LD [HL+], A", 1, 2, load<Reg16Indir::HLI, Reg8::A> };
     instr[Load::IndirHLDRegA]
-        = Instruction { "LD [HL-], A", 1, 2, 8, load<Reg16Indir::HLD, Reg8::A> };
-    instr[Load::RegAIndirBC] = Instruction { "LD A, [BC]", 1, 2, 8, load<Reg8::A, Reg16Indir::BC> };
-    instr[Load::RegAIndirDE] = Instruction { "LD A, [DE]", 1, 2, 8, load<Reg8::A, Reg16Indir::DE> };
+        = InstructionDef { "LD [HL-], A", 1, 2, load<Reg16Indir::HLD, Reg8::A> };
+    instr[Load::RegAIndirBC] = InstructionDef { "LD A, [BC]", 1, 2, load<Reg8::A, Reg16Indir::BC> };
+    instr[Load::RegAIndirDE] = InstructionDef { "LD A, [DE]", 1, 2, load<Reg8::A, Reg16Indir::DE> };
     instr[Load::RegAIndirHLI]
-        = Instruction { "LD A, [HLI]", 1, 2, 8, load<Reg8::A, Reg16Indir::HLI> };
+        = InstructionDef { "LD A, [HLI]", 1, 2, load<Reg8::A, Reg16Indir::HLI> };
     instr[Load::RegAIndirHLD]
-        = Instruction { "LD A, [HLD]", 1, 2, 8, load<Reg8::A, Reg16Indir::HLD> };
+        = InstructionDef { "LD A, [HLD]", 1, 2, load<Reg8::A, Reg16Indir::HLD> };
     instr[Stack::RegSPImm16]
-        = Instruction { "LD SP, n16", 3, 3, 12, load<Reg16::SP, Imm16::Direct> };
-    instr[Stack::AddRegHLRegSP] = Instruction { "ADD HL, SP", 1, 2, 8, add_hl<Reg16::SP> };
-    instr[Stack::IncRegSP] = Instruction { "INC SP", 1, 2, 8, inc<Reg16::SP> };
-    instr[Stack::DecRegSP] = Instruction { "DEC SP", 1, 2, 8, dec<Reg16::SP> };
-    instr[Stack::AddRegSPOffset] = Instruction { "ADD SP, e8", 2, 3, 12, add_sp_offset };
-    instr[Stack::PushRegBC] = Instruction { "PUSH BC", 1, 4, 16, push<Reg16Stack::BC> };
-    instr[Stack::PushRegDE] = Instruction { "PUSH DE", 1, 4, 16, push<Reg16Stack::DE> };
-    instr[Stack::PushRegHL] = Instruction { "PUSH HL", 1, 4, 16, push<Reg16Stack::HL> };
-    instr[Stack::PushRegAF] = Instruction { "PUSH AF", 1, 4, 16, push<Reg16Stack::AF> };
-    instr[Stack::PopRegBC] = Instruction { "POP BC", 1, 3, 12, pop<Reg16Stack::BC> };
-    instr[Stack::PopRegDE] = Instruction { "POP DE", 1, 3, 12, pop<Reg16Stack::DE> };
-    instr[Stack::PopRegHL] = Instruction { "POP HL", 1, 3, 12, pop<Reg16Stack::HL> };
-    instr[Stack::PopRegAF] = Instruction { "POP AF", 1, 3, 12, pop<Reg16Stack::AF> };
-    instr[Stack::RegSPRegHL] = Instruction { "LD SP, HL", 1, 2, 8, load<Reg16::SP, Reg16::HL> };
+        = InstructionDef { "LD SP, n16", 3, 3, load<Reg16::SP, Imm16::Direct> };
+    instr[Stack::AddRegHLRegSP] = InstructionDef { "ADD HL, SP", 1, 2, add_hl<Reg16::SP> };
+    instr[Stack::IncRegSP] = InstructionDef { "INC SP", 1, 2, inc<Reg16::SP> };
+    instr[Stack::DecRegSP] = InstructionDef { "DEC SP", 1, 2, dec<Reg16::SP> };
+    instr[Stack::AddRegSPOffset] = InstructionDef { "ADD SP, e8", 2, 4, add_sp_offset };
+    instr[Stack::PushRegBC] = InstructionDef { "PUSH BC", 1, 4, push<Reg16Stack::BC> };
+    instr[Stack::PushRegDE] = InstructionDef { "PUSH DE", 1, 4, push<Reg16Stack::DE> };
+    instr[Stack::PushRegHL] = InstructionDef { "PUSH HL", 1, 4, push<Reg16Stack::HL> };
+    instr[Stack::PushRegAF] = InstructionDef { "PUSH AF", 1, 4, push<Reg16Stack::AF> };
+    instr[Stack::PopRegBC] = InstructionDef { "POP BC", 1, 3, pop<Reg16Stack::BC> };
+    instr[Stack::PopRegDE] = InstructionDef { "POP DE", 1, 3, pop<Reg16Stack::DE> };
+    instr[Stack::PopRegHL] = InstructionDef { "POP HL", 1, 3, pop<Reg16Stack::HL> };
+    instr[Stack::PopRegAF] = InstructionDef { "POP AF", 1, 3, pop<Reg16Stack::AF> };
+    instr[Stack::RegSPRegHL] = InstructionDef { "LD SP, HL", 1, 2, load<Reg16::SP, Reg16::HL> };
     instr[Stack::IndirImm16RegSP]
-        = Instruction { "LD [n16], SP", 3, 5, 20, load<Imm16::IndirAbsolute, Reg16::SP> };
-    instr[Stack::RegHLRegSPOffset] = Instruction { "LD HL, SP + e8", 2, 3, 12, load_hl_sp_offset };
-    instr[Math::AddRegB] = Instruction { "ADD A, B", 1, 1, 4, add_a<Reg8::B, UseCarry::No> };
-    instr[Math::AddRegC] = Instruction { "ADD A, C", 1, 1, 4, add_a<Reg8::C, UseCarry::No> };
-    instr[Math::AddRegD] = Instruction { "ADD A, D", 1, 1, 4, add_a<Reg8::D, UseCarry::No> };
-    instr[Math::AddRegE] = Instruction { "ADD A, E", 1, 1, 4, add_a<Reg8::E, UseCarry::No> };
-    instr[Math::AddRegH] = Instruction { "ADD A, H", 1, 1, 4, add_a<Reg8::H, UseCarry::No> };
-    instr[Math::AddRegL] = Instruction { "ADD A, L", 1, 1, 4, add_a<Reg8::L, UseCarry::No> };
-    instr[Math::AddRegA] = Instruction { "ADD A, A", 1, 1, 4, add_a<Reg8::A, UseCarry::No> };
+        = InstructionDef { "LD [n16], SP", 3, 5, load<Imm16::IndirAbsolute, Reg16::SP> };
+    instr[Stack::RegHLRegSPOffset] = InstructionDef { "LD HL, SP + e8", 2, 3, load_hl_sp_offset };
+    instr[Math::AddRegB] = InstructionDef { "ADD A, B", 1, 1, add_a<Reg8::B, UseCarry::No> };
+    instr[Math::AddRegC] = InstructionDef { "ADD A, C", 1, 1, add_a<Reg8::C, UseCarry::No> };
+    instr[Math::AddRegD] = InstructionDef { "ADD A, D", 1, 1, add_a<Reg8::D, UseCarry::No> };
+    instr[Math::AddRegE] = InstructionDef { "ADD A, E", 1, 1, add_a<Reg8::E, UseCarry::No> };
+    instr[Math::AddRegH] = InstructionDef { "ADD A, H", 1, 1, add_a<Reg8::H, UseCarry::No> };
+    instr[Math::AddRegL] = InstructionDef { "ADD A, L", 1, 1, add_a<Reg8::L, UseCarry::No> };
+    instr[Math::AddRegA] = InstructionDef { "ADD A, A", 1, 1, add_a<Reg8::A, UseCarry::No> };
     instr[Math::AddIndirHL]
-        = Instruction { "ADD A, [HL]", 1, 2, 8, add_a<Reg8::IndirHL, UseCarry::No> };
-    instr[Math::AddCarryRegB] = Instruction { "ADC A, B", 1, 1, 4, add_a<Reg8::B, UseCarry::Yes> };
-    instr[Math::AddCarryRegC] = Instruction { "ADC A, C", 1, 1, 4, add_a<Reg8::C, UseCarry::Yes> };
-    instr[Math::AddCarryRegD] = Instruction { "ADC A, D", 1, 1, 4, add_a<Reg8::D, UseCarry::Yes> };
-    instr[Math::AddCarryRegE] = Instruction { "ADC A, E", 1, 1, 4, add_a<Reg8::E, UseCarry::Yes> };
-    instr[Math::AddCarryRegH] = Instruction { "ADC A, H", 1, 1, 4, add_a<Reg8::H, UseCarry::Yes> };
-    instr[Math::AddCarryRegL] = Instruction { "ADC A, L", 1, 1, 4, add_a<Reg8::L, UseCarry::Yes> };
-    instr[Math::AddCarryRegA] = Instruction { "ADC A, A", 1, 1, 4, add_a<Reg8::A, UseCarry::Yes> };
+        = InstructionDef { "ADD A, [HL]", 1, 2, add_a<Reg8::IndirHL, UseCarry::No> };
+    instr[Math::AddCarryRegB] = InstructionDef { "ADC A, B", 1, 1, add_a<Reg8::B, UseCarry::Yes> };
+    instr[Math::AddCarryRegC] = InstructionDef { "ADC A, C", 1, 1, add_a<Reg8::C, UseCarry::Yes> };
+    instr[Math::AddCarryRegD] = InstructionDef { "ADC A, D", 1, 1, add_a<Reg8::D, UseCarry::Yes> };
+    instr[Math::AddCarryRegE] = InstructionDef { "ADC A, E", 1, 1, add_a<Reg8::E, UseCarry::Yes> };
+    instr[Math::AddCarryRegH] = InstructionDef { "ADC A, H", 1, 1, add_a<Reg8::H, UseCarry::Yes> };
+    instr[Math::AddCarryRegL] = InstructionDef { "ADC A, L", 1, 1, add_a<Reg8::L, UseCarry::Yes> };
+    instr[Math::AddCarryRegA] = InstructionDef { "ADC A, A", 1, 1, add_a<Reg8::A, UseCarry::Yes> };
     instr[Math::AddCarryIndirHL]
-        = Instruction { "ADC A, [HL]", 1, 2, 8, add_a<Reg8::IndirHL, UseCarry::Yes> };
-    instr[Math::AddImm8] = Instruction { "ADD A, n8", 2, 2, 8, add_a<Imm8::Direct, UseCarry::No> };
+        = InstructionDef { "ADC A, [HL]", 1, 2, add_a<Reg8::IndirHL, UseCarry::Yes> };
+    instr[Math::AddImm8] = InstructionDef { "ADD A, n8", 2, 2, add_a<Imm8::Direct, UseCarry::No> };
     instr[Math::AddCarryImm8]
-        = Instruction { "ADC A, n8", 2, 2, 8, add_a<Imm8::Direct, UseCarry::Yes> };
-    instr[Math::SubRegB] = Instruction { "SUB A, B", 1, 1, 4, sub_a<Reg8::B, UseCarry::No> };
-    instr[Math::SubRegC] = Instruction { "SUB A, C", 1, 1, 4, sub_a<Reg8::C, UseCarry::No> };
-    instr[Math::SubRegD] = Instruction { "SUB A, D", 1, 1, 4, sub_a<Reg8::D, UseCarry::No> };
-    instr[Math::SubRegE] = Instruction { "SUB A, E", 1, 1, 4, sub_a<Reg8::E, UseCarry::No> };
-    instr[Math::SubRegH] = Instruction { "SUB A, H", 1, 1, 4, sub_a<Reg8::H, UseCarry::No> };
-    instr[Math::SubRegL] = Instruction { "SUB A, L", 1, 1, 4, sub_a<Reg8::L, UseCarry::No> };
-    instr[Math::SubRegA] = Instruction { "SUB A, A", 1, 1, 4, sub_a<Reg8::A, UseCarry::No> };
+        = InstructionDef { "ADC A, n8", 2, 2, add_a<Imm8::Direct, UseCarry::Yes> };
+    instr[Math::SubRegB] = InstructionDef { "SUB A, B", 1, 1, sub_a<Reg8::B, UseCarry::No> };
+    instr[Math::SubRegC] = InstructionDef { "SUB A, C", 1, 1, sub_a<Reg8::C, UseCarry::No> };
+    instr[Math::SubRegD] = InstructionDef { "SUB A, D", 1, 1, sub_a<Reg8::D, UseCarry::No> };
+    instr[Math::SubRegE] = InstructionDef { "SUB A, E", 1, 1, sub_a<Reg8::E, UseCarry::No> };
+    instr[Math::SubRegH] = InstructionDef { "SUB A, H", 1, 1, sub_a<Reg8::H, UseCarry::No> };
+    instr[Math::SubRegL] = InstructionDef { "SUB A, L", 1, 1, sub_a<Reg8::L, UseCarry::No> };
+    instr[Math::SubRegA] = InstructionDef { "SUB A, A", 1, 1, sub_a<Reg8::A, UseCarry::No> };
     instr[Math::SubIndirHL]
-        = Instruction { "SUB [HL]", 1, 2, 8, sub_a<Reg8::IndirHL, UseCarry::No> };
-    instr[Math::SubCarryRegB] = Instruction { "SBC A, B", 1, 1, 4, sub_a<Reg8::B, UseCarry::Yes> };
-    instr[Math::SubCarryRegC] = Instruction { "SBC A, C", 1, 1, 4, sub_a<Reg8::C, UseCarry::Yes> };
-    instr[Math::SubCarryRegD] = Instruction { "SBC A, D", 1, 1, 4, sub_a<Reg8::D, UseCarry::Yes> };
-    instr[Math::SubCarryRegE] = Instruction { "SBC A, E", 1, 1, 4, sub_a<Reg8::E, UseCarry::Yes> };
-    instr[Math::SubCarryRegH] = Instruction { "SBC A, H", 1, 1, 4, sub_a<Reg8::H, UseCarry::Yes> };
-    instr[Math::SubCarryRegL] = Instruction { "SBC A, L", 1, 1, 4, sub_a<Reg8::L, UseCarry::Yes> };
-    instr[Math::SubCarryRegA] = Instruction { "SBC A, A", 1, 1, 4, sub_a<Reg8::A, UseCarry::Yes> };
+        = InstructionDef { "SUB A, [HL]", 1, 2, sub_a<Reg8::IndirHL, UseCarry::No> };
+    instr[Math::SubCarryRegB] = InstructionDef { "SBC A, B", 1, 1, sub_a<Reg8::B, UseCarry::Yes> };
+    instr[Math::SubCarryRegC] = InstructionDef { "SBC A, C", 1, 1, sub_a<Reg8::C, UseCarry::Yes> };
+    instr[Math::SubCarryRegD] = InstructionDef { "SBC A, D", 1, 1, sub_a<Reg8::D, UseCarry::Yes> };
+    instr[Math::SubCarryRegE] = InstructionDef { "SBC A, E", 1, 1, sub_a<Reg8::E, UseCarry::Yes> };
+    instr[Math::SubCarryRegH] = InstructionDef { "SBC A, H", 1, 1, sub_a<Reg8::H, UseCarry::Yes> };
+    instr[Math::SubCarryRegL] = InstructionDef { "SBC A, L", 1, 1, sub_a<Reg8::L, UseCarry::Yes> };
+    instr[Math::SubCarryRegA] = InstructionDef { "SBC A, A", 1, 1, sub_a<Reg8::A, UseCarry::Yes> };
     instr[Math::SubCarryIndirHL]
-        = Instruction { "SBC [HL]", 1, 2, 8, sub_a<Reg8::IndirHL, UseCarry::Yes> };
-    instr[Math::SubImm8] = Instruction { "SUB A, n8", 2, 2, 8, sub_a<Imm8::Direct, UseCarry::No> };
+        = InstructionDef { "SBC A, [HL]", 1, 2, sub_a<Reg8::IndirHL, UseCarry::Yes> };
+    instr[Math::SubImm8] = InstructionDef { "SUB A, n8", 2, 2, sub_a<Imm8::Direct, UseCarry::No> };
     instr[Math::SubCarryImm8]
-        = Instruction { "SBC A, n8", 2, 2, 8, sub_a<Imm8::Direct, UseCarry::Yes> };
-    instr[Math::IncRegB] = Instruction { "INC B", 1, 1, 4, inc<Reg8::B> };
-    instr[Math::IncRegC] = Instruction { "INC C", 1, 1, 4, inc<Reg8::C> };
-    instr[Math::IncRegD] = Instruction { "INC D", 1, 1, 4, inc<Reg8::D> };
-    instr[Math::IncRegE] = Instruction { "INC E", 1, 1, 4, inc<Reg8::E> };
-    instr[Math::IncRegH] = Instruction { "INC H", 1, 1, 4, inc<Reg8::H> };
-    instr[Math::IncRegL] = Instruction { "INC L", 1, 1, 4, inc<Reg8::L> };
-    instr[Math::IncRegA] = Instruction { "INC A", 1, 1, 4, inc<Reg8::A> };
-    instr[Math::DecRegB] = Instruction { "DEC B", 1, 1, 4, dec<Reg8::B> };
-    instr[Math::DecRegC] = Instruction { "DEC C", 1, 1, 4, dec<Reg8::C> };
-    instr[Math::DecRegD] = Instruction { "DEC D", 1, 1, 4, dec<Reg8::D> };
-    instr[Math::DecRegE] = Instruction { "DEC E", 1, 1, 4, dec<Reg8::E> };
-    instr[Math::DecRegH] = Instruction { "DEC H", 1, 1, 4, dec<Reg8::H> };
-    instr[Math::DecRegL] = Instruction { "DEC L", 1, 1, 4, dec<Reg8::L> };
-    instr[Math::DecRegA] = Instruction { "DEC A", 1, 1, 4, dec<Reg8::A> };
-    instr[Math::IncIndirHL] = Instruction { "INC [HL]", 1, 3, 12, inc<Reg8::IndirHL> };
-    instr[Math::DecIndirHL] = Instruction { "DEC [HL]", 1, 3, 12, dec<Reg8::IndirHL> };
-    instr[Math::AddRegHLRegBC] = Instruction { "ADD HL, BC", 1, 2, 8, add_hl<Reg16::HL> };
-    instr[Math::AddRegHLRegDE] = Instruction { "ADD HL, BC", 1, 2, 8, add_hl<Reg16::HL> };
-    instr[Math::AddRegHLRegHL] = Instruction { "ADD HL, BC", 1, 2, 8, add_hl<Reg16::HL> };
-    instr[Math::IncRegBC] = Instruction { "INC BC", 1, 2, 8, inc<Reg16::BC> };
-    instr[Math::IncRegDE] = Instruction { "INC DE", 1, 2, 8, inc<Reg16::DE> };
-    instr[Math::IncRegHL] = Instruction { "INC HL", 1, 2, 8, inc<Reg16::HL> };
-    instr[Math::DecRegBC] = Instruction { "DEC BC", 1, 2, 8, dec<Reg16::BC> };
-    instr[Math::DecRegDE] = Instruction { "DEC DE", 1, 2, 8, dec<Reg16::DE> };
-    instr[Math::DecRegHL] = Instruction { "DEC HL", 1, 2, 8, dec<Reg16::HL> };
-    instr[Math::SetCarry] = Instruction { "SCF", 1, 1, 4, set_carry_flag };
-    instr[Math::ComplementCarry] = Instruction { "CCF", 1, 1, 4, complement_carry_flag };
-    instr[Math::DecimalAdjust] = Instruction { "DAA", 1, 1, 4, decimal_adjust };
-    instr[BitLogic::ComplementRegA] = Instruction { "CPL", 1, 1, 4, complement_a };
-    instr[BitLogic::AndRegB] = Instruction { "AND A, B", 1, 1, 4, and_a<Reg8::B> };
-    instr[BitLogic::AndRegC] = Instruction { "AND A, C", 1, 1, 4, and_a<Reg8::C> };
-    instr[BitLogic::AndRegD] = Instruction { "AND A, D", 1, 1, 4, and_a<Reg8::D> };
-    instr[BitLogic::AndRegE] = Instruction { "AND A, E", 1, 1, 4, and_a<Reg8::E> };
-    instr[BitLogic::AndRegH] = Instruction { "AND A, H", 1, 1, 4, and_a<Reg8::H> };
-    instr[BitLogic::AndRegL] = Instruction { "AND A, L", 1, 1, 4, and_a<Reg8::L> };
-    instr[BitLogic::AndRegA] = Instruction { "AND A, A", 1, 1, 4, and_a<Reg8::A> };
-    instr[BitLogic::AndIndirHL] = Instruction { "AND A, [HL]", 1, 2, 8, and_a<Reg8::IndirHL> };
-    instr[BitLogic::XorRegB] = Instruction { "XOR A, B", 1, 1, 4, xor_a<Reg8::B> };
-    instr[BitLogic::XorRegC] = Instruction { "XOR A, C", 1, 1, 4, xor_a<Reg8::C> };
-    instr[BitLogic::XorRegD] = Instruction { "XOR A, D", 1, 1, 4, xor_a<Reg8::D> };
-    instr[BitLogic::XorRegE] = Instruction { "XOR A, E", 1, 1, 4, xor_a<Reg8::E> };
-    instr[BitLogic::XorRegH] = Instruction { "XOR A, H", 1, 1, 4, xor_a<Reg8::H> };
-    instr[BitLogic::XorRegL] = Instruction { "XOR A, L", 1, 1, 4, xor_a<Reg8::L> };
-    instr[BitLogic::XorRegA] = Instruction { "XOR A, A", 1, 1, 4, xor_a<Reg8::A> };
-    instr[BitLogic::XorIndirHL] = Instruction { "XOR A, [HL]", 1, 2, 8, xor_a<Reg8::IndirHL> };
-    instr[BitLogic::OrRegB] = Instruction { "OR A, B", 1, 1, 4, or_a<Reg8::B> };
-    instr[BitLogic::OrRegC] = Instruction { "OR A, C", 1, 1, 4, or_a<Reg8::C> };
-    instr[BitLogic::OrRegD] = Instruction { "OR A, D", 1, 1, 4, or_a<Reg8::D> };
-    instr[BitLogic::OrRegE] = Instruction { "OR A, E", 1, 1, 4, or_a<Reg8::E> };
-    instr[BitLogic::OrRegH] = Instruction { "OR A, H", 1, 1, 4, or_a<Reg8::H> };
-    instr[BitLogic::OrRegL] = Instruction { "OR A, L", 1, 1, 4, or_a<Reg8::L> };
-    instr[BitLogic::OrRegA] = Instruction { "OR A, A", 1, 1, 4, or_a<Reg8::A> };
-    instr[BitLogic::OrIndirHL] = Instruction { "OR A, [HL]", 1, 2, 8, or_a<Reg8::IndirHL> };
-    instr[BitLogic::CpRegB] = Instruction { "CP A, B", 1, 1, 4, cp_a<Reg8::B> };
-    instr[BitLogic::CpRegC] = Instruction { "CP A, C", 1, 1, 4, cp_a<Reg8::C> };
-    instr[BitLogic::CpRegD] = Instruction { "CP A, D", 1, 1, 4, cp_a<Reg8::D> };
-    instr[BitLogic::CpRegE] = Instruction { "CP A, E", 1, 1, 4, cp_a<Reg8::E> };
-    instr[BitLogic::CpRegH] = Instruction { "CP A, H", 1, 1, 4, cp_a<Reg8::H> };
-    instr[BitLogic::CpRegL] = Instruction { "CP A, L", 1, 1, 4, cp_a<Reg8::L> };
-    instr[BitLogic::CpRegA] = Instruction { "CP A, A", 1, 1, 4, cp_a<Reg8::A> };
-    instr[BitLogic::CpIndirHL] = Instruction { "CP A, [HL]", 1, 2, 8, cp_a<Reg8::IndirHL> };
-    instr[BitLogic::AndImm8] = Instruction { "AND A, n8", 2, 2, 8, and_a<Imm8::Direct> };
-    instr[BitLogic::XorImm8] = Instruction { "XOR A, n8", 2, 2, 8, xor_a<Imm8::Direct> };
-    instr[BitLogic::OrImm8] = Instruction { "OR A, n8", 2, 2, 8, or_a<Imm8::Direct> };
-    instr[BitLogic::CpImm8] = Instruction { "CP A, n8", 2, 2, 8, cp_a<Imm8::Direct> };
-    instr[BitShift::RotateRegALeftCarry] = Instruction { "RLCA", 1, 1, 4,
+        = InstructionDef { "SBC A, n8", 2, 2, sub_a<Imm8::Direct, UseCarry::Yes> };
+    instr[Math::IncRegB] = InstructionDef { "INC B", 1, 1, inc<Reg8::B> };
+    instr[Math::IncRegC] = InstructionDef { "INC C", 1, 1, inc<Reg8::C> };
+    instr[Math::IncRegD] = InstructionDef { "INC D", 1, 1, inc<Reg8::D> };
+    instr[Math::IncRegE] = InstructionDef { "INC E", 1, 1, inc<Reg8::E> };
+    instr[Math::IncRegH] = InstructionDef { "INC H", 1, 1, inc<Reg8::H> };
+    instr[Math::IncRegL] = InstructionDef { "INC L", 1, 1, inc<Reg8::L> };
+    instr[Math::IncRegA] = InstructionDef { "INC A", 1, 1, inc<Reg8::A> };
+    instr[Math::DecRegB] = InstructionDef { "DEC B", 1, 1, dec<Reg8::B> };
+    instr[Math::DecRegC] = InstructionDef { "DEC C", 1, 1, dec<Reg8::C> };
+    instr[Math::DecRegD] = InstructionDef { "DEC D", 1, 1, dec<Reg8::D> };
+    instr[Math::DecRegE] = InstructionDef { "DEC E", 1, 1, dec<Reg8::E> };
+    instr[Math::DecRegH] = InstructionDef { "DEC H", 1, 1, dec<Reg8::H> };
+    instr[Math::DecRegL] = InstructionDef { "DEC L", 1, 1, dec<Reg8::L> };
+    instr[Math::DecRegA] = InstructionDef { "DEC A", 1, 1, dec<Reg8::A> };
+    instr[Math::IncIndirHL] = InstructionDef { "INC [HL]", 1, 3, inc<Reg8::IndirHL> };
+    instr[Math::DecIndirHL] = InstructionDef { "DEC [HL]", 1, 3, dec<Reg8::IndirHL> };
+    instr[Math::AddRegHLRegBC] = InstructionDef { "ADD HL, BC", 1, 2, add_hl<Reg16::BC> };
+    instr[Math::AddRegHLRegDE] = InstructionDef { "ADD HL, DE", 1, 2, add_hl<Reg16::DE> };
+    instr[Math::AddRegHLRegHL] = InstructionDef { "ADD HL, HL", 1, 2, add_hl<Reg16::HL> };
+    instr[Math::IncRegBC] = InstructionDef { "INC BC", 1, 2, inc<Reg16::BC> };
+    instr[Math::IncRegDE] = InstructionDef { "INC DE", 1, 2, inc<Reg16::DE> };
+    instr[Math::IncRegHL] = InstructionDef { "INC HL", 1, 2, inc<Reg16::HL> };
+    instr[Math::DecRegBC] = InstructionDef { "DEC BC", 1, 2, dec<Reg16::BC> };
+    instr[Math::DecRegDE] = InstructionDef { "DEC DE", 1, 2, dec<Reg16::DE> };
+    instr[Math::DecRegHL] = InstructionDef { "DEC HL", 1, 2, dec<Reg16::HL> };
+    instr[Math::SetCarry] = InstructionDef { "SCF", 1, 1, set_carry_flag };
+    instr[Math::ComplementCarry] = InstructionDef { "CCF", 1, 1, complement_carry_flag };
+    instr[Math::DecimalAdjust] = InstructionDef { "DAA", 1, 1, decimal_adjust };
+    instr[BitLogic::ComplementRegA] = InstructionDef { "CPL", 1, 1, complement_a };
+    instr[BitLogic::AndRegB] = InstructionDef { "AND A, B", 1, 1, and_a<Reg8::B> };
+    instr[BitLogic::AndRegC] = InstructionDef { "AND A, C", 1, 1, and_a<Reg8::C> };
+    instr[BitLogic::AndRegD] = InstructionDef { "AND A, D", 1, 1, and_a<Reg8::D> };
+    instr[BitLogic::AndRegE] = InstructionDef { "AND A, E", 1, 1, and_a<Reg8::E> };
+    instr[BitLogic::AndRegH] = InstructionDef { "AND A, H", 1, 1, and_a<Reg8::H> };
+    instr[BitLogic::AndRegL] = InstructionDef { "AND A, L", 1, 1, and_a<Reg8::L> };
+    instr[BitLogic::AndRegA] = InstructionDef { "AND A, A", 1, 1, and_a<Reg8::A> };
+    instr[BitLogic::AndIndirHL] = InstructionDef { "AND A, [HL]", 1, 2, and_a<Reg8::IndirHL> };
+    instr[BitLogic::XorRegB] = InstructionDef { "XOR A, B", 1, 1, xor_a<Reg8::B> };
+    instr[BitLogic::XorRegC] = InstructionDef { "XOR A, C", 1, 1, xor_a<Reg8::C> };
+    instr[BitLogic::XorRegD] = InstructionDef { "XOR A, D", 1, 1, xor_a<Reg8::D> };
+    instr[BitLogic::XorRegE] = InstructionDef { "XOR A, E", 1, 1, xor_a<Reg8::E> };
+    instr[BitLogic::XorRegH] = InstructionDef { "XOR A, H", 1, 1, xor_a<Reg8::H> };
+    instr[BitLogic::XorRegL] = InstructionDef { "XOR A, L", 1, 1, xor_a<Reg8::L> };
+    instr[BitLogic::XorRegA] = InstructionDef { "XOR A, A", 1, 1, xor_a<Reg8::A> };
+    instr[BitLogic::XorIndirHL] = InstructionDef { "XOR A, [HL]", 1, 2, xor_a<Reg8::IndirHL> };
+    instr[BitLogic::OrRegB] = InstructionDef { "OR A, B", 1, 1, or_a<Reg8::B> };
+    instr[BitLogic::OrRegC] = InstructionDef { "OR A, C", 1, 1, or_a<Reg8::C> };
+    instr[BitLogic::OrRegD] = InstructionDef { "OR A, D", 1, 1, or_a<Reg8::D> };
+    instr[BitLogic::OrRegE] = InstructionDef { "OR A, E", 1, 1, or_a<Reg8::E> };
+    instr[BitLogic::OrRegH] = InstructionDef { "OR A, H", 1, 1, or_a<Reg8::H> };
+    instr[BitLogic::OrRegL] = InstructionDef { "OR A, L", 1, 1, or_a<Reg8::L> };
+    instr[BitLogic::OrRegA] = InstructionDef { "OR A, A", 1, 1, or_a<Reg8::A> };
+    instr[BitLogic::OrIndirHL] = InstructionDef { "OR A, [HL]", 1, 2, or_a<Reg8::IndirHL> };
+    instr[BitLogic::CpRegB] = InstructionDef { "CP A, B", 1, 1, cp_a<Reg8::B> };
+    instr[BitLogic::CpRegC] = InstructionDef { "CP A, C", 1, 1, cp_a<Reg8::C> };
+    instr[BitLogic::CpRegD] = InstructionDef { "CP A, D", 1, 1, cp_a<Reg8::D> };
+    instr[BitLogic::CpRegE] = InstructionDef { "CP A, E", 1, 1, cp_a<Reg8::E> };
+    instr[BitLogic::CpRegH] = InstructionDef { "CP A, H", 1, 1, cp_a<Reg8::H> };
+    instr[BitLogic::CpRegL] = InstructionDef { "CP A, L", 1, 1, cp_a<Reg8::L> };
+    instr[BitLogic::CpRegA] = InstructionDef { "CP A, A", 1, 1, cp_a<Reg8::A> };
+    instr[BitLogic::CpIndirHL] = InstructionDef { "CP A, [HL]", 1, 2, cp_a<Reg8::IndirHL> };
+    instr[BitLogic::AndImm8] = InstructionDef { "AND A, n8", 2, 2, and_a<Imm8::Direct> };
+    instr[BitLogic::XorImm8] = InstructionDef { "XOR A, n8", 2, 2, xor_a<Imm8::Direct> };
+    instr[BitLogic::OrImm8] = InstructionDef { "OR A, n8", 2, 2, or_a<Imm8::Direct> };
+    instr[BitLogic::CpImm8] = InstructionDef { "CP A, n8", 2, 2, cp_a<Imm8::Direct> };
+    instr[BitShift::RotateRegALeftCarry] = InstructionDef { "RLCA", 1, 1,
         rotate<Reg8::A, Direction::Left, UseZero::No, UseCarry::Yes> };
-    instr[BitShift::RotateRegARightCarry] = Instruction { "RRCA", 1, 1, 4,
+    instr[BitShift::RotateRegARightCarry] = InstructionDef { "RRCA", 1, 1,
         rotate<Reg8::A, Direction::Right, UseZero::No, UseCarry::Yes> };
-    instr[BitShift::RotateRegALeft] = Instruction { "RLA", 1, 1, 4,
+    instr[BitShift::RotateRegALeft] = InstructionDef { "RLA", 1, 1,
         rotate<Reg8::A, Direction::Left, UseZero::No, UseCarry::No> };
-    instr[BitShift::RotateRegALeft] = Instruction { "RRA", 1, 1, 4,
+    instr[BitShift::RotateRegARight] = InstructionDef { "RRA", 1, 1,
         rotate<Reg8::A, Direction::Right, UseZero::No, UseCarry::No> };
-    instr[CtrlFlow::JumpImm16] = Instruction { "JP n16", 3, 4, 16, jump_imm16 };
-    instr[CtrlFlow::JumpRegHL] = Instruction { "JP HL", 1, 1, 4, jump_hl };
+    instr[CtrlFlow::JumpImm16] = InstructionDef { "JP n16", 3, 4, jump_imm16 };
+    instr[CtrlFlow::JumpRegHL] = InstructionDef { "JP HL", 1, 1, jump_hl };
     instr[CtrlFlow::JumpNZImm16]
-        = Instruction { "JP NZ n16", 3, 3, 12, jump_cond_imm16<Condition::NZ> };
+        = InstructionDef { "JP NZ n16", 3, 3, jump_cond_imm16<Condition::NZ> };
     instr[CtrlFlow::JumpNCImm16]
-        = Instruction { "JP NC n16", 3, 3, 12, jump_cond_imm16<Condition::NC> };
+        = InstructionDef { "JP NC n16", 3, 3, jump_cond_imm16<Condition::NC> };
     instr[CtrlFlow::JumpZImm16]
-        = Instruction { "JP Z n16", 3, 3, 12, jump_cond_imm16<Condition::Z> };
+        = InstructionDef { "JP Z n16", 3, 3, jump_cond_imm16<Condition::Z> };
     instr[CtrlFlow::JumpCImm16]
-        = Instruction { "JP C n16", 3, 3, 12, jump_cond_imm16<Condition::C> };
-    instr[CtrlFlow::JumpRelImm8] = Instruction { "JR e8", 2, 3, 12, jump_rel_imm8 };
+        = InstructionDef { "JP C n16", 3, 3, jump_cond_imm16<Condition::C> };
+    instr[CtrlFlow::JumpRelImm8] = InstructionDef { "JR e8", 2, 3, jump_rel_imm8 };
     instr[CtrlFlow::JumpNZRelImm8]
-        = Instruction { "JR NZ e8", 2, 2, 8, jump_cond_rel_imm8<Condition::NZ> };
+        = InstructionDef { "JR NZ e8", 2, 2, jump_cond_rel_imm8<Condition::NZ> };
     instr[CtrlFlow::JumpNCRelImm8]
-        = Instruction { "JR NC e8", 2, 2, 8, jump_cond_rel_imm8<Condition::NC> };
+        = InstructionDef { "JR NC e8", 2, 2, jump_cond_rel_imm8<Condition::NC> };
     instr[CtrlFlow::JumpZRelImm8]
-        = Instruction { "JR Z e8", 2, 2, 8, jump_cond_rel_imm8<Condition::Z> };
+        = InstructionDef { "JR Z e8", 2, 2, jump_cond_rel_imm8<Condition::Z> };
     instr[CtrlFlow::JumpCRelImm8]
-        = Instruction { "JR C e8", 2, 2, 8, jump_cond_rel_imm8<Condition::C> };
-    instr[CtrlFlow::CallImm16] = Instruction { "CALL n16", 3, 6, 24, call_imm16 };
+        = InstructionDef { "JR C e8", 2, 2, jump_cond_rel_imm8<Condition::C> };
+    instr[CtrlFlow::CallImm16] = InstructionDef { "CALL n16", 3, 6, call_imm16 };
     instr[CtrlFlow::CallNZImm16]
-        = Instruction { "CALL NZ n16", 3, 3, 12, call_cond_imm16<Condition::NZ> };
+        = InstructionDef { "CALL NZ n16", 3, 3, call_cond_imm16<Condition::NZ> };
     instr[CtrlFlow::CallNCImm16]
-        = Instruction { "CALL NC n16", 3, 3, 12, call_cond_imm16<Condition::NC> };
+        = InstructionDef { "CALL NC n16", 3, 3, call_cond_imm16<Condition::NC> };
     instr[CtrlFlow::CallZImm16]
-        = Instruction { "CALL Z n16", 3, 3, 12, call_cond_imm16<Condition::Z> };
+        = InstructionDef { "CALL Z n16", 3, 3, call_cond_imm16<Condition::Z> };
     instr[CtrlFlow::CallCImm16]
-        = Instruction { "CALL C n16", 3, 3, 12, call_cond_imm16<Condition::C> };
-    instr[CtrlFlow::Return] = Instruction { "RET", 1, 4, 16, return_no_cond };
-    instr[CtrlFlow::ReturnNZ] = Instruction { "RET NZ", 1, 2, 8, return_cond<Condition::NZ> };
-    instr[CtrlFlow::ReturnNC] = Instruction { "RET NC", 1, 2, 8, return_cond<Condition::NC> };
-    instr[CtrlFlow::ReturnZ] = Instruction { "RET Z", 1, 2, 8, return_cond<Condition::Z> };
-    instr[CtrlFlow::ReturnC] = Instruction { "RET C", 1, 2, 8, return_cond<Condition::C> };
-    instr[CtrlFlow::ReturnIR] = Instruction { "RETI", 1, 4, 16, return_interrupt };
-    instr[CtrlFlow::Restart00] = Instruction { "RST $00", 1, 4, 16, restart<0x00> };
-    instr[CtrlFlow::Restart10] = Instruction { "RST $10", 1, 4, 16, restart<0x10> };
-    instr[CtrlFlow::Restart20] = Instruction { "RST $20", 1, 4, 16, restart<0x20> };
-    instr[CtrlFlow::Restart30] = Instruction { "RST $30", 1, 4, 16, restart<0x30> };
-    instr[CtrlFlow::Restart08] = Instruction { "RST $08", 1, 4, 16, restart<0x08> };
-    instr[CtrlFlow::Restart18] = Instruction { "RST $18", 1, 4, 16, restart<0x18> };
-    instr[CtrlFlow::Restart28] = Instruction { "RST $28", 1, 4, 16, restart<0x28> };
-    instr[CtrlFlow::Restart38] = Instruction { "RST $38", 1, 4, 16, restart<0x38> };
-    instr[Misc::Nop] = Instruction { "NOP", 1, 1, 4, nop };
-    instr[Misc::Stop] = Instruction { "STOP", 2, 1, 4, stop };
-    instr[Misc::Halt] = Instruction { "HALT", 1, 1, 4, halt };
-    instr[Misc::EnableIR] = Instruction { "EI", 1, 1, 4, enable_interrupt };
-    instr[Misc::DisableIR] = Instruction { "DI", 1, 1, 4, disable_interrupt };
-    instr[Misc::Illegal0] = Instruction { "???", 1, 0, 0, nullptr };
-    instr[Misc::Illegal1] = Instruction { "???", 1, 0, 0, nullptr };
-    instr[Misc::Illegal2] = Instruction { "???", 1, 0, 0, nullptr };
-    instr[Misc::Illegal3] = Instruction { "???", 1, 0, 0, nullptr };
-    instr[Misc::Illegal4] = Instruction { "???", 1, 0, 0, nullptr };
-    instr[Misc::Illegal5] = Instruction { "???", 1, 0, 0, nullptr };
-    instr[Misc::Illegal6] = Instruction { "???", 1, 0, 0, nullptr };
-    instr[Misc::Illegal7] = Instruction { "???", 1, 0, 0, nullptr };
-    instr[Misc::Illegal8] = Instruction { "???", 1, 0, 0, nullptr };
-    instr[Misc::Illegal9] = Instruction { "???", 1, 0, 0, nullptr };
-    instr[Misc::IllegalA] = Instruction { "???", 1, 0, 0, nullptr };
+        = InstructionDef { "CALL C n16", 3, 3, call_cond_imm16<Condition::C> };
+    instr[CtrlFlow::Return] = InstructionDef { "RET", 1, 4, return_no_cond };
+    instr[CtrlFlow::ReturnNZ] = InstructionDef { "RET NZ", 1, 2, return_cond<Condition::NZ> };
+    instr[CtrlFlow::ReturnNC] = InstructionDef { "RET NC", 1, 2, return_cond<Condition::NC> };
+    instr[CtrlFlow::ReturnZ] = InstructionDef { "RET Z", 1, 2, return_cond<Condition::Z> };
+    instr[CtrlFlow::ReturnC] = InstructionDef { "RET C", 1, 2, return_cond<Condition::C> };
+    instr[CtrlFlow::ReturnIR] = InstructionDef { "RETI", 1, 4, return_interrupt };
+    instr[CtrlFlow::Restart00] = InstructionDef { "RST $00", 1, 4, restart<0x00> };
+    instr[CtrlFlow::Restart10] = InstructionDef { "RST $10", 1, 4, restart<0x10> };
+    instr[CtrlFlow::Restart20] = InstructionDef { "RST $20", 1, 4, restart<0x20> };
+    instr[CtrlFlow::Restart30] = InstructionDef { "RST $30", 1, 4, restart<0x30> };
+    instr[CtrlFlow::Restart08] = InstructionDef { "RST $08", 1, 4, restart<0x08> };
+    instr[CtrlFlow::Restart18] = InstructionDef { "RST $18", 1, 4, restart<0x18> };
+    instr[CtrlFlow::Restart28] = InstructionDef { "RST $28", 1, 4, restart<0x28> };
+    instr[CtrlFlow::Restart38] = InstructionDef { "RST $38", 1, 4, restart<0x38> };
+    instr[Misc::Nop] = InstructionDef { "NOP", 1, 1, nop };
+    instr[Misc::Stop] = InstructionDef { "STOP", 2, 1, stop };
+    instr[Misc::Halt] = InstructionDef { "HALT", 1, 1, halt };
+    instr[Misc::EnableIR] = InstructionDef { "EI", 1, 1, enable_interrupt };
+    instr[Misc::DisableIR] = InstructionDef { "DI", 1, 1, disable_interrupt };
+    instr[Misc::Illegal0] = InstructionDef { "???", 1, 0, nullptr };
+    instr[Misc::Illegal1] = InstructionDef { "???", 1, 0, nullptr };
+    instr[Misc::Illegal2] = InstructionDef { "???", 1, 0, nullptr };
+    instr[Misc::Illegal3] = InstructionDef { "???", 1, 0, nullptr };
+    instr[Misc::Illegal4] = InstructionDef { "???", 1, 0, nullptr };
+    instr[Misc::Illegal5] = InstructionDef { "???", 1, 0, nullptr };
+    instr[Misc::Illegal6] = InstructionDef { "???", 1, 0, nullptr };
+    instr[Misc::Illegal7] = InstructionDef { "???", 1, 0, nullptr };
+    instr[Misc::Illegal8] = InstructionDef { "???", 1, 0, nullptr };
+    instr[Misc::Illegal9] = InstructionDef { "???", 1, 0, nullptr };
+    instr[Misc::IllegalA] = InstructionDef { "???", 1, 0, nullptr };
     return instr;
 }
 
-constexpr std::array<Instruction, CB_PREFIX_INSTR_TABLE_SIZE>
+constexpr std::array<InstructionDef, CB_PREFIX_INSTR_TABLE_SIZE>
 new_cb_prefix_instr()
 {
-    std::array<Instruction, CB_PREFIX_INSTR_TABLE_SIZE> instr = {};
-    instr[BitShift::RotateLeftCarryRegB] = Instruction { "RLC B", 2, 2, 8,
+    std::array<InstructionDef, CB_PREFIX_INSTR_TABLE_SIZE> instr = {};
+    instr[BitShift::RotateLeftCarryRegB] = InstructionDef { "RLC B", 2, 2,
         rotate<Reg8::B, Direction::Left, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateLeftCarryRegC] = Instruction { "RLC C", 2, 2, 8,
+    instr[BitShift::RotateLeftCarryRegC] = InstructionDef { "RLC C", 2, 2,
         rotate<Reg8::C, Direction::Left, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateLeftCarryRegD] = Instruction { "RLC D", 2, 2, 8,
+    instr[BitShift::RotateLeftCarryRegD] = InstructionDef { "RLC D", 2, 2,
         rotate<Reg8::D, Direction::Left, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateLeftCarryRegE] = Instruction { "RLC E", 2, 2, 8,
+    instr[BitShift::RotateLeftCarryRegE] = InstructionDef { "RLC E", 2, 2,
         rotate<Reg8::E, Direction::Left, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateLeftCarryRegH] = Instruction { "RLC H", 2, 2, 8,
+    instr[BitShift::RotateLeftCarryRegH] = InstructionDef { "RLC H", 2, 2,
         rotate<Reg8::H, Direction::Left, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateLeftCarryRegL] = Instruction { "RLC L", 2, 2, 8,
+    instr[BitShift::RotateLeftCarryRegL] = InstructionDef { "RLC L", 2, 2,
         rotate<Reg8::L, Direction::Left, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateLeftCarryRegA] = Instruction { "RLC A", 2, 2, 8,
+    instr[BitShift::RotateLeftCarryRegA] = InstructionDef { "RLC A", 2, 2,
         rotate<Reg8::A, Direction::Left, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateRightCarryRegB] = Instruction { "RRC B", 2, 2, 8,
+    instr[BitShift::RotateRightCarryRegB] = InstructionDef { "RRC B", 2, 2,
         rotate<Reg8::B, Direction::Right, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateRightCarryRegC] = Instruction { "RRC C", 2, 2, 8,
+    instr[BitShift::RotateRightCarryRegC] = InstructionDef { "RRC C", 2, 2,
         rotate<Reg8::C, Direction::Right, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateRightCarryRegD] = Instruction { "RRC D", 2, 2, 8,
+    instr[BitShift::RotateRightCarryRegD] = InstructionDef { "RRC D", 2, 2,
         rotate<Reg8::D, Direction::Right, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateRightCarryRegE] = Instruction { "RRC E", 2, 2, 8,
+    instr[BitShift::RotateRightCarryRegE] = InstructionDef { "RRC E", 2, 2,
         rotate<Reg8::E, Direction::Right, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateRightCarryRegH] = Instruction { "RRC H", 2, 2, 8,
+    instr[BitShift::RotateRightCarryRegH] = InstructionDef { "RRC H", 2, 2,
         rotate<Reg8::H, Direction::Right, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateRightCarryRegL] = Instruction { "RRC L", 2, 2, 8,
+    instr[BitShift::RotateRightCarryRegL] = InstructionDef { "RRC L", 2, 2,
         rotate<Reg8::L, Direction::Right, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateRightCarryRegA] = Instruction { "RRC A", 2, 2, 8,
+    instr[BitShift::RotateRightCarryRegA] = InstructionDef { "RRC A", 2, 2,
         rotate<Reg8::A, Direction::Right, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateLeftRegB] = Instruction { "RL B", 2, 2, 8,
+    instr[BitShift::RotateLeftRegB] = InstructionDef { "RL B", 2, 2,
         rotate<Reg8::B, Direction::Left, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateLeftRegC] = Instruction { "RL C", 2, 2, 8,
+    instr[BitShift::RotateLeftRegC] = InstructionDef { "RL C", 2, 2,
         rotate<Reg8::C, Direction::Left, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateLeftRegD] = Instruction { "RL D", 2, 2, 8,
+    instr[BitShift::RotateLeftRegD] = InstructionDef { "RL D", 2, 2,
         rotate<Reg8::D, Direction::Left, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateLeftRegE] = Instruction { "RL E", 2, 2, 8,
+    instr[BitShift::RotateLeftRegE] = InstructionDef { "RL E", 2, 2,
         rotate<Reg8::E, Direction::Left, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateLeftRegH] = Instruction { "RL H", 2, 2, 8,
+    instr[BitShift::RotateLeftRegH] = InstructionDef { "RL H", 2, 2,
         rotate<Reg8::H, Direction::Left, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateLeftRegL] = Instruction { "RL L", 2, 2, 8,
+    instr[BitShift::RotateLeftRegL] = InstructionDef { "RL L", 2, 2,
         rotate<Reg8::L, Direction::Left, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateLeftRegA] = Instruction { "RL A", 2, 2, 8,
+    instr[BitShift::RotateLeftRegA] = InstructionDef { "RL A", 2, 2,
         rotate<Reg8::A, Direction::Left, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateRightRegB] = Instruction { "RR B", 2, 2, 8,
+    instr[BitShift::RotateRightRegB] = InstructionDef { "RR B", 2, 2,
         rotate<Reg8::B, Direction::Right, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateRightRegC] = Instruction { "RR C", 2, 2, 8,
+    instr[BitShift::RotateRightRegC] = InstructionDef { "RR C", 2, 2,
         rotate<Reg8::C, Direction::Right, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateRightRegD] = Instruction { "RR D", 2, 2, 8,
+    instr[BitShift::RotateRightRegD] = InstructionDef { "RR D", 2, 2,
         rotate<Reg8::D, Direction::Right, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateRightRegE] = Instruction { "RR E", 2, 2, 8,
+    instr[BitShift::RotateRightRegE] = InstructionDef { "RR E", 2, 2,
         rotate<Reg8::E, Direction::Right, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateRightRegH] = Instruction { "RR H", 2, 2, 8,
+    instr[BitShift::RotateRightRegH] = InstructionDef { "RR H", 2, 2,
         rotate<Reg8::H, Direction::Right, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateRightRegL] = Instruction { "RR L", 2, 2, 8,
+    instr[BitShift::RotateRightRegL] = InstructionDef { "RR L", 2, 2,
         rotate<Reg8::L, Direction::Right, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateRightRegA] = Instruction { "RR A", 2, 2, 8,
+    instr[BitShift::RotateRightRegA] = InstructionDef { "RR A", 2, 2,
         rotate<Reg8::A, Direction::Right, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateLeftCarryIndirHL] = Instruction { "RLC [HL]", 2, 4, 16,
+    instr[BitShift::RotateLeftCarryIndirHL] = InstructionDef { "RLC [HL]", 2, 4,
         rotate<Reg8::IndirHL, Direction::Left, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateRightCarryIndirHL] = Instruction { "RRC [HL]", 2, 4, 16,
+    instr[BitShift::RotateRightCarryIndirHL] = InstructionDef { "RRC [HL]", 2, 4,
         rotate<Reg8::IndirHL, Direction::Right, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateLeftIndirHL] = Instruction { "RL [HL]", 2, 4, 16,
+    instr[BitShift::RotateLeftIndirHL] = InstructionDef { "RL [HL]", 2, 4,
         rotate<Reg8::IndirHL, Direction::Left, UseZero::Yes, UseCarry::Yes> };
-    instr[BitShift::RotateRightIndirHL] = Instruction { "RR [HL]", 2, 4, 16,
+    instr[BitShift::RotateRightIndirHL] = InstructionDef { "RR [HL]", 2, 4,
         rotate<Reg8::IndirHL, Direction::Right, UseZero::Yes, UseCarry::Yes> };
     instr[BitShift::ShiftLeftArithRegB]
-        = Instruction { "SLA B", 2, 2, 8, shift<Reg8::B, Direction::Left, Shift::Arithmatic> };
+        = InstructionDef { "SLA B", 2, 2, shift<Reg8::B, Direction::Left, Shift::Arithmatic> };
     instr[BitShift::ShiftLeftArithRegC]
-        = Instruction { "SLA C", 2, 2, 8, shift<Reg8::C, Direction::Left, Shift::Arithmatic> };
+        = InstructionDef { "SLA C", 2, 2, shift<Reg8::C, Direction::Left, Shift::Arithmatic> };
     instr[BitShift::ShiftLeftArithRegD]
-        = Instruction { "SLA D", 2, 2, 8, shift<Reg8::D, Direction::Left, Shift::Arithmatic> };
+        = InstructionDef { "SLA D", 2, 2, shift<Reg8::D, Direction::Left, Shift::Arithmatic> };
     instr[BitShift::ShiftLeftArithRegE]
-        = Instruction { "SLA E", 2, 2, 8, shift<Reg8::E, Direction::Left, Shift::Arithmatic> };
+        = InstructionDef { "SLA E", 2, 2, shift<Reg8::E, Direction::Left, Shift::Arithmatic> };
     instr[BitShift::ShiftLeftArithRegH]
-        = Instruction { "SLA H", 2, 2, 8, shift<Reg8::H, Direction::Left, Shift::Arithmatic> };
+        = InstructionDef { "SLA H", 2, 2, shift<Reg8::H, Direction::Left, Shift::Arithmatic> };
     instr[BitShift::ShiftLeftArithRegL]
-        = Instruction { "SLA L", 2, 2, 8, shift<Reg8::L, Direction::Left, Shift::Arithmatic> };
+        = InstructionDef { "SLA L", 2, 2, shift<Reg8::L, Direction::Left, Shift::Arithmatic> };
     instr[BitShift::ShiftLeftArithRegA]
-        = Instruction { "SLA A", 2, 2, 8, shift<Reg8::A, Direction::Left, Shift::Arithmatic> };
-    instr[BitShift::ShiftLeftArithIndirHL] = Instruction { "SLA [HL]", 2, 4, 16,
+        = InstructionDef { "SLA A", 2, 2, shift<Reg8::A, Direction::Left, Shift::Arithmatic> };
+    instr[BitShift::ShiftLeftArithIndirHL] = InstructionDef { "SLA [HL]", 2, 4,
         shift<Reg8::IndirHL, Direction::Left, Shift::Arithmatic> };
     instr[BitShift::ShiftRightArithRegB]
-        = Instruction { "SRA B", 2, 2, 8, shift<Reg8::B, Direction::Right, Shift::Arithmatic> };
+        = InstructionDef { "SRA B", 2, 2, shift<Reg8::B, Direction::Right, Shift::Arithmatic> };
     instr[BitShift::ShiftRightArithRegC]
-        = Instruction { "SRA C", 2, 2, 8, shift<Reg8::C, Direction::Right, Shift::Arithmatic> };
+        = InstructionDef { "SRA C", 2, 2, shift<Reg8::C, Direction::Right, Shift::Arithmatic> };
     instr[BitShift::ShiftRightArithRegD]
-        = Instruction { "SRA D", 2, 2, 8, shift<Reg8::D, Direction::Right, Shift::Arithmatic> };
+        = InstructionDef { "SRA D", 2, 2, shift<Reg8::D, Direction::Right, Shift::Arithmatic> };
     instr[BitShift::ShiftRightArithRegE]
-        = Instruction { "SRA E", 2, 2, 8, shift<Reg8::E, Direction::Right, Shift::Arithmatic> };
+        = InstructionDef { "SRA E", 2, 2, shift<Reg8::E, Direction::Right, Shift::Arithmatic> };
     instr[BitShift::ShiftRightArithRegH]
-        = Instruction { "SRA H", 2, 2, 8, shift<Reg8::H, Direction::Right, Shift::Arithmatic> };
+        = InstructionDef { "SRA H", 2, 2, shift<Reg8::H, Direction::Right, Shift::Arithmatic> };
     instr[BitShift::ShiftRightArithRegL]
-        = Instruction { "SRA L", 2, 2, 8, shift<Reg8::L, Direction::Right, Shift::Arithmatic> };
+        = InstructionDef { "SRA L", 2, 2, shift<Reg8::L, Direction::Right, Shift::Arithmatic> };
     instr[BitShift::ShiftRightArithRegA]
-        = Instruction { "SRA A", 2, 2, 8, shift<Reg8::A, Direction::Right, Shift::Arithmatic> };
-    instr[BitShift::ShiftRightArithIndirHL] = Instruction { "SRA [HL]", 2, 4, 16,
+        = InstructionDef { "SRA A", 2, 2, shift<Reg8::A, Direction::Right, Shift::Arithmatic> };
+    instr[BitShift::ShiftRightArithIndirHL] = InstructionDef { "SRA [HL]", 2, 4,
         shift<Reg8::IndirHL, Direction::Right, Shift::Arithmatic> };
     instr[BitShift::ShiftRightLogicRegB]
-        = Instruction { "SRL B", 2, 2, 8, shift<Reg8::B, Direction::Right, Shift::Logical> };
+        = InstructionDef { "SRL B", 2, 2, shift<Reg8::B, Direction::Right, Shift::Logical> };
     instr[BitShift::ShiftRightLogicRegC]
-        = Instruction { "SRL C", 2, 2, 8, shift<Reg8::C, Direction::Right, Shift::Logical> };
+        = InstructionDef { "SRL C", 2, 2, shift<Reg8::C, Direction::Right, Shift::Logical> };
     instr[BitShift::ShiftRightLogicRegD]
-        = Instruction { "SRL D", 2, 2, 8, shift<Reg8::D, Direction::Right, Shift::Logical> };
+        = InstructionDef { "SRL D", 2, 2, shift<Reg8::D, Direction::Right, Shift::Logical> };
     instr[BitShift::ShiftRightLogicRegE]
-        = Instruction { "SRL E", 2, 2, 8, shift<Reg8::E, Direction::Right, Shift::Logical> };
+        = InstructionDef { "SRL E", 2, 2, shift<Reg8::E, Direction::Right, Shift::Logical> };
     instr[BitShift::ShiftRightLogicRegH]
-        = Instruction { "SRL H", 2, 2, 8, shift<Reg8::H, Direction::Right, Shift::Logical> };
+        = InstructionDef { "SRL H", 2, 2, shift<Reg8::H, Direction::Right, Shift::Logical> };
     instr[BitShift::ShiftRightLogicRegL]
-        = Instruction { "SRL L", 2, 2, 8, shift<Reg8::L, Direction::Right, Shift::Logical> };
+        = InstructionDef { "SRL L", 2, 2, shift<Reg8::L, Direction::Right, Shift::Logical> };
     instr[BitShift::ShiftRightLogicRegA]
-        = Instruction { "SRL A", 2, 2, 8, shift<Reg8::A, Direction::Right, Shift::Logical> };
-    instr[BitShift::ShiftRightLogicIndirHL] = Instruction { "SRL [HL]", 2, 4, 16,
+        = InstructionDef { "SRL A", 2, 2, shift<Reg8::A, Direction::Right, Shift::Logical> };
+    instr[BitShift::ShiftRightLogicIndirHL] = InstructionDef { "SRL [HL]", 2, 4,
         shift<Reg8::IndirHL, Direction::Right, Shift::Logical> };
-    instr[BitShift::SwapRegB] = Instruction { "SWAP B", 2, 2, 8, swap<Reg8::B> };
-    instr[BitShift::SwapRegC] = Instruction { "SWAP C", 2, 2, 8, swap<Reg8::C> };
-    instr[BitShift::SwapRegD] = Instruction { "SWAP D", 2, 2, 8, swap<Reg8::D> };
-    instr[BitShift::SwapRegE] = Instruction { "SWAP E", 2, 2, 8, swap<Reg8::E> };
-    instr[BitShift::SwapRegH] = Instruction { "SWAP H", 2, 2, 8, swap<Reg8::H> };
-    instr[BitShift::SwapRegL] = Instruction { "SWAP L", 2, 2, 8, swap<Reg8::L> };
-    instr[BitShift::SwapRegA] = Instruction { "SWAP A", 2, 2, 8, swap<Reg8::A> };
-    instr[BitShift::SwapIndirHL] = Instruction { "SWAP [HL]", 2, 4, 16, swap<Reg8::IndirHL> };
-    instr[BitFlag::Bit0RegB] = Instruction { "BIT 0, B", 2, 2, 8, test_bit<0, Reg8::B> };
-    instr[BitFlag::Bit0RegC] = Instruction { "BIT 0, C", 2, 2, 8, test_bit<0, Reg8::C> };
-    instr[BitFlag::Bit0RegD] = Instruction { "BIT 0, D", 2, 2, 8, test_bit<0, Reg8::D> };
-    instr[BitFlag::Bit0RegE] = Instruction { "BIT 0, E", 2, 2, 8, test_bit<0, Reg8::E> };
-    instr[BitFlag::Bit0RegH] = Instruction { "BIT 0, H", 2, 2, 8, test_bit<0, Reg8::H> };
-    instr[BitFlag::Bit0RegL] = Instruction { "BIT 0, L", 2, 2, 8, test_bit<0, Reg8::L> };
-    instr[BitFlag::Bit0RegA] = Instruction { "BIT 0, A", 2, 2, 8, test_bit<0, Reg8::A> };
-    instr[BitFlag::Bit1RegB] = Instruction { "BIT 1, B", 2, 2, 8, test_bit<1, Reg8::B> };
-    instr[BitFlag::Bit1RegC] = Instruction { "BIT 1, C", 2, 2, 8, test_bit<1, Reg8::C> };
-    instr[BitFlag::Bit1RegD] = Instruction { "BIT 1, D", 2, 2, 8, test_bit<1, Reg8::D> };
-    instr[BitFlag::Bit1RegE] = Instruction { "BIT 1, E", 2, 2, 8, test_bit<1, Reg8::E> };
-    instr[BitFlag::Bit1RegH] = Instruction { "BIT 1, H", 2, 2, 8, test_bit<1, Reg8::H> };
-    instr[BitFlag::Bit1RegL] = Instruction { "BIT 1, L", 2, 2, 8, test_bit<1, Reg8::L> };
-    instr[BitFlag::Bit1RegA] = Instruction { "BIT 1, A", 2, 2, 8, test_bit<1, Reg8::A> };
-    instr[BitFlag::Bit2RegB] = Instruction { "BIT 2, B", 2, 2, 8, test_bit<2, Reg8::B> };
-    instr[BitFlag::Bit2RegC] = Instruction { "BIT 2, C", 2, 2, 8, test_bit<2, Reg8::C> };
-    instr[BitFlag::Bit2RegD] = Instruction { "BIT 2, D", 2, 2, 8, test_bit<2, Reg8::D> };
-    instr[BitFlag::Bit2RegE] = Instruction { "BIT 2, E", 2, 2, 8, test_bit<2, Reg8::E> };
-    instr[BitFlag::Bit2RegH] = Instruction { "BIT 2, H", 2, 2, 8, test_bit<2, Reg8::H> };
-    instr[BitFlag::Bit2RegL] = Instruction { "BIT 2, L", 2, 2, 8, test_bit<2, Reg8::L> };
-    instr[BitFlag::Bit2RegA] = Instruction { "BIT 2, A", 2, 2, 8, test_bit<2, Reg8::A> };
-    instr[BitFlag::Bit3RegB] = Instruction { "BIT 3, B", 2, 2, 8, test_bit<3, Reg8::B> };
-    instr[BitFlag::Bit3RegC] = Instruction { "BIT 3, C", 2, 2, 8, test_bit<3, Reg8::C> };
-    instr[BitFlag::Bit3RegD] = Instruction { "BIT 3, D", 2, 2, 8, test_bit<3, Reg8::D> };
-    instr[BitFlag::Bit3RegE] = Instruction { "BIT 3, E", 2, 2, 8, test_bit<3, Reg8::E> };
-    instr[BitFlag::Bit3RegH] = Instruction { "BIT 3, H", 2, 2, 8, test_bit<3, Reg8::H> };
-    instr[BitFlag::Bit3RegL] = Instruction { "BIT 3, L", 2, 2, 8, test_bit<3, Reg8::L> };
-    instr[BitFlag::Bit3RegA] = Instruction { "BIT 3, A", 2, 2, 8, test_bit<3, Reg8::A> };
-    instr[BitFlag::Bit4RegB] = Instruction { "BIT 4, B", 2, 2, 8, test_bit<4, Reg8::B> };
-    instr[BitFlag::Bit4RegC] = Instruction { "BIT 4, C", 2, 2, 8, test_bit<4, Reg8::C> };
-    instr[BitFlag::Bit4RegD] = Instruction { "BIT 4, D", 2, 2, 8, test_bit<4, Reg8::D> };
-    instr[BitFlag::Bit4RegE] = Instruction { "BIT 4, E", 2, 2, 8, test_bit<4, Reg8::E> };
-    instr[BitFlag::Bit4RegH] = Instruction { "BIT 4, H", 2, 2, 8, test_bit<4, Reg8::H> };
-    instr[BitFlag::Bit4RegL] = Instruction { "BIT 4, L", 2, 2, 8, test_bit<4, Reg8::L> };
-    instr[BitFlag::Bit4RegA] = Instruction { "BIT 4, A", 2, 2, 8, test_bit<4, Reg8::A> };
-    instr[BitFlag::Bit5RegB] = Instruction { "BIT 5, B", 2, 2, 8, test_bit<5, Reg8::B> };
-    instr[BitFlag::Bit5RegC] = Instruction { "BIT 5, C", 2, 2, 8, test_bit<5, Reg8::C> };
-    instr[BitFlag::Bit5RegD] = Instruction { "BIT 5, D", 2, 2, 8, test_bit<5, Reg8::D> };
-    instr[BitFlag::Bit5RegE] = Instruction { "BIT 5, E", 2, 2, 8, test_bit<5, Reg8::E> };
-    instr[BitFlag::Bit5RegH] = Instruction { "BIT 5, H", 2, 2, 8, test_bit<5, Reg8::H> };
-    instr[BitFlag::Bit5RegL] = Instruction { "BIT 5, L", 2, 2, 8, test_bit<5, Reg8::L> };
-    instr[BitFlag::Bit5RegA] = Instruction { "BIT 5, A", 2, 2, 8, test_bit<5, Reg8::A> };
-    instr[BitFlag::Bit6RegB] = Instruction { "BIT 6, B", 2, 2, 8, test_bit<6, Reg8::B> };
-    instr[BitFlag::Bit6RegC] = Instruction { "BIT 6, C", 2, 2, 8, test_bit<6, Reg8::C> };
-    instr[BitFlag::Bit6RegD] = Instruction { "BIT 6, D", 2, 2, 8, test_bit<6, Reg8::D> };
-    instr[BitFlag::Bit6RegE] = Instruction { "BIT 6, E", 2, 2, 8, test_bit<6, Reg8::E> };
-    instr[BitFlag::Bit6RegH] = Instruction { "BIT 6, H", 2, 2, 8, test_bit<6, Reg8::H> };
-    instr[BitFlag::Bit6RegL] = Instruction { "BIT 6, L", 2, 2, 8, test_bit<6, Reg8::L> };
-    instr[BitFlag::Bit6RegA] = Instruction { "BIT 6, A", 2, 2, 8, test_bit<6, Reg8::A> };
-    instr[BitFlag::Bit7RegB] = Instruction { "BIT 7, B", 2, 2, 8, test_bit<7, Reg8::B> };
-    instr[BitFlag::Bit7RegC] = Instruction { "BIT 7, C", 2, 2, 8, test_bit<7, Reg8::C> };
-    instr[BitFlag::Bit7RegD] = Instruction { "BIT 7, D", 2, 2, 8, test_bit<7, Reg8::D> };
-    instr[BitFlag::Bit7RegE] = Instruction { "BIT 7, E", 2, 2, 8, test_bit<7, Reg8::E> };
-    instr[BitFlag::Bit7RegH] = Instruction { "BIT 7, H", 2, 2, 8, test_bit<7, Reg8::H> };
-    instr[BitFlag::Bit7RegL] = Instruction { "BIT 7, L", 2, 2, 8, test_bit<7, Reg8::L> };
-    instr[BitFlag::Bit7RegA] = Instruction { "BIT 7, A", 2, 2, 8, test_bit<7, Reg8::A> };
+    instr[BitShift::SwapRegB] = InstructionDef { "SWAP B", 2, 2, swap<Reg8::B> };
+    instr[BitShift::SwapRegC] = InstructionDef { "SWAP C", 2, 2, swap<Reg8::C> };
+    instr[BitShift::SwapRegD] = InstructionDef { "SWAP D", 2, 2, swap<Reg8::D> };
+    instr[BitShift::SwapRegE] = InstructionDef { "SWAP E", 2, 2, swap<Reg8::E> };
+    instr[BitShift::SwapRegH] = InstructionDef { "SWAP H", 2, 2, swap<Reg8::H> };
+    instr[BitShift::SwapRegL] = InstructionDef { "SWAP L", 2, 2, swap<Reg8::L> };
+    instr[BitShift::SwapRegA] = InstructionDef { "SWAP A", 2, 2, swap<Reg8::A> };
+    instr[BitShift::SwapIndirHL] = InstructionDef { "SWAP [HL]", 2, 4, swap<Reg8::IndirHL> };
+    instr[BitFlag::Bit0RegB] = InstructionDef { "BIT 0, B", 2, 2, test_bit<0, Reg8::B> };
+    instr[BitFlag::Bit0RegC] = InstructionDef { "BIT 0, C", 2, 2, test_bit<0, Reg8::C> };
+    instr[BitFlag::Bit0RegD] = InstructionDef { "BIT 0, D", 2, 2, test_bit<0, Reg8::D> };
+    instr[BitFlag::Bit0RegE] = InstructionDef { "BIT 0, E", 2, 2, test_bit<0, Reg8::E> };
+    instr[BitFlag::Bit0RegH] = InstructionDef { "BIT 0, H", 2, 2, test_bit<0, Reg8::H> };
+    instr[BitFlag::Bit0RegL] = InstructionDef { "BIT 0, L", 2, 2, test_bit<0, Reg8::L> };
+    instr[BitFlag::Bit0RegA] = InstructionDef { "BIT 0, A", 2, 2, test_bit<0, Reg8::A> };
+    instr[BitFlag::Bit1RegB] = InstructionDef { "BIT 1, B", 2, 2, test_bit<1, Reg8::B> };
+    instr[BitFlag::Bit1RegC] = InstructionDef { "BIT 1, C", 2, 2, test_bit<1, Reg8::C> };
+    instr[BitFlag::Bit1RegD] = InstructionDef { "BIT 1, D", 2, 2, test_bit<1, Reg8::D> };
+    instr[BitFlag::Bit1RegE] = InstructionDef { "BIT 1, E", 2, 2, test_bit<1, Reg8::E> };
+    instr[BitFlag::Bit1RegH] = InstructionDef { "BIT 1, H", 2, 2, test_bit<1, Reg8::H> };
+    instr[BitFlag::Bit1RegL] = InstructionDef { "BIT 1, L", 2, 2, test_bit<1, Reg8::L> };
+    instr[BitFlag::Bit1RegA] = InstructionDef { "BIT 1, A", 2, 2, test_bit<1, Reg8::A> };
+    instr[BitFlag::Bit2RegB] = InstructionDef { "BIT 2, B", 2, 2, test_bit<2, Reg8::B> };
+    instr[BitFlag::Bit2RegC] = InstructionDef { "BIT 2, C", 2, 2, test_bit<2, Reg8::C> };
+    instr[BitFlag::Bit2RegD] = InstructionDef { "BIT 2, D", 2, 2, test_bit<2, Reg8::D> };
+    instr[BitFlag::Bit2RegE] = InstructionDef { "BIT 2, E", 2, 2, test_bit<2, Reg8::E> };
+    instr[BitFlag::Bit2RegH] = InstructionDef { "BIT 2, H", 2, 2, test_bit<2, Reg8::H> };
+    instr[BitFlag::Bit2RegL] = InstructionDef { "BIT 2, L", 2, 2, test_bit<2, Reg8::L> };
+    instr[BitFlag::Bit2RegA] = InstructionDef { "BIT 2, A", 2, 2, test_bit<2, Reg8::A> };
+    instr[BitFlag::Bit3RegB] = InstructionDef { "BIT 3, B", 2, 2, test_bit<3, Reg8::B> };
+    instr[BitFlag::Bit3RegC] = InstructionDef { "BIT 3, C", 2, 2, test_bit<3, Reg8::C> };
+    instr[BitFlag::Bit3RegD] = InstructionDef { "BIT 3, D", 2, 2, test_bit<3, Reg8::D> };
+    instr[BitFlag::Bit3RegE] = InstructionDef { "BIT 3, E", 2, 2, test_bit<3, Reg8::E> };
+    instr[BitFlag::Bit3RegH] = InstructionDef { "BIT 3, H", 2, 2, test_bit<3, Reg8::H> };
+    instr[BitFlag::Bit3RegL] = InstructionDef { "BIT 3, L", 2, 2, test_bit<3, Reg8::L> };
+    instr[BitFlag::Bit3RegA] = InstructionDef { "BIT 3, A", 2, 2, test_bit<3, Reg8::A> };
+    instr[BitFlag::Bit4RegB] = InstructionDef { "BIT 4, B", 2, 2, test_bit<4, Reg8::B> };
+    instr[BitFlag::Bit4RegC] = InstructionDef { "BIT 4, C", 2, 2, test_bit<4, Reg8::C> };
+    instr[BitFlag::Bit4RegD] = InstructionDef { "BIT 4, D", 2, 2, test_bit<4, Reg8::D> };
+    instr[BitFlag::Bit4RegE] = InstructionDef { "BIT 4, E", 2, 2, test_bit<4, Reg8::E> };
+    instr[BitFlag::Bit4RegH] = InstructionDef { "BIT 4, H", 2, 2, test_bit<4, Reg8::H> };
+    instr[BitFlag::Bit4RegL] = InstructionDef { "BIT 4, L", 2, 2, test_bit<4, Reg8::L> };
+    instr[BitFlag::Bit4RegA] = InstructionDef { "BIT 4, A", 2, 2, test_bit<4, Reg8::A> };
+    instr[BitFlag::Bit5RegB] = InstructionDef { "BIT 5, B", 2, 2, test_bit<5, Reg8::B> };
+    instr[BitFlag::Bit5RegC] = InstructionDef { "BIT 5, C", 2, 2, test_bit<5, Reg8::C> };
+    instr[BitFlag::Bit5RegD] = InstructionDef { "BIT 5, D", 2, 2, test_bit<5, Reg8::D> };
+    instr[BitFlag::Bit5RegE] = InstructionDef { "BIT 5, E", 2, 2, test_bit<5, Reg8::E> };
+    instr[BitFlag::Bit5RegH] = InstructionDef { "BIT 5, H", 2, 2, test_bit<5, Reg8::H> };
+    instr[BitFlag::Bit5RegL] = InstructionDef { "BIT 5, L", 2, 2, test_bit<5, Reg8::L> };
+    instr[BitFlag::Bit5RegA] = InstructionDef { "BIT 5, A", 2, 2, test_bit<5, Reg8::A> };
+    instr[BitFlag::Bit6RegB] = InstructionDef { "BIT 6, B", 2, 2, test_bit<6, Reg8::B> };
+    instr[BitFlag::Bit6RegC] = InstructionDef { "BIT 6, C", 2, 2, test_bit<6, Reg8::C> };
+    instr[BitFlag::Bit6RegD] = InstructionDef { "BIT 6, D", 2, 2, test_bit<6, Reg8::D> };
+    instr[BitFlag::Bit6RegE] = InstructionDef { "BIT 6, E", 2, 2, test_bit<6, Reg8::E> };
+    instr[BitFlag::Bit6RegH] = InstructionDef { "BIT 6, H", 2, 2, test_bit<6, Reg8::H> };
+    instr[BitFlag::Bit6RegL] = InstructionDef { "BIT 6, L", 2, 2, test_bit<6, Reg8::L> };
+    instr[BitFlag::Bit6RegA] = InstructionDef { "BIT 6, A", 2, 2, test_bit<6, Reg8::A> };
+    instr[BitFlag::Bit7RegB] = InstructionDef { "BIT 7, B", 2, 2, test_bit<7, Reg8::B> };
+    instr[BitFlag::Bit7RegC] = InstructionDef { "BIT 7, C", 2, 2, test_bit<7, Reg8::C> };
+    instr[BitFlag::Bit7RegD] = InstructionDef { "BIT 7, D", 2, 2, test_bit<7, Reg8::D> };
+    instr[BitFlag::Bit7RegE] = InstructionDef { "BIT 7, E", 2, 2, test_bit<7, Reg8::E> };
+    instr[BitFlag::Bit7RegH] = InstructionDef { "BIT 7, H", 2, 2, test_bit<7, Reg8::H> };
+    instr[BitFlag::Bit7RegL] = InstructionDef { "BIT 7, L", 2, 2, test_bit<7, Reg8::L> };
+    instr[BitFlag::Bit7RegA] = InstructionDef { "BIT 7, A", 2, 2, test_bit<7, Reg8::A> };
     instr[BitFlag::Bit0IndirHL]
-        = Instruction { "BIT 0, [HL]", 2, 3, 12, test_bit<0, Reg8::IndirHL> };
+        = InstructionDef { "BIT 0, [HL]", 2, 3, test_bit<0, Reg8::IndirHL> };
     instr[BitFlag::Bit1IndirHL]
-        = Instruction { "BIT 1, [HL]", 2, 3, 12, test_bit<1, Reg8::IndirHL> };
+        = InstructionDef { "BIT 1, [HL]", 2, 3, test_bit<1, Reg8::IndirHL> };
     instr[BitFlag::Bit2IndirHL]
-        = Instruction { "BIT 2, [HL]", 2, 3, 12, test_bit<2, Reg8::IndirHL> };
+        = InstructionDef { "BIT 2, [HL]", 2, 3, test_bit<2, Reg8::IndirHL> };
     instr[BitFlag::Bit3IndirHL]
-        = Instruction { "BIT 3, [HL]", 2, 3, 12, test_bit<3, Reg8::IndirHL> };
+        = InstructionDef { "BIT 3, [HL]", 2, 3, test_bit<3, Reg8::IndirHL> };
     instr[BitFlag::Bit4IndirHL]
-        = Instruction { "BIT 4, [HL]", 2, 3, 12, test_bit<4, Reg8::IndirHL> };
+        = InstructionDef { "BIT 4, [HL]", 2, 3, test_bit<4, Reg8::IndirHL> };
     instr[BitFlag::Bit5IndirHL]
-        = Instruction { "BIT 5, [HL]", 2, 3, 12, test_bit<5, Reg8::IndirHL> };
+        = InstructionDef { "BIT 5, [HL]", 2, 3, test_bit<5, Reg8::IndirHL> };
     instr[BitFlag::Bit6IndirHL]
-        = Instruction { "BIT 6, [HL]", 2, 3, 12, test_bit<6, Reg8::IndirHL> };
+        = InstructionDef { "BIT 6, [HL]", 2, 3, test_bit<6, Reg8::IndirHL> };
     instr[BitFlag::Bit7IndirHL]
-        = Instruction { "BIT 7, [HL]", 2, 3, 12, test_bit<7, Reg8::IndirHL> };
-    instr[BitFlag::Reset0RegB] = Instruction { "RES 0, B", 2, 2, 8, reset_bit<0, Reg8::B> };
-    instr[BitFlag::Reset0RegC] = Instruction { "RES 0, C", 2, 2, 8, reset_bit<0, Reg8::C> };
-    instr[BitFlag::Reset0RegD] = Instruction { "RES 0, D", 2, 2, 8, reset_bit<0, Reg8::D> };
-    instr[BitFlag::Reset0RegE] = Instruction { "RES 0, E", 2, 2, 8, reset_bit<0, Reg8::E> };
-    instr[BitFlag::Reset0RegH] = Instruction { "RES 0, H", 2, 2, 8, reset_bit<0, Reg8::H> };
-    instr[BitFlag::Reset0RegL] = Instruction { "RES 0, L", 2, 2, 8, reset_bit<0, Reg8::L> };
-    instr[BitFlag::Reset0RegA] = Instruction { "RES 0, A", 2, 2, 8, reset_bit<0, Reg8::A> };
-    instr[BitFlag::Reset1RegB] = Instruction { "RES 1, B", 2, 2, 8, reset_bit<1, Reg8::B> };
-    instr[BitFlag::Reset1RegC] = Instruction { "RES 1, C", 2, 2, 8, reset_bit<1, Reg8::C> };
-    instr[BitFlag::Reset1RegD] = Instruction { "RES 1, D", 2, 2, 8, reset_bit<1, Reg8::D> };
-    instr[BitFlag::Reset1RegE] = Instruction { "RES 1, E", 2, 2, 8, reset_bit<1, Reg8::E> };
-    instr[BitFlag::Reset1RegH] = Instruction { "RES 1, H", 2, 2, 8, reset_bit<1, Reg8::H> };
-    instr[BitFlag::Reset1RegL] = Instruction { "RES 1, L", 2, 2, 8, reset_bit<1, Reg8::L> };
-    instr[BitFlag::Reset1RegA] = Instruction { "RES 1, A", 2, 2, 8, reset_bit<1, Reg8::A> };
-    instr[BitFlag::Reset2RegB] = Instruction { "RES 2, B", 2, 2, 8, reset_bit<2, Reg8::B> };
-    instr[BitFlag::Reset2RegC] = Instruction { "RES 2, C", 2, 2, 8, reset_bit<2, Reg8::C> };
-    instr[BitFlag::Reset2RegD] = Instruction { "RES 2, D", 2, 2, 8, reset_bit<2, Reg8::D> };
-    instr[BitFlag::Reset2RegE] = Instruction { "RES 2, E", 2, 2, 8, reset_bit<2, Reg8::E> };
-    instr[BitFlag::Reset2RegH] = Instruction { "RES 2, H", 2, 2, 8, reset_bit<2, Reg8::H> };
-    instr[BitFlag::Reset2RegL] = Instruction { "RES 2, L", 2, 2, 8, reset_bit<2, Reg8::L> };
-    instr[BitFlag::Reset2RegA] = Instruction { "RES 2, A", 2, 2, 8, reset_bit<2, Reg8::A> };
-    instr[BitFlag::Reset3RegB] = Instruction { "RES 3, B", 2, 2, 8, reset_bit<3, Reg8::B> };
-    instr[BitFlag::Reset3RegC] = Instruction { "RES 3, C", 2, 2, 8, reset_bit<3, Reg8::C> };
-    instr[BitFlag::Reset3RegD] = Instruction { "RES 3, D", 2, 2, 8, reset_bit<3, Reg8::D> };
-    instr[BitFlag::Reset3RegE] = Instruction { "RES 3, E", 2, 2, 8, reset_bit<3, Reg8::E> };
-    instr[BitFlag::Reset3RegH] = Instruction { "RES 3, H", 2, 2, 8, reset_bit<3, Reg8::H> };
-    instr[BitFlag::Reset3RegL] = Instruction { "RES 3, L", 2, 2, 8, reset_bit<3, Reg8::L> };
-    instr[BitFlag::Reset3RegA] = Instruction { "RES 3, A", 2, 2, 8, reset_bit<3, Reg8::A> };
-    instr[BitFlag::Reset4RegB] = Instruction { "RES 4, B", 2, 2, 8, reset_bit<4, Reg8::B> };
-    instr[BitFlag::Reset4RegC] = Instruction { "RES 4, C", 2, 2, 8, reset_bit<4, Reg8::C> };
-    instr[BitFlag::Reset4RegD] = Instruction { "RES 4, D", 2, 2, 8, reset_bit<4, Reg8::D> };
-    instr[BitFlag::Reset4RegE] = Instruction { "RES 4, E", 2, 2, 8, reset_bit<4, Reg8::E> };
-    instr[BitFlag::Reset4RegH] = Instruction { "RES 4, H", 2, 2, 8, reset_bit<4, Reg8::H> };
-    instr[BitFlag::Reset4RegL] = Instruction { "RES 4, L", 2, 2, 8, reset_bit<4, Reg8::L> };
-    instr[BitFlag::Reset4RegA] = Instruction { "RES 4, A", 2, 2, 8, reset_bit<4, Reg8::A> };
-    instr[BitFlag::Reset5RegB] = Instruction { "RES 5, B", 2, 2, 8, reset_bit<5, Reg8::B> };
-    instr[BitFlag::Reset5RegC] = Instruction { "RES 5, C", 2, 2, 8, reset_bit<5, Reg8::C> };
-    instr[BitFlag::Reset5RegD] = Instruction { "RES 5, D", 2, 2, 8, reset_bit<5, Reg8::D> };
-    instr[BitFlag::Reset5RegE] = Instruction { "RES 5, E", 2, 2, 8, reset_bit<5, Reg8::E> };
-    instr[BitFlag::Reset5RegH] = Instruction { "RES 5, H", 2, 2, 8, reset_bit<5, Reg8::H> };
-    instr[BitFlag::Reset5RegL] = Instruction { "RES 5, L", 2, 2, 8, reset_bit<5, Reg8::L> };
-    instr[BitFlag::Reset5RegA] = Instruction { "RES 5, A", 2, 2, 8, reset_bit<5, Reg8::A> };
-    instr[BitFlag::Reset6RegB] = Instruction { "RES 6, B", 2, 2, 8, reset_bit<6, Reg8::B> };
-    instr[BitFlag::Reset6RegC] = Instruction { "RES 6, C", 2, 2, 8, reset_bit<6, Reg8::C> };
-    instr[BitFlag::Reset6RegD] = Instruction { "RES 6, D", 2, 2, 8, reset_bit<6, Reg8::D> };
-    instr[BitFlag::Reset6RegE] = Instruction { "RES 6, E", 2, 2, 8, reset_bit<6, Reg8::E> };
-    instr[BitFlag::Reset6RegH] = Instruction { "RES 6, H", 2, 2, 8, reset_bit<6, Reg8::H> };
-    instr[BitFlag::Reset6RegL] = Instruction { "RES 6, L", 2, 2, 8, reset_bit<6, Reg8::L> };
-    instr[BitFlag::Reset6RegA] = Instruction { "RES 6, A", 2, 2, 8, reset_bit<6, Reg8::A> };
-    instr[BitFlag::Reset7RegB] = Instruction { "RES 7, B", 2, 2, 8, reset_bit<7, Reg8::B> };
-    instr[BitFlag::Reset7RegC] = Instruction { "RES 7, C", 2, 2, 8, reset_bit<7, Reg8::C> };
-    instr[BitFlag::Reset7RegD] = Instruction { "RES 7, D", 2, 2, 8, reset_bit<7, Reg8::D> };
-    instr[BitFlag::Reset7RegE] = Instruction { "RES 7, E", 2, 2, 8, reset_bit<7, Reg8::E> };
-    instr[BitFlag::Reset7RegH] = Instruction { "RES 7, H", 2, 2, 8, reset_bit<7, Reg8::H> };
-    instr[BitFlag::Reset7RegL] = Instruction { "RES 7, L", 2, 2, 8, reset_bit<7, Reg8::L> };
-    instr[BitFlag::Reset7RegA] = Instruction { "RES 7, A", 2, 2, 8, reset_bit<7, Reg8::A> };
+        = InstructionDef { "BIT 7, [HL]", 2, 3, test_bit<7, Reg8::IndirHL> };
+    instr[BitFlag::Reset0RegB] = InstructionDef { "RES 0, B", 2, 2, reset_bit<0, Reg8::B> };
+    instr[BitFlag::Reset0RegC] = InstructionDef { "RES 0, C", 2, 2, reset_bit<0, Reg8::C> };
+    instr[BitFlag::Reset0RegD] = InstructionDef { "RES 0, D", 2, 2, reset_bit<0, Reg8::D> };
+    instr[BitFlag::Reset0RegE] = InstructionDef { "RES 0, E", 2, 2, reset_bit<0, Reg8::E> };
+    instr[BitFlag::Reset0RegH] = InstructionDef { "RES 0, H", 2, 2, reset_bit<0, Reg8::H> };
+    instr[BitFlag::Reset0RegL] = InstructionDef { "RES 0, L", 2, 2, reset_bit<0, Reg8::L> };
+    instr[BitFlag::Reset0RegA] = InstructionDef { "RES 0, A", 2, 2, reset_bit<0, Reg8::A> };
+    instr[BitFlag::Reset1RegB] = InstructionDef { "RES 1, B", 2, 2, reset_bit<1, Reg8::B> };
+    instr[BitFlag::Reset1RegC] = InstructionDef { "RES 1, C", 2, 2, reset_bit<1, Reg8::C> };
+    instr[BitFlag::Reset1RegD] = InstructionDef { "RES 1, D", 2, 2, reset_bit<1, Reg8::D> };
+    instr[BitFlag::Reset1RegE] = InstructionDef { "RES 1, E", 2, 2, reset_bit<1, Reg8::E> };
+    instr[BitFlag::Reset1RegH] = InstructionDef { "RES 1, H", 2, 2, reset_bit<1, Reg8::H> };
+    instr[BitFlag::Reset1RegL] = InstructionDef { "RES 1, L", 2, 2, reset_bit<1, Reg8::L> };
+    instr[BitFlag::Reset1RegA] = InstructionDef { "RES 1, A", 2, 2, reset_bit<1, Reg8::A> };
+    instr[BitFlag::Reset2RegB] = InstructionDef { "RES 2, B", 2, 2, reset_bit<2, Reg8::B> };
+    instr[BitFlag::Reset2RegC] = InstructionDef { "RES 2, C", 2, 2, reset_bit<2, Reg8::C> };
+    instr[BitFlag::Reset2RegD] = InstructionDef { "RES 2, D", 2, 2, reset_bit<2, Reg8::D> };
+    instr[BitFlag::Reset2RegE] = InstructionDef { "RES 2, E", 2, 2, reset_bit<2, Reg8::E> };
+    instr[BitFlag::Reset2RegH] = InstructionDef { "RES 2, H", 2, 2, reset_bit<2, Reg8::H> };
+    instr[BitFlag::Reset2RegL] = InstructionDef { "RES 2, L", 2, 2, reset_bit<2, Reg8::L> };
+    instr[BitFlag::Reset2RegA] = InstructionDef { "RES 2, A", 2, 2, reset_bit<2, Reg8::A> };
+    instr[BitFlag::Reset3RegB] = InstructionDef { "RES 3, B", 2, 2, reset_bit<3, Reg8::B> };
+    instr[BitFlag::Reset3RegC] = InstructionDef { "RES 3, C", 2, 2, reset_bit<3, Reg8::C> };
+    instr[BitFlag::Reset3RegD] = InstructionDef { "RES 3, D", 2, 2, reset_bit<3, Reg8::D> };
+    instr[BitFlag::Reset3RegE] = InstructionDef { "RES 3, E", 2, 2, reset_bit<3, Reg8::E> };
+    instr[BitFlag::Reset3RegH] = InstructionDef { "RES 3, H", 2, 2, reset_bit<3, Reg8::H> };
+    instr[BitFlag::Reset3RegL] = InstructionDef { "RES 3, L", 2, 2, reset_bit<3, Reg8::L> };
+    instr[BitFlag::Reset3RegA] = InstructionDef { "RES 3, A", 2, 2, reset_bit<3, Reg8::A> };
+    instr[BitFlag::Reset4RegB] = InstructionDef { "RES 4, B", 2, 2, reset_bit<4, Reg8::B> };
+    instr[BitFlag::Reset4RegC] = InstructionDef { "RES 4, C", 2, 2, reset_bit<4, Reg8::C> };
+    instr[BitFlag::Reset4RegD] = InstructionDef { "RES 4, D", 2, 2, reset_bit<4, Reg8::D> };
+    instr[BitFlag::Reset4RegE] = InstructionDef { "RES 4, E", 2, 2, reset_bit<4, Reg8::E> };
+    instr[BitFlag::Reset4RegH] = InstructionDef { "RES 4, H", 2, 2, reset_bit<4, Reg8::H> };
+    instr[BitFlag::Reset4RegL] = InstructionDef { "RES 4, L", 2, 2, reset_bit<4, Reg8::L> };
+    instr[BitFlag::Reset4RegA] = InstructionDef { "RES 4, A", 2, 2, reset_bit<4, Reg8::A> };
+    instr[BitFlag::Reset5RegB] = InstructionDef { "RES 5, B", 2, 2, reset_bit<5, Reg8::B> };
+    instr[BitFlag::Reset5RegC] = InstructionDef { "RES 5, C", 2, 2, reset_bit<5, Reg8::C> };
+    instr[BitFlag::Reset5RegD] = InstructionDef { "RES 5, D", 2, 2, reset_bit<5, Reg8::D> };
+    instr[BitFlag::Reset5RegE] = InstructionDef { "RES 5, E", 2, 2, reset_bit<5, Reg8::E> };
+    instr[BitFlag::Reset5RegH] = InstructionDef { "RES 5, H", 2, 2, reset_bit<5, Reg8::H> };
+    instr[BitFlag::Reset5RegL] = InstructionDef { "RES 5, L", 2, 2, reset_bit<5, Reg8::L> };
+    instr[BitFlag::Reset5RegA] = InstructionDef { "RES 5, A", 2, 2, reset_bit<5, Reg8::A> };
+    instr[BitFlag::Reset6RegB] = InstructionDef { "RES 6, B", 2, 2, reset_bit<6, Reg8::B> };
+    instr[BitFlag::Reset6RegC] = InstructionDef { "RES 6, C", 2, 2, reset_bit<6, Reg8::C> };
+    instr[BitFlag::Reset6RegD] = InstructionDef { "RES 6, D", 2, 2, reset_bit<6, Reg8::D> };
+    instr[BitFlag::Reset6RegE] = InstructionDef { "RES 6, E", 2, 2, reset_bit<6, Reg8::E> };
+    instr[BitFlag::Reset6RegH] = InstructionDef { "RES 6, H", 2, 2, reset_bit<6, Reg8::H> };
+    instr[BitFlag::Reset6RegL] = InstructionDef { "RES 6, L", 2, 2, reset_bit<6, Reg8::L> };
+    instr[BitFlag::Reset6RegA] = InstructionDef { "RES 6, A", 2, 2, reset_bit<6, Reg8::A> };
+    instr[BitFlag::Reset7RegB] = InstructionDef { "RES 7, B", 2, 2, reset_bit<7, Reg8::B> };
+    instr[BitFlag::Reset7RegC] = InstructionDef { "RES 7, C", 2, 2, reset_bit<7, Reg8::C> };
+    instr[BitFlag::Reset7RegD] = InstructionDef { "RES 7, D", 2, 2, reset_bit<7, Reg8::D> };
+    instr[BitFlag::Reset7RegE] = InstructionDef { "RES 7, E", 2, 2, reset_bit<7, Reg8::E> };
+    instr[BitFlag::Reset7RegH] = InstructionDef { "RES 7, H", 2, 2, reset_bit<7, Reg8::H> };
+    instr[BitFlag::Reset7RegL] = InstructionDef { "RES 7, L", 2, 2, reset_bit<7, Reg8::L> };
+    instr[BitFlag::Reset7RegA] = InstructionDef { "RES 7, A", 2, 2, reset_bit<7, Reg8::A> };
     instr[BitFlag::Reset0IndirHL]
-        = Instruction { "RES 0, [HL]", 2, 4, 16, reset_bit<0, Reg8::IndirHL> };
+        = InstructionDef { "RES 0, [HL]", 2, 4, reset_bit<0, Reg8::IndirHL> };
     instr[BitFlag::Reset1IndirHL]
-        = Instruction { "RES 1, [HL]", 2, 4, 16, reset_bit<1, Reg8::IndirHL> };
+        = InstructionDef { "RES 1, [HL]", 2, 4, reset_bit<1, Reg8::IndirHL> };
     instr[BitFlag::Reset2IndirHL]
-        = Instruction { "RES 2, [HL]", 2, 4, 16, reset_bit<2, Reg8::IndirHL> };
+        = InstructionDef { "RES 2, [HL]", 2, 4, reset_bit<2, Reg8::IndirHL> };
     instr[BitFlag::Reset3IndirHL]
-        = Instruction { "RES 3, [HL]", 2, 4, 16, reset_bit<3, Reg8::IndirHL> };
+        = InstructionDef { "RES 3, [HL]", 2, 4, reset_bit<3, Reg8::IndirHL> };
     instr[BitFlag::Reset4IndirHL]
-        = Instruction { "RES 4, [HL]", 2, 4, 16, reset_bit<4, Reg8::IndirHL> };
+        = InstructionDef { "RES 4, [HL]", 2, 4, reset_bit<4, Reg8::IndirHL> };
     instr[BitFlag::Reset5IndirHL]
-        = Instruction { "RES 5, [HL]", 2, 4, 16, reset_bit<5, Reg8::IndirHL> };
+        = InstructionDef { "RES 5, [HL]", 2, 4, reset_bit<5, Reg8::IndirHL> };
     instr[BitFlag::Reset6IndirHL]
-        = Instruction { "RES 6, [HL]", 2, 4, 16, reset_bit<6, Reg8::IndirHL> };
+        = InstructionDef { "RES 6, [HL]", 2, 4, reset_bit<6, Reg8::IndirHL> };
     instr[BitFlag::Reset7IndirHL]
-        = Instruction { "RES 7, [HL]", 2, 4, 16, reset_bit<7, Reg8::IndirHL> };
-    instr[BitFlag::Set0RegB] = Instruction { "SET 0, B", 2, 2, 8, set_bit<0, Reg8::B> };
-    instr[BitFlag::Set0RegC] = Instruction { "SET 0, C", 2, 2, 8, set_bit<0, Reg8::C> };
-    instr[BitFlag::Set0RegD] = Instruction { "SET 0, D", 2, 2, 8, set_bit<0, Reg8::D> };
-    instr[BitFlag::Set0RegE] = Instruction { "SET 0, E", 2, 2, 8, set_bit<0, Reg8::E> };
-    instr[BitFlag::Set0RegH] = Instruction { "SET 0, H", 2, 2, 8, set_bit<0, Reg8::H> };
-    instr[BitFlag::Set0RegL] = Instruction { "SET 0, L", 2, 2, 8, set_bit<0, Reg8::L> };
-    instr[BitFlag::Set0RegA] = Instruction { "SET 0, A", 2, 2, 8, set_bit<0, Reg8::A> };
-    instr[BitFlag::Set1RegB] = Instruction { "SET 1, B", 2, 2, 8, set_bit<1, Reg8::B> };
-    instr[BitFlag::Set1RegC] = Instruction { "SET 1, C", 2, 2, 8, set_bit<1, Reg8::C> };
-    instr[BitFlag::Set1RegD] = Instruction { "SET 1, D", 2, 2, 8, set_bit<1, Reg8::D> };
-    instr[BitFlag::Set1RegE] = Instruction { "SET 1, E", 2, 2, 8, set_bit<1, Reg8::E> };
-    instr[BitFlag::Set1RegH] = Instruction { "SET 1, H", 2, 2, 8, set_bit<1, Reg8::H> };
-    instr[BitFlag::Set1RegL] = Instruction { "SET 1, L", 2, 2, 8, set_bit<1, Reg8::L> };
-    instr[BitFlag::Set1RegA] = Instruction { "SET 1, A", 2, 2, 8, set_bit<1, Reg8::A> };
-    instr[BitFlag::Set2RegB] = Instruction { "SET 2, B", 2, 2, 8, set_bit<2, Reg8::B> };
-    instr[BitFlag::Set2RegC] = Instruction { "SET 2, C", 2, 2, 8, set_bit<2, Reg8::C> };
-    instr[BitFlag::Set2RegD] = Instruction { "SET 2, D", 2, 2, 8, set_bit<2, Reg8::D> };
-    instr[BitFlag::Set2RegE] = Instruction { "SET 2, E", 2, 2, 8, set_bit<2, Reg8::E> };
-    instr[BitFlag::Set2RegH] = Instruction { "SET 2, H", 2, 2, 8, set_bit<2, Reg8::H> };
-    instr[BitFlag::Set2RegL] = Instruction { "SET 2, L", 2, 2, 8, set_bit<2, Reg8::L> };
-    instr[BitFlag::Set2RegA] = Instruction { "SET 2, A", 2, 2, 8, set_bit<2, Reg8::A> };
-    instr[BitFlag::Set3RegB] = Instruction { "SET 3, B", 2, 2, 8, set_bit<3, Reg8::B> };
-    instr[BitFlag::Set3RegC] = Instruction { "SET 3, C", 2, 2, 8, set_bit<3, Reg8::C> };
-    instr[BitFlag::Set3RegD] = Instruction { "SET 3, D", 2, 2, 8, set_bit<3, Reg8::D> };
-    instr[BitFlag::Set3RegE] = Instruction { "SET 3, E", 2, 2, 8, set_bit<3, Reg8::E> };
-    instr[BitFlag::Set3RegH] = Instruction { "SET 3, H", 2, 2, 8, set_bit<3, Reg8::H> };
-    instr[BitFlag::Set3RegL] = Instruction { "SET 3, L", 2, 2, 8, set_bit<3, Reg8::L> };
-    instr[BitFlag::Set3RegA] = Instruction { "SET 3, A", 2, 2, 8, set_bit<3, Reg8::A> };
-    instr[BitFlag::Set4RegB] = Instruction { "SET 4, B", 2, 2, 8, set_bit<4, Reg8::B> };
-    instr[BitFlag::Set4RegC] = Instruction { "SET 4, C", 2, 2, 8, set_bit<4, Reg8::C> };
-    instr[BitFlag::Set4RegD] = Instruction { "SET 4, D", 2, 2, 8, set_bit<4, Reg8::D> };
-    instr[BitFlag::Set4RegE] = Instruction { "SET 4, E", 2, 2, 8, set_bit<4, Reg8::E> };
-    instr[BitFlag::Set4RegH] = Instruction { "SET 4, H", 2, 2, 8, set_bit<4, Reg8::H> };
-    instr[BitFlag::Set4RegL] = Instruction { "SET 4, L", 2, 2, 8, set_bit<4, Reg8::L> };
-    instr[BitFlag::Set4RegA] = Instruction { "SET 4, A", 2, 2, 8, set_bit<4, Reg8::A> };
-    instr[BitFlag::Set5RegB] = Instruction { "SET 5, B", 2, 2, 8, set_bit<5, Reg8::B> };
-    instr[BitFlag::Set5RegC] = Instruction { "SET 5, C", 2, 2, 8, set_bit<5, Reg8::C> };
-    instr[BitFlag::Set5RegD] = Instruction { "SET 5, D", 2, 2, 8, set_bit<5, Reg8::D> };
-    instr[BitFlag::Set5RegE] = Instruction { "SET 5, E", 2, 2, 8, set_bit<5, Reg8::E> };
-    instr[BitFlag::Set5RegH] = Instruction { "SET 5, H", 2, 2, 8, set_bit<5, Reg8::H> };
-    instr[BitFlag::Set5RegL] = Instruction { "SET 5, L", 2, 2, 8, set_bit<5, Reg8::L> };
-    instr[BitFlag::Set5RegA] = Instruction { "SET 5, A", 2, 2, 8, set_bit<5, Reg8::A> };
-    instr[BitFlag::Set6RegB] = Instruction { "SET 6, B", 2, 2, 8, set_bit<6, Reg8::B> };
-    instr[BitFlag::Set6RegC] = Instruction { "SET 6, C", 2, 2, 8, set_bit<6, Reg8::C> };
-    instr[BitFlag::Set6RegD] = Instruction { "SET 6, D", 2, 2, 8, set_bit<6, Reg8::D> };
-    instr[BitFlag::Set6RegE] = Instruction { "SET 6, E", 2, 2, 8, set_bit<6, Reg8::E> };
-    instr[BitFlag::Set6RegH] = Instruction { "SET 6, H", 2, 2, 8, set_bit<6, Reg8::H> };
-    instr[BitFlag::Set6RegL] = Instruction { "SET 6, L", 2, 2, 8, set_bit<6, Reg8::L> };
-    instr[BitFlag::Set6RegA] = Instruction { "SET 6, A", 2, 2, 8, set_bit<6, Reg8::A> };
-    instr[BitFlag::Set7RegB] = Instruction { "SET 7, B", 2, 2, 8, set_bit<7, Reg8::B> };
-    instr[BitFlag::Set7RegC] = Instruction { "SET 7, C", 2, 2, 8, set_bit<7, Reg8::C> };
-    instr[BitFlag::Set7RegD] = Instruction { "SET 7, D", 2, 2, 8, set_bit<7, Reg8::D> };
-    instr[BitFlag::Set7RegE] = Instruction { "SET 7, E", 2, 2, 8, set_bit<7, Reg8::E> };
-    instr[BitFlag::Set7RegH] = Instruction { "SET 7, H", 2, 2, 8, set_bit<7, Reg8::H> };
-    instr[BitFlag::Set7RegL] = Instruction { "SET 7, L", 2, 2, 8, set_bit<7, Reg8::L> };
-    instr[BitFlag::Set7RegA] = Instruction { "SET 7, A", 2, 2, 8, set_bit<7, Reg8::A> };
+        = InstructionDef { "RES 7, [HL]", 2, 4, reset_bit<7, Reg8::IndirHL> };
+    instr[BitFlag::Set0RegB] = InstructionDef { "SET 0, B", 2, 2, set_bit<0, Reg8::B> };
+    instr[BitFlag::Set0RegC] = InstructionDef { "SET 0, C", 2, 2, set_bit<0, Reg8::C> };
+    instr[BitFlag::Set0RegD] = InstructionDef { "SET 0, D", 2, 2, set_bit<0, Reg8::D> };
+    instr[BitFlag::Set0RegE] = InstructionDef { "SET 0, E", 2, 2, set_bit<0, Reg8::E> };
+    instr[BitFlag::Set0RegH] = InstructionDef { "SET 0, H", 2, 2, set_bit<0, Reg8::H> };
+    instr[BitFlag::Set0RegL] = InstructionDef { "SET 0, L", 2, 2, set_bit<0, Reg8::L> };
+    instr[BitFlag::Set0RegA] = InstructionDef { "SET 0, A", 2, 2, set_bit<0, Reg8::A> };
+    instr[BitFlag::Set1RegB] = InstructionDef { "SET 1, B", 2, 2, set_bit<1, Reg8::B> };
+    instr[BitFlag::Set1RegC] = InstructionDef { "SET 1, C", 2, 2, set_bit<1, Reg8::C> };
+    instr[BitFlag::Set1RegD] = InstructionDef { "SET 1, D", 2, 2, set_bit<1, Reg8::D> };
+    instr[BitFlag::Set1RegE] = InstructionDef { "SET 1, E", 2, 2, set_bit<1, Reg8::E> };
+    instr[BitFlag::Set1RegH] = InstructionDef { "SET 1, H", 2, 2, set_bit<1, Reg8::H> };
+    instr[BitFlag::Set1RegL] = InstructionDef { "SET 1, L", 2, 2, set_bit<1, Reg8::L> };
+    instr[BitFlag::Set1RegA] = InstructionDef { "SET 1, A", 2, 2, set_bit<1, Reg8::A> };
+    instr[BitFlag::Set2RegB] = InstructionDef { "SET 2, B", 2, 2, set_bit<2, Reg8::B> };
+    instr[BitFlag::Set2RegC] = InstructionDef { "SET 2, C", 2, 2, set_bit<2, Reg8::C> };
+    instr[BitFlag::Set2RegD] = InstructionDef { "SET 2, D", 2, 2, set_bit<2, Reg8::D> };
+    instr[BitFlag::Set2RegE] = InstructionDef { "SET 2, E", 2, 2, set_bit<2, Reg8::E> };
+    instr[BitFlag::Set2RegH] = InstructionDef { "SET 2, H", 2, 2, set_bit<2, Reg8::H> };
+    instr[BitFlag::Set2RegL] = InstructionDef { "SET 2, L", 2, 2, set_bit<2, Reg8::L> };
+    instr[BitFlag::Set2RegA] = InstructionDef { "SET 2, A", 2, 2, set_bit<2, Reg8::A> };
+    instr[BitFlag::Set3RegB] = InstructionDef { "SET 3, B", 2, 2, set_bit<3, Reg8::B> };
+    instr[BitFlag::Set3RegC] = InstructionDef { "SET 3, C", 2, 2, set_bit<3, Reg8::C> };
+    instr[BitFlag::Set3RegD] = InstructionDef { "SET 3, D", 2, 2, set_bit<3, Reg8::D> };
+    instr[BitFlag::Set3RegE] = InstructionDef { "SET 3, E", 2, 2, set_bit<3, Reg8::E> };
+    instr[BitFlag::Set3RegH] = InstructionDef { "SET 3, H", 2, 2, set_bit<3, Reg8::H> };
+    instr[BitFlag::Set3RegL] = InstructionDef { "SET 3, L", 2, 2, set_bit<3, Reg8::L> };
+    instr[BitFlag::Set3RegA] = InstructionDef { "SET 3, A", 2, 2, set_bit<3, Reg8::A> };
+    instr[BitFlag::Set4RegB] = InstructionDef { "SET 4, B", 2, 2, set_bit<4, Reg8::B> };
+    instr[BitFlag::Set4RegC] = InstructionDef { "SET 4, C", 2, 2, set_bit<4, Reg8::C> };
+    instr[BitFlag::Set4RegD] = InstructionDef { "SET 4, D", 2, 2, set_bit<4, Reg8::D> };
+    instr[BitFlag::Set4RegE] = InstructionDef { "SET 4, E", 2, 2, set_bit<4, Reg8::E> };
+    instr[BitFlag::Set4RegH] = InstructionDef { "SET 4, H", 2, 2, set_bit<4, Reg8::H> };
+    instr[BitFlag::Set4RegL] = InstructionDef { "SET 4, L", 2, 2, set_bit<4, Reg8::L> };
+    instr[BitFlag::Set4RegA] = InstructionDef { "SET 4, A", 2, 2, set_bit<4, Reg8::A> };
+    instr[BitFlag::Set5RegB] = InstructionDef { "SET 5, B", 2, 2, set_bit<5, Reg8::B> };
+    instr[BitFlag::Set5RegC] = InstructionDef { "SET 5, C", 2, 2, set_bit<5, Reg8::C> };
+    instr[BitFlag::Set5RegD] = InstructionDef { "SET 5, D", 2, 2, set_bit<5, Reg8::D> };
+    instr[BitFlag::Set5RegE] = InstructionDef { "SET 5, E", 2, 2, set_bit<5, Reg8::E> };
+    instr[BitFlag::Set5RegH] = InstructionDef { "SET 5, H", 2, 2, set_bit<5, Reg8::H> };
+    instr[BitFlag::Set5RegL] = InstructionDef { "SET 5, L", 2, 2, set_bit<5, Reg8::L> };
+    instr[BitFlag::Set5RegA] = InstructionDef { "SET 5, A", 2, 2, set_bit<5, Reg8::A> };
+    instr[BitFlag::Set6RegB] = InstructionDef { "SET 6, B", 2, 2, set_bit<6, Reg8::B> };
+    instr[BitFlag::Set6RegC] = InstructionDef { "SET 6, C", 2, 2, set_bit<6, Reg8::C> };
+    instr[BitFlag::Set6RegD] = InstructionDef { "SET 6, D", 2, 2, set_bit<6, Reg8::D> };
+    instr[BitFlag::Set6RegE] = InstructionDef { "SET 6, E", 2, 2, set_bit<6, Reg8::E> };
+    instr[BitFlag::Set6RegH] = InstructionDef { "SET 6, H", 2, 2, set_bit<6, Reg8::H> };
+    instr[BitFlag::Set6RegL] = InstructionDef { "SET 6, L", 2, 2, set_bit<6, Reg8::L> };
+    instr[BitFlag::Set6RegA] = InstructionDef { "SET 6, A", 2, 2, set_bit<6, Reg8::A> };
+    instr[BitFlag::Set7RegB] = InstructionDef { "SET 7, B", 2, 2, set_bit<7, Reg8::B> };
+    instr[BitFlag::Set7RegC] = InstructionDef { "SET 7, C", 2, 2, set_bit<7, Reg8::C> };
+    instr[BitFlag::Set7RegD] = InstructionDef { "SET 7, D", 2, 2, set_bit<7, Reg8::D> };
+    instr[BitFlag::Set7RegE] = InstructionDef { "SET 7, E", 2, 2, set_bit<7, Reg8::E> };
+    instr[BitFlag::Set7RegH] = InstructionDef { "SET 7, H", 2, 2, set_bit<7, Reg8::H> };
+    instr[BitFlag::Set7RegL] = InstructionDef { "SET 7, L", 2, 2, set_bit<7, Reg8::L> };
+    instr[BitFlag::Set7RegA] = InstructionDef { "SET 7, A", 2, 2, set_bit<7, Reg8::A> };
     instr[BitFlag::Set0IndirHL]
-        = Instruction { "SET 0, [HL]", 2, 4, 16, set_bit<0, Reg8::IndirHL> };
+        = InstructionDef { "SET 0, [HL]", 2, 4, set_bit<0, Reg8::IndirHL> };
     instr[BitFlag::Set1IndirHL]
-        = Instruction { "SET 1, [HL]", 2, 4, 16, set_bit<1, Reg8::IndirHL> };
+        = InstructionDef { "SET 1, [HL]", 2, 4, set_bit<1, Reg8::IndirHL> };
     instr[BitFlag::Set2IndirHL]
-        = Instruction { "SET 2, [HL]", 2, 4, 16, set_bit<2, Reg8::IndirHL> };
+        = InstructionDef { "SET 2, [HL]", 2, 4, set_bit<2, Reg8::IndirHL> };
     instr[BitFlag::Set3IndirHL]
-        = Instruction { "SET 3, [HL]", 2, 4, 16, set_bit<3, Reg8::IndirHL> };
+        = InstructionDef { "SET 3, [HL]", 2, 4, set_bit<3, Reg8::IndirHL> };
     instr[BitFlag::Set4IndirHL]
-        = Instruction { "SET 4, [HL]", 2, 4, 16, set_bit<4, Reg8::IndirHL> };
+        = InstructionDef { "SET 4, [HL]", 2, 4, set_bit<4, Reg8::IndirHL> };
     instr[BitFlag::Set5IndirHL]
-        = Instruction { "SET 5, [HL]", 2, 4, 16, set_bit<5, Reg8::IndirHL> };
+        = InstructionDef { "SET 5, [HL]", 2, 4, set_bit<5, Reg8::IndirHL> };
     instr[BitFlag::Set6IndirHL]
-        = Instruction { "SET 6, [HL]", 2, 4, 16, set_bit<6, Reg8::IndirHL> };
+        = InstructionDef { "SET 6, [HL]", 2, 4, set_bit<6, Reg8::IndirHL> };
     instr[BitFlag::Set7IndirHL]
-        = Instruction { "SET 7, [HL]", 2, 4, 16, set_bit<7, Reg8::IndirHL> };
+        = InstructionDef { "SET 7, [HL]", 2, 4, set_bit<7, Reg8::IndirHL> };
     return instr;
 }
 
+template <size_t N>
+constexpr std::array<Instruction, N>
+new_hot_table(const std::array<InstructionDef, N>& defs)
+{
+    std::array<Instruction, N> table = {};
+    for (size_t i = 0; i < N; ++i)
+        table[i] = Instruction { defs[i].execute, defs[i].mcycles };
+    return table;
+}
+
+template <size_t N>
+constexpr std::array<InstructionInfo, N>
+new_cold_table(const std::array<InstructionDef, N>& defs)
+{
+    std::array<InstructionInfo, N> table = {};
+    for (size_t i = 0; i < N; ++i)
+        table[i] = InstructionInfo { defs[i].mnemonic, defs[i].length };
+    return table;
+}
+
+// NOTE: Evaluated at compile time, so threaded dispatch can resolve every handler statically, and
+// every CPU instance shares one read-only copy of each table.
+static constexpr std::array<Instruction, NO_PREFIX_INSTR_TABLE_SIZE> NO_PREFIX_INSTR
+    = new_hot_table(new_no_prefix_instr());
+static constexpr std::array<Instruction, CB_PREFIX_INSTR_TABLE_SIZE> CB_PREFIX_INSTR
+    = new_hot_table(new_cb_prefix_instr());
+static constexpr std::array<InstructionInfo, NO_PREFIX_INSTR_TABLE_SIZE> NO_PREFIX_INFO
+    = new_cold_table(new_no_prefix_instr());
+static constexpr std::array<InstructionInfo, CB_PREFIX_INSTR_TABLE_SIZE> CB_PREFIX_INFO
+    = new_cold_table(new_cb_prefix_instr());
+
+// INVARIANT: Both dispatch tables together must fit in 8 KiB, i.e., a quarter of a typical L1d.
+static_assert(sizeof(NO_PREFIX_INSTR) + sizeof(CB_PREFIX_INSTR) <= 8192);
+
+/// @brief Execute one entry of an instruction table known at compile time.
+///
+/// Handler pointer is a constant expression here, so compiler calls it directly and can inline
+/// it, instead of making an indirect call.
+///
+/// @return False if opcode is illegal, true otherwise.
+template <const std::array<Instruction, 256>& Table, uint8_t Opcode>
+static inline bool
+execute_inline(Sm83State& cpu)
+{
+    constexpr Instruction instr = Table[Opcode];
+    if constexpr (instr.execute == nullptr) {
+        return false;
+    } else {
+        instr.execute(cpu);
+        cpu.mcycles += instr.mcycles;
+        cpu.tstates += instr.mcycles * TSTATES_PER_MCYCLE;
+        return true;
+    }
+}
+
+// NOTE: Labels as values are a GNU extension that both GCC and Clang support. Other compilers,
+// i.e., MSVC, fall back to a switch over every opcode.
+#if defined(__GNUC__)
+#define COCOA_HAS_COMPUTED_GOTO
+#endif
+
+// NOTE: Expand given macro once per opcode, e.g., `COCOA_EXPAND_ROW(M, T, L, 0x4)` covers 0x40
+// to 0x4F.
+#define COCOA_EXPAND_ROW(MACRO, TABLE, LABEL, ROW)                                                 \
+    MACRO(TABLE, LABEL, ROW##0) MACRO(TABLE, LABEL, ROW##1) MACRO(TABLE, LABEL, ROW##2)            \
+    MACRO(TABLE, LABEL, ROW##3) MACRO(TABLE, LABEL, ROW##4) MACRO(TABLE, LABEL, ROW##5)            \
+    MACRO(TABLE, LABEL, ROW##6) MACRO(TABLE, LABEL, ROW##7) MACRO(TABLE, LABEL, ROW##8)            \
+    MACRO(TABLE, LABEL, ROW##9) MACRO(TABLE, LABEL, ROW##A) MACRO(TABLE, LABEL, ROW##B)            \
+    MACRO(TABLE, LABEL, ROW##C) MACRO(TABLE, LABEL, ROW##D) MACRO(TABLE, LABEL, ROW##E)            \
+    MACRO(TABLE, LABEL, ROW##F)
+#define COCOA_EXPAND(MACRO, TABLE, LABEL)                                                          \
+    COCOA_EXPAND_ROW(MACRO, TABLE, LABEL, 0x0) COCOA_EXPAND_ROW(MACRO, TABLE, LABEL, 0x1)          \
+    COCOA_EXPAND_ROW(MACRO, TABLE, LABEL, 0x2) COCOA_EXPAND_ROW(MACRO, TABLE, LABEL, 0x3)          \
+    COCOA_EXPAND_ROW(MACRO, TABLE, LABEL, 0x4) COCOA_EXPAND_ROW(MACRO, TABLE, LABEL, 0x5)          \
+    COCOA_EXPAND_ROW(MACRO, TABLE, LABEL, 0x6) COCOA_EXPAND_ROW(MACRO, TABLE, LABEL, 0x7)          \
+    COCOA_EXPAND_ROW(MACRO, TABLE, LABEL, 0x8) COCOA_EXPAND_ROW(MACRO, TABLE, LABEL, 0x9)          \
+    COCOA_EXPAND_ROW(MACRO, TABLE, LABEL, 0xA) COCOA_EXPAND_ROW(MACRO, TABLE, LABEL, 0xB)          \
+    COCOA_EXPAND_ROW(MACRO, TABLE, LABEL, 0xC) COCOA_EXPAND_ROW(MACRO, TABLE, LABEL, 0xD)          \
+    COCOA_EXPAND_ROW(MACRO, TABLE, LABEL, 0xE) COCOA_EXPAND_ROW(MACRO, TABLE, LABEL, 0xF)
+
+#ifndef COCOA_HAS_COMPUTED_GOTO
+#define COCOA_CASE(TABLE, LABEL, OPCODE)                                                           \
+    case OPCODE:                                                                                   \
+        return execute_inline<TABLE, OPCODE>(cpu);
+
+static bool
+switch_no_prefix(Sm83State& cpu, const uint8_t opcode)
+{
+    switch (opcode) {
+        COCOA_EXPAND(COCOA_CASE, NO_PREFIX_INSTR, )
+    }
+    return false;
+}
+
+static bool
+switch_cb_prefix(Sm83State& cpu, const uint8_t opcode)
+{
+    switch (opcode) {
+        COCOA_EXPAND(COCOA_CASE, CB_PREFIX_INSTR, )
+    }
+    return false;
+}
+
+#undef COCOA_CASE
+#endif // COCOA_HAS_COMPUTED_GOTO
+
+const InstructionInfo&
+instruction_info(const uint8_t opcode, const bool prefixed)
+{
+    return prefixed ? CB_PREFIX_INFO[opcode] : NO_PREFIX_INFO[opcode];
+}
+
 Sm83State::Sm83State(MemoryBus& memory)
     : regs { 0x01, 0x80, 0x00, 0x13, 0x00, 0xD8, 0x01, 0x4D }
     , mcycles(0)
@@ -1879,87 +1982,98 @@ Sm83State::Sm83State(MemoryBus& memory)
     , sp(0xFFFE)
     , pc(0x0100)
     , ime(true)
+    , interrupts(memory)
+    , flag_op(FlagOp::None)
+    , flag_result(0)
+    , flag_operand1(0)
+    , flag_operand2(0)
+    , flag_carry(false)
 {
 }
 
 Sm83::Sm83(std::shared_ptr<spdlog::logger> log, MemoryBus& memory)
-    : m_no_prefix_instr { new_no_prefix_instr() }
-    , m_cb_prefix_instr { new_cb_prefix_instr() }
-    , m_state(memory)
+    : m_state(memory)
     , m_log(log)
+    , m_dispatch(Sm83Dispatch::Table)
+    , m_block_cache()
+    , m_block_memory {}
+    , m_block_pages {}
+    , m_breakpoints(nullptr)
+#ifdef COCOA_JIT
+    , m_jit(m_state)
+#endif // COCOA_JIT
+#ifdef COCOA_TRACE
+    , m_trace(std::make_unique<TraceBuffer>())
+    , m_trace_dropped(0)
+#endif // COCOA_TRACE
 {
 }
 
 static void
 handle_interrupts(Sm83State& cpu)
 {
-    if (cpu.ime) {
-        cpu.ime = false;
-        cpu.bus.write_byte(--cpu.sp, cocoa::from_low(cpu.pc));
-        cpu.bus.write_byte(--cpu.sp, cocoa::from_high(cpu.pc));
+    // INVARIANT: HALT mode is exited once any interrupt is pending, even if IME is not set.
+    if (cpu.interrupts.pending() == 0)
+        return;
 
-        if (is_interrupt_pending<Interrupt::VBlank>(cpu.bus)) {
-            cpu.pc = cocoa::from_enum(InterruptVector::VBlank);
-            clear_interrupt<Interrupt::VBlank>(cpu.bus);
-        } else if (is_interrupt_pending<Interrupt::Lcd>(cpu.bus)) {
-            cpu.pc = cocoa::from_enum(InterruptVector::Lcd);
-            clear_interrupt<Interrupt::Lcd>(cpu.bus);
-        } else if (is_interrupt_pending<Interrupt::Timer>(cpu.bus)) {
-            cpu.pc = cocoa::from_enum(InterruptVector::Timer);
-            clear_interrupt<Interrupt::Timer>(cpu.bus);
-        } else if (is_interrupt_pending<Interrupt::Serial>(cpu.bus)) {
-            cpu.pc = cocoa::from_enum(InterruptVector::Serial);
-            clear_interrupt<Interrupt::Serial>(cpu.bus);
-        } else if (is_interrupt_pending<Interrupt::Joypad>(cpu.bus)) {
-            cpu.pc = cocoa::from_enum(InterruptVector::Joypad);
-            clear_interrupt<Interrupt::Joypad>(cpu.bus);
-        }
+    if (cpu.mode == Sm83Mode::Halted)
+        cpu.mode = Sm83Mode::Running;
 
-        if (cpu.mode == Sm83Mode::Halted)
-            cpu.mode = Sm83Mode::Running;
+    if (!cpu.ime)
+        return;
 
-        cpu.mcycles += 5;
-        cpu.tstates += 20;
-    } else {
-        if (cpu.mode == Sm83Mode::Halted)
-            cpu.mode = Sm83Mode::Running;
-    }
+    cpu.ime = false;
+    cpu.bus.write_byte(--cpu.sp, cocoa::from_low(cpu.pc));
+    cpu.bus.write_byte(--cpu.sp, cocoa::from_high(cpu.pc));
+
+    // NOTE: Pushing PC onto IE can leave nothing pending, so pending interrupts are checked again.
+    if (cpu.interrupts.pending() != 0)
+        cpu.pc = cocoa::from_enum(cpu.interrupts.acknowledge());
+
+    cpu.mcycles += 5;
+    cpu.tstates += 20;
 }
 
 void
 Sm83::step()
 {
-    handle_interrupts(m_state);
-    if (m_state.mode == Sm83Mode::Running) {
-        uint8_t opcode = m_state.bus.read_byte(m_state.pc++);
-        Instruction instr = {};
-
-        if (opcode == Misc::Prefix) {
-            opcode = m_state.bus.read_byte(m_state.pc++);
-            instr = m_cb_prefix_instr[opcode];
-            if (!instr.execute) {
-                throw IllegalOpcode(
-                    fmt::format("Illegal opcode {0} (0xCB 0x{1:02X})", instr.mnemonic, opcode));
-            }
-        } else {
-            instr = m_no_prefix_instr[opcode];
-            if (!instr.execute) {
-                throw IllegalOpcode(
-                    fmt::format("Illegal opcode {0} (0x{1:02X})", instr.mnemonic, opcode));
-            }
-        }
+    service_interrupts();
+    if (m_state.mode == Sm83Mode::Running)
+        execute();
+    else
+        idle(4);
+    m_state.materialize_flags();
+}
 
-        m_log->debug("Execute {0} ({1} bytes)", instr.mnemonic, instr.length);
-        instr.execute(m_state);
-        m_state.mcycles += instr.mcycles;
-        m_state.tstates += instr.tstates;
-    } else if (m_state.mode == Sm83Mode::Halted) {
-        m_state.mcycles += 1;
-        m_state.tstates += 4;
-    } else if (m_state.mode == Sm83Mode::Stopped) {
-        m_state.mcycles += 1;
-        m_state.tstates += 4;
+size_t
+Sm83::run_for(const size_t tstates)
+{
+    const size_t start = m_state.tstates;
+    service_interrupts();
+    if (m_state.mode != Sm83Mode::Running) {
+        idle(tstates);
+        return m_state.tstates - start;
+    }
+
+    const size_t target = start + tstates;
+    if (m_dispatch == Sm83Dispatch::Threaded) {
+        run_threaded(target);
+    } else if (m_dispatch == Sm83Dispatch::Block) {
+        run_blocks(target, [](const Sm83State&) { return false; }, false);
+#ifdef COCOA_JIT
+    } else if (m_dispatch == Sm83Dispatch::Jit) {
+        run_blocks(target, [](const Sm83State&) { return false; }, true);
+#endif // COCOA_JIT
+    } else {
+        while (m_state.tstates < target) {
+            execute_table();
+            if (is_slice_over())
+                break;
+        }
     }
+
+    m_state.materialize_flags();
+    return m_state.tstates - start;
 }
 
 size_t
@@ -1974,6 +2088,486 @@ Sm83::tstates() const
     return m_state.tstates;
 }
 
+void
+Sm83::stall(const size_t tstates)
+{
+    idle(tstates);
+}
+
+void
+Sm83::resume()
+{
+    m_state.mode = Sm83Mode::Running;
+}
+
+const Sm83State&
+Sm83::state() const
+{
+    return m_state;
+}
+
+void
+Sm83::set_dispatch(const Sm83Dispatch dispatch)
+{
+    m_dispatch = dispatch;
+}
+
+Sm83Dispatch
+Sm83::dispatch() const
+{
+    return m_dispatch;
+}
+
+#ifdef COCOA_JIT
+size_t
+Sm83::jit_code_size() const
+{
+    return m_jit.used();
+}
+#endif // COCOA_JIT
+
+void
+Sm83::set_breakpoints(const std::bitset<MEMORY_BUS_SIZE>* breakpoints)
+{
+    m_breakpoints = breakpoints;
+    flush_blocks();
+}
+
+void
+Sm83::flush_blocks()
+{
+    m_block_cache.clear();
+    m_block_memory.fill(nullptr);
+    m_block_pages.fill(nullptr);
+#ifdef COCOA_JIT
+    m_jit.clear();
+#endif // COCOA_JIT
+}
+
+void
+Sm83::save_state(Sm83Snapshot& out) const
+{
+    out = {};
+    out.mcycles = m_state.mcycles;
+    out.tstates = m_state.tstates;
+    out.regs = m_state.regs;
+    out.regs[Sm83State::F] = m_state.load_flags();
+    out.sp = m_state.sp;
+    out.pc = m_state.pc;
+    out.mode = static_cast<uint8_t>(m_state.mode);
+    out.ime = m_state.ime ? 1 : 0;
+}
+
+void
+Sm83::load_state(const Sm83Snapshot& snapshot)
+{
+    m_state.mcycles = snapshot.mcycles;
+    m_state.tstates = snapshot.tstates;
+    m_state.regs = snapshot.regs;
+    m_state.flag_op = FlagOp::None;
+    m_state.sp = snapshot.sp;
+    m_state.pc = snapshot.pc;
+    m_state.mode = static_cast<Sm83Mode>(snapshot.mode);
+    m_state.ime = snapshot.ime != 0;
+    m_state.interrupts.refresh();
+}
+
+void
+Sm83::execute()
+{
+    if (m_dispatch == Sm83Dispatch::Threaded)
+        run_threaded(m_state.tstates + 1);
+    else
+        execute_table();
+}
+
+void
+Sm83::execute_table()
+{
+#ifdef COCOA_TRACE
+    const uint16_t pc = m_state.pc;
+#endif // COCOA_TRACE
+
+    uint8_t opcode = m_state.bus.read_byte(m_state.pc++);
+    const bool prefixed = opcode == Misc::Prefix;
+    if (prefixed)
+        opcode = m_state.bus.read_byte(m_state.pc++);
+
+    const Instruction& instr = prefixed ? CB_PREFIX_INSTR[opcode] : NO_PREFIX_INSTR[opcode];
+    if (!instr.execute)
+        throw_illegal_opcode(opcode, prefixed);
+
+#ifdef COCOA_TRACE
+    m_state.materialize_flags();
+    const TraceEntry entry = { m_state.regs, m_state.tstates, m_state.sp, pc, opcode, prefixed };
+    if (!m_trace->push(entry))
+        m_trace_dropped.fetch_add(1, std::memory_order_relaxed);
+#endif // COCOA_TRACE
+
+    instr.execute(m_state);
+    m_state.mcycles += instr.mcycles;
+    m_state.tstates += instr.mcycles * TSTATES_PER_MCYCLE;
+}
+
+/// @brief Check if instruction may access memory past its own bytes, or change IME or CPU mode.
+static constexpr bool
+has_effects(const uint8_t opcode, const bool prefixed)
+{
+    if (prefixed)
+        return (opcode & 0x07) == 0x06;
+
+    // NOTE: Covers every [HL] operand of loads and ALU operations, plus HALT at 0x76.
+    if (opcode >= 0x40 && opcode < 0xC0)
+        return (opcode & 0x07) == 0x06 || (opcode & 0xF8) == 0x70;
+
+    switch (opcode) {
+    case Load::IndirBCRegA:
+    case Load::IndirDERegA:
+    case Load::IndirHLIRegA:
+    case Load::IndirHLDRegA:
+    case Load::RegAIndirBC:
+    case Load::RegAIndirDE:
+    case Load::RegAIndirHLI:
+    case Load::RegAIndirHLD:
+    case Load::IndirHLImm8:
+    case Load::HramImm8RegA:
+    case Load::HramRegAImm8:
+    case Load::HramIndirCRegA:
+    case Load::HramRegAIndirC:
+    case Load::IndirImm16RegA:
+    case Load::RegAIndirImm16:
+    case Stack::IndirImm16RegSP:
+    case Stack::PopRegBC:
+    case Stack::PopRegDE:
+    case Stack::PopRegHL:
+    case Stack::PopRegAF:
+    case Stack::PushRegBC:
+    case Stack::PushRegDE:
+    case Stack::PushRegHL:
+    case Stack::PushRegAF:
+    case Math::IncIndirHL:
+    case Math::DecIndirHL:
+    case CtrlFlow::CallImm16:
+    case CtrlFlow::CallNZImm16:
+    case CtrlFlow::CallNCImm16:
+    case CtrlFlow::CallZImm16:
+    case CtrlFlow::CallCImm16:
+    case CtrlFlow::Return:
+    case CtrlFlow::ReturnNZ:
+    case CtrlFlow::ReturnNC:
+    case CtrlFlow::ReturnZ:
+    case CtrlFlow::ReturnC:
+    case CtrlFlow::ReturnIR:
+    case CtrlFlow::Restart00:
+    case CtrlFlow::Restart10:
+    case CtrlFlow::Restart20:
+    case CtrlFlow::Restart30:
+    case CtrlFlow::Restart08:
+    case CtrlFlow::Restart18:
+    case CtrlFlow::Restart28:
+    case CtrlFlow::Restart38:
+    case Misc::Stop:
+    case Misc::DisableIR:
+    case Misc::EnableIR:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/// @brief Check if instruction can move PC anywhere but to the instruction after it.
+static constexpr bool
+ends_block(const uint8_t opcode)
+{
+    switch (opcode) {
+    case CtrlFlow::JumpImm16:
+    case CtrlFlow::JumpRegHL:
+    case CtrlFlow::JumpNZImm16:
+    case CtrlFlow::JumpNCImm16:
+    case CtrlFlow::JumpZImm16:
+    case CtrlFlow::JumpCImm16:
+    case CtrlFlow::JumpRelImm8:
+    case CtrlFlow::JumpNZRelImm8:
+    case CtrlFlow::JumpNCRelImm8:
+    case CtrlFlow::JumpZRelImm8:
+    case CtrlFlow::JumpCRelImm8:
+    case CtrlFlow::CallImm16:
+    case CtrlFlow::CallNZImm16:
+    case CtrlFlow::CallNCImm16:
+    case CtrlFlow::CallZImm16:
+    case CtrlFlow::CallCImm16:
+    case CtrlFlow::Return:
+    case CtrlFlow::ReturnNZ:
+    case CtrlFlow::ReturnNC:
+    case CtrlFlow::ReturnZ:
+    case CtrlFlow::ReturnC:
+    case CtrlFlow::ReturnIR:
+    case CtrlFlow::Restart00:
+    case CtrlFlow::Restart10:
+    case CtrlFlow::Restart20:
+    case CtrlFlow::Restart30:
+    case CtrlFlow::Restart08:
+    case CtrlFlow::Restart18:
+    case CtrlFlow::Restart28:
+    case CtrlFlow::Restart38:
+        return true;
+    default:
+        return false;
+    }
+}
+
+Sm83::Block*
+Sm83::find_block(const uint16_t pc)
+{
+    const uint8_t page = cocoa::from_high(pc);
+    const uint8_t* memory = m_state.bus.read_only_page(page);
+    if (memory == nullptr)
+        return nullptr;
+
+    if (m_block_memory[page] != memory) {
+        std::unique_ptr<BlockPage>& decoded = m_block_cache[memory];
+        if (!decoded)
+            decoded = std::make_unique<BlockPage>();
+        m_block_memory[page] = memory;
+        m_block_pages[page] = decoded.get();
+    }
+
+    Block& block = m_block_pages[page]->blocks[cocoa::from_low(pc)];
+    if (!block.decoded)
+        decode_block(memory, pc, block);
+    return block.ops.empty() ? nullptr : &block;
+}
+
+void
+Sm83::decode_block(const uint8_t* memory, const uint16_t pc, Block& block) const
+{
+    block.decoded = true;
+    const size_t base = size_t(pc) & ~(MEMORY_PAGE_SIZE - 1);
+    for (size_t at = cocoa::from_low(pc); at < MEMORY_PAGE_SIZE;) {
+        // NOTE: Blocks end in front of breakpoints, so those are only checked at block entry.
+        if (m_breakpoints != nullptr && !block.ops.empty() && (*m_breakpoints)[base + at])
+            break;
+
+        uint8_t opcode = memory[at];
+        const bool prefixed = opcode == Misc::Prefix;
+        if (prefixed && at + 1 < MEMORY_PAGE_SIZE)
+            opcode = memory[at + 1];
+
+        // NOTE: Illegal opcodes, and instructions spilling into next page, which may be mapped
+        // anywhere, are left to instruction table.
+        const Instruction& instr = prefixed ? CB_PREFIX_INSTR[opcode] : NO_PREFIX_INSTR[opcode];
+        const size_t length = instruction_info(opcode, prefixed).length;
+        if (!instr.execute || at + length > MEMORY_PAGE_SIZE)
+            break;
+
+        const uint8_t fetch = prefixed ? 2 : 1;
+        const bool effects = has_effects(opcode, prefixed);
+        const uint8_t start = static_cast<uint8_t>(at);
+        block.ops.push_back(
+            { instr.execute, instr.mcycles, fetch, opcode, start, prefixed, effects });
+        block.mcycles += instr.mcycles;
+        at += length;
+        if (!prefixed && ends_block(opcode))
+            break;
+    }
+}
+
+#ifdef COCOA_JIT
+JitCode
+Sm83::native_block(Block& block, const uint8_t* memory)
+{
+#ifdef COCOA_TRACE
+    // NOTE: Native code records no trace entries, so tracing builds keep interpreting.
+    static_cast<void>(block);
+    static_cast<void>(memory);
+    return nullptr;
+#else
+    if (block.native != nullptr || ++block.runs < JIT_HOT_RUNS)
+        return block.native;
+
+    std::vector<JitOp> ops;
+    ops.reserve(block.ops.size());
+    for (const BlockOp& op : block.ops) {
+        ops.push_back(
+            { op.execute, memory + op.offset, op.mcycles, op.fetch, op.prefixed, op.effects });
+    }
+
+    block.native = m_jit.compile(ops);
+    if (block.native == nullptr) {
+        // NOTE: Arena is full, so start over, and let blocks that are still hot earn it back.
+        for (auto& [key, page] : m_block_cache) {
+            for (Block& other : page->blocks) {
+                other.runs = 0;
+                other.native = nullptr;
+            }
+        }
+        m_jit.clear();
+        block.native = m_jit.compile(ops);
+    }
+    return block.native;
+#endif // COCOA_TRACE
+}
+#endif // COCOA_JIT
+
+#ifdef COCOA_TRACE
+#define COCOA_TRACE_FETCH                                                                          \
+    m_state.materialize_flags();                                                                   \
+    entry = { m_state.regs, m_state.tstates, m_state.sp, m_state.pc, 0, false }
+#define COCOA_TRACE_DECODE                                                                         \
+    entry.opcode = opcode;                                                                         \
+    entry.prefixed = prefixed;                                                                     \
+    if (!m_trace->push(entry))                                                                     \
+        m_trace_dropped.fetch_add(1, std::memory_order_relaxed)
+#else
+#define COCOA_TRACE_FETCH
+#define COCOA_TRACE_DECODE
+#endif // COCOA_TRACE
+
+// NOTE: Trace entries are pushed once opcode is decoded, but before it executes.
+#define COCOA_FETCH                                                                                \
+    COCOA_TRACE_FETCH;                                                                             \
+    opcode = m_state.bus.read_byte(m_state.pc++);                                                  \
+    prefixed = opcode == Misc::Prefix;                                                             \
+    if (prefixed)                                                                                  \
+        opcode = m_state.bus.read_byte(m_state.pc++);                                              \
+    COCOA_TRACE_DECODE
+
+#define COCOA_RETIRE                                                                               \
+    if (m_state.tstates >= target || is_slice_over())                                              \
+    return
+
+#ifdef COCOA_HAS_COMPUTED_GOTO
+// NOTE: Same as `COCOA_FETCH`, but jumps straight from each prefix check to its own table.
+#define COCOA_DISPATCH                                                                             \
+    COCOA_TRACE_FETCH;                                                                             \
+    opcode = m_state.bus.read_byte(m_state.pc++);                                                  \
+    if (opcode == Misc::Prefix) {                                                                  \
+        opcode = m_state.bus.read_byte(m_state.pc++);                                              \
+        prefixed = true;                                                                           \
+        COCOA_TRACE_DECODE;                                                                        \
+        goto* cb_prefix[opcode];                                                                   \
+    }                                                                                              \
+    prefixed = false;                                                                              \
+    COCOA_TRACE_DECODE;                                                                            \
+    goto* no_prefix[opcode]
+
+#define COCOA_LABEL(TABLE, LABEL, OPCODE) &&LABEL##OPCODE,
+#define COCOA_HANDLER(TABLE, LABEL, OPCODE)                                                        \
+    LABEL##OPCODE : if (!execute_inline<TABLE, OPCODE>(m_state)) goto illegal;                     \
+    COCOA_RETIRE;                                                                                  \
+    COCOA_DISPATCH;
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif // COCOA_HAS_COMPUTED_GOTO
+
+void
+Sm83::run_threaded(const size_t target)
+{
+    uint8_t opcode = 0;
+    bool prefixed = false;
+#ifdef COCOA_TRACE
+    TraceEntry entry = {};
+#endif // COCOA_TRACE
+
+    if (m_state.tstates >= target)
+        return;
+
+#ifdef COCOA_HAS_COMPUTED_GOTO
+    // NOTE: Every handler ends in its own indirect jump to next handler, so branch predictor
+    // learns opcode pairs instead of sharing one jump across every opcode.
+    static const void* const no_prefix[] = { COCOA_EXPAND(COCOA_LABEL, NO_PREFIX_INSTR, op_) };
+    static const void* const cb_prefix[] = { COCOA_EXPAND(COCOA_LABEL, CB_PREFIX_INSTR, cb_) };
+
+    COCOA_DISPATCH;
+    COCOA_EXPAND(COCOA_HANDLER, NO_PREFIX_INSTR, op_)
+    COCOA_EXPAND(COCOA_HANDLER, CB_PREFIX_INSTR, cb_)
+
+illegal:
+#else
+    for (;;) {
+        COCOA_FETCH;
+        if (!(prefixed ? switch_cb_prefix(m_state, opcode) : switch_no_prefix(m_state, opcode)))
+            break;
+        COCOA_RETIRE;
+    }
+#endif // COCOA_HAS_COMPUTED_GOTO
+
+    throw_illegal_opcode(opcode, prefixed);
+}
+
+#ifdef COCOA_HAS_COMPUTED_GOTO
+#pragma GCC diagnostic pop
+#undef COCOA_HANDLER
+#undef COCOA_LABEL
+#undef COCOA_DISPATCH
+#endif // COCOA_HAS_COMPUTED_GOTO
+
+#undef COCOA_RETIRE
+#undef COCOA_FETCH
+#undef COCOA_TRACE_DECODE
+#undef COCOA_TRACE_FETCH
+#undef COCOA_EXPAND
+#undef COCOA_EXPAND_ROW
+
+void
+Sm83::throw_illegal_opcode(const uint8_t opcode, const bool prefixed)
+{
+    m_state.materialize_flags();
+    const std::string_view mnemonic = instruction_info(opcode, prefixed).mnemonic;
+    std::string message = prefixed
+        ? fmt::format("Illegal opcode {0} (0xCB 0x{1:02X})", mnemonic, opcode)
+        : fmt::format("Illegal opcode {0} (0x{1:02X})", mnemonic, opcode);
+    m_log->error(message);
+    throw IllegalOpcode(message);
+}
+
+#ifdef COCOA_TRACE
+size_t
+Sm83::drain_trace()
+{
+    size_t count = 0;
+    TraceEntry entry = {};
+    while (m_trace->pop(entry)) {
+        const InstructionInfo& instr = instruction_info(entry.opcode, entry.prefixed);
+        m_log->trace("[{0}] ${1:04X}: {2} ({3} bytes) AF=${4:02X}{5:02X} BC=${6:02X}{7:02X} "
+                     "DE=${8:02X}{9:02X} HL=${10:02X}{11:02X} SP=${12:04X}",
+            entry.tstates, entry.pc, instr.mnemonic, instr.length, entry.regs[Sm83State::A],
+            entry.regs[Sm83State::F], entry.regs[Sm83State::B], entry.regs[Sm83State::C],
+            entry.regs[Sm83State::D], entry.regs[Sm83State::E], entry.regs[Sm83State::H],
+            entry.regs[Sm83State::L], entry.sp);
+        ++count;
+    }
+
+    const size_t dropped = m_trace_dropped.exchange(0, std::memory_order_relaxed);
+    if (dropped != 0)
+        m_log->warn("Trace buffer full, dropped {0} entries", dropped);
+
+    return count;
+}
+#endif // COCOA_TRACE
+
+void
+Sm83::service_interrupts()
+{
+    handle_interrupts(m_state);
+}
+
+bool
+Sm83::is_slice_over() const
+{
+    return m_state.mode != Sm83Mode::Running
+        || (m_state.ime && m_state.interrupts.pending() != 0);
+}
+
+void
+Sm83::idle(const size_t tstates)
+{
+    const size_t mcycles = (tstates + 3) / 4;
+    m_state.mcycles += mcycles;
+    m_state.tstates += mcycles * 4;
+}
+
 IllegalOpcode::IllegalOpcode(std::string message)
     : m_message(message)
 {
@@ -5,20 +5,33 @@
 #define COCOA_GB_SM83_HPP
 
 #include <array>
+#include <atomic>
+#include <bitset>
 #include <cstdint>
 #include <exception>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <spdlog/logger.h>
 
+#include "cocoa/gb/interrupt.hpp"
 #include "cocoa/gb/memory.hpp"
+#include "cocoa/ring_buffer.hpp"
 #include "cocoa/utility.hpp"
 
+#ifdef COCOA_JIT
+#include "cocoa/gb/sm83_jit.hpp"
+#endif // COCOA_JIT
+
 namespace cocoa::gb {
-// NOTE: Excludes 0xCB, because it represents the prefix to an opcode rather than a full
+// NOTE: Entry 0xCB stays empty, because it represents the prefix to an opcode rather than a full
 // instruction.
-constexpr size_t NO_PREFIX_INSTR_TABLE_SIZE = 255;
+constexpr size_t NO_PREFIX_INSTR_TABLE_SIZE = 256;
 
 constexpr size_t CB_PREFIX_INSTR_TABLE_SIZE = 256;
 
@@ -57,12 +70,48 @@ enum class Imm16 {
     IndirAbsolute,
 };
 
+/// @brief Strategies to dispatch decoded opcodes to their instruction implementation.
+enum class Sm83Dispatch {
+    /// Indirect call through instruction table per instruction.
+    Table,
+
+    /// Threaded code with every instruction inlined into its own handler. Handlers jump straight
+    /// to each other through labels as values on GCC and Clang, or loop over one big switch on
+    /// other compilers.
+    Threaded,
+
+    /// Basic blocks pre-decoded from read-only memory, e.g., cartridge ROM. Blocks skip fetch and
+    /// decode entirely, never check t-state budget per instruction, and skip slice checks after
+    /// instructions that only touch registers. Code anywhere else, and blocks that do not fit in
+    /// what is left of budget, run through instruction table.
+    Block,
+
+#ifdef COCOA_JIT
+    /// Same as `Sm83Dispatch::Block`, but hot blocks are translated to native code once they ran
+    /// `JIT_HOT_RUNS` times. Only `run_for()` runs native code, since it has no predicate to check
+    /// per instruction.
+    Jit,
+#endif // COCOA_JIT
+};
+
 /// @brief CPU flags available.
 enum class Flag { Z = 7, N = 6, H = 5, C = 4 };
 
 /// @brief Conditional flag states for control flow instructions.
 enum class Condition { NZ, Z, NC, C };
 
+/// @brief Kinds of operation whose flags are derived lazily from their operands and result.
+///
+/// Carry flag is recorded as is by every kind, since ADC, SBC, and rotates through carry read it
+/// right after it is written. Z flag is derived from result. N and H flags are derived as follows:
+///
+/// - `FlagOp::None` means F register holds every flag as is.
+/// - `FlagOp::Add` and `FlagOp::Inc` clear N flag, and derive H flag from operands.
+/// - `FlagOp::Sub` and `FlagOp::Dec` set N flag, and derive H flag from operands.
+/// - `FlagOp::And` clears N flag, and sets H flag.
+/// - `FlagOp::OrXor` and `FlagOp::Shift` clear N and H flags.
+enum class FlagOp { None, Add, Sub, And, OrXor, Inc, Dec, Shift };
+
 /// @brief Modes of execution for SM83 CPU.
 enum class Sm83Mode {
     Running,
@@ -70,9 +119,32 @@ enum class Sm83Mode {
     Stopped,
 };
 
+/// @brief Plain image of CPU state stored in save states.
+///
+/// @invariant Fields are fixed width and explicitly padded, so layout is identical across builds.
+struct Sm83Snapshot final {
+    uint64_t mcycles;
+    uint64_t tstates;
+    std::array<uint8_t, 8> regs;
+    uint16_t sp;
+    uint16_t pc;
+    uint8_t mode;
+    uint8_t ime;
+    std::array<uint8_t, 2> reserved;
+};
+
+static_assert(sizeof(Sm83Snapshot) == 32);
+
 /// @brief State of SM83 CPU.
 ///
 /// This contains any state needed for an instruction implementation to function correctly.
+///
+/// Most ALU instructions overwrite every flag, and most of those flags get overwritten again
+/// before anything reads them. Thus, ALU instructions only record their operands and result
+/// through `record_flags()`, and flags are derived from that record once read. While a record is
+/// pending, high nibble of F register is stale, so it must be read through `load_flags()`, or
+/// folded back into F register through `materialize_flags()`. `Sm83` materializes flags before it
+/// returns, so F register is only stale while instructions run.
 struct Sm83State final {
     enum RegIndex {
         A = 0,
@@ -94,6 +166,16 @@ struct Sm83State final {
     uint16_t pc;
     bool ime;
 
+    /// Pending interrupts, cached so CPU never reads IF and IE to check for them.
+    InterruptController interrupts;
+
+    /// Last operation whose flags are pending, along with what they are derived from.
+    FlagOp flag_op;
+    uint8_t flag_result;
+    uint8_t flag_operand1;
+    uint8_t flag_operand2;
+    bool flag_carry;
+
     explicit Sm83State(MemoryBus& memory);
 
     /// @brief Load using 8-bit register addressing.
@@ -278,19 +360,117 @@ struct Sm83State final {
     [[nodiscard]]
     constexpr bool
     is_condition_set() const;
+
+    /// @brief Record operation that replaces every flag, deriving flags only once read.
+    ///
+    /// @param [in] result 8-bit result of operation.
+    /// @param [in] operand1 First operand, only used by `FlagOp::{Add, Sub, Inc, Dec}`.
+    /// @param [in] operand2 Second operand, only used by `FlagOp::{Add, Sub, Inc, Dec}`.
+    /// @param [in] carry Carry flag.
+    ///
+    /// @invariant Low nibble of F register is left as is.
+    template <enum FlagOp O>
+    constexpr void
+    record_flags(
+        const uint8_t result, const uint8_t operand1 = 0, const uint8_t operand2 = 0,
+        const bool carry = false);
+
+    /// @brief Load F register with any pending flags applied.
+    ///
+    /// @return Value of F register.
+    [[nodiscard]]
+    constexpr uint8_t
+    load_flags() const;
+
+    /// @brief Fold any pending flags into F register.
+    constexpr void
+    materialize_flags();
 };
 
+/// @brief Amount of t-states in one m-cycle.
+constexpr size_t TSTATES_PER_MCYCLE = 4;
+
 /// @brief SM83 instruction implementation.
 ///
-/// Used to represent a given instruction after decoding a given opcode.
+/// Used to represent a given instruction after decoding a given opcode. Only holds what is needed
+/// to dispatch an instruction, so instruction tables stay small enough to remain cache resident.
+/// Tables are shared by every CPU instance. See `InstructionInfo` for everything else.
 struct Instruction final {
+    void (*execute)(Sm83State&) = nullptr;
+
+    /// Amount of m-cycles taken. Conditional control flow adds extra m-cycles itself when taken.
+    uint8_t mcycles = 0;
+};
+
+/// @brief SM83 instruction metadata.
+///
+/// Only needed to disassemble or trace instructions, so it is kept apart from `Instruction`.
+struct InstructionInfo final {
     std::string_view mnemonic;
-    size_t length;
-    size_t mcycles;
+    uint8_t length = 0;
+};
+
+/// @brief Look up metadata of instruction.
+///
+/// @param [in] opcode Opcode of instruction, excluding 0xCB prefix byte.
+/// @param [in] prefixed Look up instruction prefixed by 0xCB.
+/// @return Metadata of instruction, with empty mnemonic for opcode 0xCB without prefix.
+[[nodiscard]]
+const InstructionInfo&
+instruction_info(const uint8_t opcode, const bool prefixed);
+
+#ifdef COCOA_TRACE
+/// @brief Amount of trace entries buffered before producer starts dropping them.
+constexpr size_t TRACE_BUFFER_SIZE = 65536;
+
+/// @brief Record of one executed instruction for tracing builds.
+///
+/// Only raw CPU state is recorded in the execution path. Formatting into text is deferred until
+/// entries are drained from the trace buffer.
+struct TraceEntry final {
+    std::array<uint8_t, 8> regs;
     size_t tstates;
-    void (*execute)(Sm83State&) = nullptr;
+    uint16_t sp;
+    uint16_t pc;
+    uint8_t opcode;
+    bool prefixed;
+};
+
+using TraceBuffer = RingBuffer<TraceEntry, TRACE_BUFFER_SIZE>;
+#endif // COCOA_TRACE
+
+/// @brief Stop condition that only has to be checked where a basic block starts, and after
+///        instructions with effects.
+///
+/// Such a condition may only depend on PC through breakpoints given to `Sm83::set_breakpoints()`,
+/// which blocks end in front of, and on state that only instructions with effects change, e.g.,
+/// watchpoint hits. Other dispatch strategies check it before each instruction as usual.
+template <typename Predicate>
+struct BlockPredicate final {
+    Predicate predicate;
+
+    bool
+    operator()(const Sm83State& state)
+    {
+        return predicate(state);
+    }
 };
 
+/// @brief Wrap stop condition into `BlockPredicate`.
+template <typename Predicate>
+BlockPredicate<Predicate>
+block_predicate(Predicate predicate)
+{
+    return { predicate };
+}
+
+/// @brief Check if predicate type is a `BlockPredicate`.
+template <typename Predicate>
+struct is_block_predicate : std::false_type { };
+
+template <typename Predicate>
+struct is_block_predicate<BlockPredicate<Predicate>> : std::true_type { };
+
 /// @brief SM83 CPU.
 ///
 /// The Game Boy uses an 8-bit CPU identified as the SM83 CPU core in old Sharp datasheets.
@@ -318,6 +498,38 @@ class Sm83 final {
     void
     step();
 
+    /// @brief Run instructions until t-state budget is exhausted.
+    ///
+    /// Executes a whole slice of instructions in one tight loop instead of paying for a call to
+    /// `step()` per instruction. Pending interrupts are serviced once on entry. The slice ends
+    /// early if an interrupt becomes serviceable, or if the CPU enters HALT or STOP mode. If the
+    /// CPU is already halted or stopped on entry, then the whole budget is spent idling.
+    ///
+    /// @param [in] tstates Budget of t-states to run for.
+    /// @return Number of t-states consumed, which can overshoot budget by one instruction.
+    ///
+    /// @throws `IllegalOpcode` if any of the 11 illegal opcode instructions are encountered.
+    size_t
+    run_for(size_t tstates);
+
+    /// @brief Run instructions until predicate is satisfied or t-state budget is exhausted.
+    ///
+    /// Behaves like `run_for()`, but also checks given predicate against CPU state before each
+    /// instruction. Predicate must be callable as `bool(const Sm83State&)`. Basic blocks only
+    /// check a `BlockPredicate` where they start, and after instructions with effects.
+    ///
+    /// @note Flags may still be pending while predicate is checked, so predicate must read F
+    ///       register through `Sm83State::load_flags()`.
+    ///
+    /// @param [in] tstates Budget of t-states to run for.
+    /// @param [in] predicate Stop condition checked before each instruction.
+    /// @return Number of t-states consumed, which can overshoot budget by one instruction.
+    ///
+    /// @throws `IllegalOpcode` if any of the 11 illegal opcode instructions are encountered.
+    template <typename Predicate>
+    size_t
+    run_until(size_t tstates, Predicate predicate);
+
     /// @brief Get current m-cycle count.
     ///
     /// @return m-cycle count.
@@ -332,11 +544,242 @@ class Sm83 final {
     size_t
     tstates() const;
 
+    /// @brief Keep CPU off the bus for given amount of t-states, e.g., while DMA owns it.
+    ///
+    /// Time passes as if CPU idled, so it can be called from within a memory access of an
+    /// instruction, which then completes that much later.
+    ///
+    /// @param [in] tstates Amount of t-states to stall for, rounded up to whole m-cycles.
+    void
+    stall(const size_t tstates);
+
+    /// @brief Wake CPU up from HALT or STOP, e.g., once CGB speed switch completes.
+    void
+    resume();
+
+    /// @brief Get current CPU state.
+    ///
+    /// @return Read-only view of CPU state.
+    [[nodiscard]]
+    const Sm83State&
+    state() const;
+
+    /// @brief Select how opcodes are dispatched to their implementation.
+    ///
+    /// Every strategy executes identical instructions. `Sm83Dispatch::Table` is the default.
+    ///
+    /// @note In `bm_run_for` of `cocoa_bench`, `Sm83Dispatch::Threaded` runs repeatably faster
+    ///       than `Sm83Dispatch::Table`, while `Sm83Dispatch::Block` lands on either side of it
+    ///       from run to run. Measure with `cocoa_bench` before switching on other workloads.
+    ///
+    /// @param [in] dispatch Dispatch strategy to use from next instruction onwards.
+    void
+    set_dispatch(const Sm83Dispatch dispatch);
+
+    [[nodiscard]]
+    Sm83Dispatch
+    dispatch() const;
+
+#ifdef COCOA_JIT
+    /// @brief Get amount of native code translated for `Sm83Dispatch::Jit` so far.
+    ///
+    /// @return Size of native code in bytes.
+    [[nodiscard]]
+    size_t
+    jit_code_size() const;
+#endif // COCOA_JIT
+
+    /// @brief Set PC breakpoints that basic blocks end in front of.
+    ///
+    /// Lets `BlockPredicate` check breakpoints only where a block starts. Decoded blocks are
+    /// flushed, so this must be called again whenever breakpoints change.
+    ///
+    /// @note Blocks decoded from memory mapped at several addresses at once honor breakpoints of
+    ///       the address they were first decoded at only.
+    ///
+    /// @param [in] breakpoints Bitmap of one bit per address, or null for none. Must outlive CPU,
+    ///        or be unset first.
+    void
+    set_breakpoints(const std::bitset<MEMORY_BUS_SIZE>* breakpoints);
+
+    /// @brief Drop every basic block decoded for `Sm83Dispatch::Block`.
+    ///
+    /// Blocks are keyed by host address of the read-only page they were decoded from, so bank
+    /// switches need no flush. Only needed if memory once mapped read-only is modified, or freed
+    /// and reused for other code.
+    void
+    flush_blocks();
+
+    /// @brief Capture CPU state for save state.
+    ///
+    /// @param [out] out Snapshot to fill.
+    void
+    save_state(Sm83Snapshot& out) const;
+
+    /// @brief Restore CPU state from save state.
+    ///
+    /// Pending interrupts are recomputed from IF and IE, so memory bus must be restored first.
+    ///
+    /// @param [in] snapshot Snapshot to restore from.
+    ///
+    /// @pre Snapshot holds a valid `Sm83Mode`.
+    void
+    load_state(const Sm83Snapshot& snapshot);
+
+#ifdef COCOA_TRACE
+    /// @brief Format and log all buffered trace entries.
+    ///
+    /// Entries are written through logger at trace level. Can be called from another thread than
+    /// the one executing instructions, e.g., a dedicated logging thread.
+    ///
+    /// @return Amount of trace entries drained.
+    size_t
+    drain_trace();
+#endif // COCOA_TRACE
+
 private:
-    std::array<Instruction, NO_PREFIX_INSTR_TABLE_SIZE> m_no_prefix_instr;
-    std::array<Instruction, CB_PREFIX_INSTR_TABLE_SIZE> m_cb_prefix_instr;
+    /// @brief Fetch, decode, and execute one instruction.
+    ///
+    /// Does not service interrupts or check CPU mode.
+    void
+    execute();
+
+    /// @brief Fetch, decode, and execute one instruction through instruction table.
+    void
+    execute_table();
+
+    /// @brief Execute instructions through threaded dispatch until target t-state is reached.
+    ///
+    /// Like `run_for()`, slice ends early if CPU leaves running mode or an interrupt becomes
+    /// serviceable.
+    ///
+    /// @param [in] target T-state count to stop at.
+    void
+    run_threaded(const size_t target);
+
+    /// @brief Execute instructions through basic blocks until target t-state is reached.
+    ///
+    /// Like `run_for()`, slice ends early if CPU leaves running mode or an interrupt becomes
+    /// serviceable. Predicate must be callable as `bool(const Sm83State&)`, and is checked before
+    /// each instruction like in `run_until()`, unless it is a `BlockPredicate`.
+    ///
+    /// @param [in] target T-state count to stop at.
+    /// @param [in] predicate Stop condition checked before each instruction.
+    /// @param [in] native Run hot blocks as native code, which never checks predicate.
+    template <typename Predicate>
+    void
+    run_blocks(const size_t target, Predicate predicate, const bool native);
+
+    /// @brief One instruction of basic block, decoded ahead of time.
+    struct BlockOp final {
+        void (*execute)(Sm83State&);
+        uint8_t mcycles;
+
+        /// Bytes of opcode, i.e., 2 with 0xCB prefix or 1 without. Immediates are left to
+        /// instruction implementation, which reads them through fast path of read-only page.
+        uint8_t fetch;
+        uint8_t opcode;
+
+        /// Offset of instruction in its page.
+        uint8_t offset;
+        bool prefixed;
+
+        /// Instruction may access memory past its own bytes, or change IME or CPU mode. Only such
+        /// instructions can end a slice or remap page that block was decoded from.
+        bool effects;
+    };
+
+    /// @brief Straight line of instructions ending at control flow, HALT, STOP, page end, or
+    ///        illegal opcode.
+    struct Block final {
+        std::vector<BlockOp> ops;
+
+        /// Sum of m-cycles of every instruction, excluding extra m-cycles of taken branches.
+        size_t mcycles = 0;
+        bool decoded = false;
+#ifdef COCOA_JIT
+        uint32_t runs = 0;
+        JitCode native = nullptr;
+#endif // COCOA_JIT
+    };
+
+    /// @brief Blocks starting at each offset of one read-only page.
+    struct BlockPage final {
+        std::array<Block, MEMORY_PAGE_SIZE> blocks;
+    };
+
+    /// @brief Look up block starting at address, decoding it on first use.
+    ///
+    /// @param [in] pc Address of first instruction.
+    /// @return Block, or null if address is not read-only memory or starts no instruction that
+    ///         fits in its page.
+    [[nodiscard]]
+    Block*
+    find_block(const uint16_t pc);
+
+    /// @brief Decode block starting at address of read-only page.
+    ///
+    /// @param [in] memory Host memory of page.
+    /// @param [in] pc Address of first instruction.
+    /// @param [out] block Block to fill.
+    void
+    decode_block(const uint8_t* memory, const uint16_t pc, Block& block) const;
+
+#ifdef COCOA_JIT
+    /// @brief Get native code of block, translating it once it is hot.
+    ///
+    /// @param [in,out] block Block to run.
+    /// @param [in] memory Host memory of page that block was decoded from.
+    /// @return Native code, or null if block is not hot yet.
+    [[nodiscard]]
+    JitCode
+    native_block(Block& block, const uint8_t* memory);
+#endif // COCOA_JIT
+
+    /// @brief Log and throw illegal opcode error.
+    ///
+    /// @throws `IllegalOpcode` always.
+    [[noreturn]]
+    void
+    throw_illegal_opcode(const uint8_t opcode, const bool prefixed);
+
+    /// @brief Service pending interrupts and wake CPU up from HALT mode.
+    void
+    service_interrupts();
+
+    /// @brief Check if current slice of execution must end.
+    ///
+    /// @return True if CPU left running mode or an interrupt can be serviced, false otherwise.
+    [[nodiscard]]
+    bool
+    is_slice_over() const;
+
+    /// @brief Idle in HALT or STOP mode for a given amount of t-states.
+    ///
+    /// @param [in] tstates Amount of t-states to idle, rounded up to whole m-cycles.
+    void
+    idle(size_t tstates);
+
     Sm83State m_state;
     std::shared_ptr<spdlog::logger> m_log;
+    Sm83Dispatch m_dispatch;
+
+    /// Decoded pages keyed by host memory they were decoded from, so each bank has its own.
+    std::unordered_map<const uint8_t*, std::unique_ptr<BlockPage>> m_block_cache;
+
+    /// Host memory last seen at each bus page, and its decoded page, so lookups skip the hash.
+    std::array<const uint8_t*, MEMORY_PAGE_COUNT> m_block_memory;
+    std::array<BlockPage*, MEMORY_PAGE_COUNT> m_block_pages;
+
+    /// Breakpoints that blocks end in front of, if any.
+    const std::bitset<MEMORY_BUS_SIZE>* m_breakpoints;
+#ifdef COCOA_JIT
+    Sm83Jit m_jit;
+#endif // COCOA_JIT
+#ifdef COCOA_TRACE
+    std::unique_ptr<TraceBuffer> m_trace;
+    std::atomic<size_t> m_trace_dropped;
+#endif // COCOA_TRACE
 };
 
 class IllegalOpcode final : public std::exception {
@@ -81,7 +81,7 @@ Sm83State::load_reg16_stack() const
     if constexpr (R == Reg16Stack::HL)
         return load_reg16<Reg16::HL>();
     if constexpr (R == Reg16Stack::AF)
-        return cocoa::from_pair(regs[RegIndex::A], regs[RegIndex::F]);
+        return cocoa::from_pair(regs[RegIndex::A], load_flags());
 }
 
 template <enum Reg16Indir R>
@@ -146,6 +146,7 @@ Sm83State::store_reg16_stack(const uint16_t value)
     if constexpr (R == Reg16Stack::AF) {
         regs[RegIndex::A] = cocoa::from_high(value);
         regs[RegIndex::F] = cocoa::from_low(value);
+        flag_op = FlagOp::None;
     }
 }
 
@@ -231,6 +232,7 @@ template <enum Flag F>
 constexpr void
 Sm83State::set_flag()
 {
+    materialize_flags();
     uint8_t flag = regs[RegIndex::F];
     set_bit<uint8_t, cocoa::from_enum(F)>(flag);
     regs[RegIndex::F] = flag;
@@ -240,6 +242,7 @@ template <enum Flag F>
 constexpr void
 Sm83State::clear_flag()
 {
+    materialize_flags();
     uint8_t flag = regs[RegIndex::F];
     clear_bit<uint8_t, cocoa::from_enum(F)>(flag);
     regs[RegIndex::F] = flag;
@@ -249,6 +252,7 @@ template <enum Flag F>
 constexpr void
 Sm83State::conditional_flag_toggle(bool condition)
 {
+    materialize_flags();
     uint8_t flag = regs[RegIndex::F];
     conditional_bit_toggle<uint8_t, cocoa::from_enum(F)>(flag, condition);
     regs[RegIndex::F] = flag;
@@ -258,6 +262,7 @@ template <enum Flag F>
 constexpr void
 Sm83State::toggle_flag()
 {
+    materialize_flags();
     uint8_t flag = regs[RegIndex::F];
     toggle_bit<uint8_t, cocoa::from_enum(F)>(flag);
     regs[RegIndex::F] = flag;
@@ -268,8 +273,33 @@ template <enum Flag F>
 constexpr bool
 Sm83State::is_flag_set() const
 {
-    uint8_t flag = regs[RegIndex::F];
-    return is_bit_set<uint8_t, cocoa::from_enum(F)>(flag);
+    if (flag_op == FlagOp::None) {
+        uint8_t flag = regs[RegIndex::F];
+        return is_bit_set<uint8_t, cocoa::from_enum(F)>(flag);
+    }
+
+    if constexpr (F == Flag::Z)
+        return flag_result == 0;
+    if constexpr (F == Flag::N)
+        return flag_op == FlagOp::Sub || flag_op == FlagOp::Dec;
+
+    if constexpr (F == Flag::H) {
+        switch (flag_op) {
+        case FlagOp::Add:
+        case FlagOp::Inc:
+            return (((flag_operand1 & 0x0F) + (flag_operand2 & 0x0F)) & 0x10) == 0x10;
+        case FlagOp::Sub:
+        case FlagOp::Dec:
+            return (((flag_operand1 & 0x0F) - (flag_operand2 & 0x0F)) & 0x10) == 0x10;
+        case FlagOp::And:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    if constexpr (F == Flag::C)
+        return flag_carry;
 }
 
 template <enum Condition C>
@@ -286,6 +316,141 @@ Sm83State::is_condition_set() const
     if constexpr (C == Condition::C)
         return is_flag_set<Flag::C>();
 }
+
+template <enum FlagOp O>
+constexpr void
+Sm83State::record_flags(
+    const uint8_t result, const uint8_t operand1, const uint8_t operand2, const bool carry)
+{
+    // NOTE: Only store what flags of operation are derived from, since this runs per instruction.
+    flag_op = O;
+    flag_result = result;
+    flag_carry = carry;
+    if constexpr (O == FlagOp::Add || O == FlagOp::Sub || O == FlagOp::Inc || O == FlagOp::Dec) {
+        flag_operand1 = operand1;
+        flag_operand2 = operand2;
+    }
+}
+
+[[nodiscard]]
+constexpr uint8_t
+Sm83State::load_flags() const
+{
+    if (flag_op == FlagOp::None)
+        return regs[RegIndex::F];
+
+    uint8_t flag = static_cast<uint8_t>(regs[RegIndex::F] & 0x0F);
+    conditional_bit_toggle<uint8_t, cocoa::from_enum(Flag::Z)>(flag, is_flag_set<Flag::Z>());
+    conditional_bit_toggle<uint8_t, cocoa::from_enum(Flag::N)>(flag, is_flag_set<Flag::N>());
+    conditional_bit_toggle<uint8_t, cocoa::from_enum(Flag::H)>(flag, is_flag_set<Flag::H>());
+    conditional_bit_toggle<uint8_t, cocoa::from_enum(Flag::C)>(flag, is_flag_set<Flag::C>());
+    return flag;
+}
+
+constexpr void
+Sm83State::materialize_flags()
+{
+    regs[RegIndex::F] = load_flags();
+    flag_op = FlagOp::None;
+}
+
+template <typename Predicate>
+size_t
+Sm83::run_until(const size_t tstates, Predicate predicate)
+{
+    const size_t start = m_state.tstates;
+    service_interrupts();
+    if (m_state.mode != Sm83Mode::Running) {
+        idle(tstates);
+        return m_state.tstates - start;
+    }
+
+    const size_t target = start + tstates;
+#ifdef COCOA_JIT
+    const bool blocks = m_dispatch == Sm83Dispatch::Block || m_dispatch == Sm83Dispatch::Jit;
+#else
+    const bool blocks = m_dispatch == Sm83Dispatch::Block;
+#endif // COCOA_JIT
+    if (blocks) {
+        run_blocks(target, predicate, false);
+        m_state.materialize_flags();
+        return m_state.tstates - start;
+    }
+
+    while (m_state.tstates < target && !predicate(std::as_const(m_state))) {
+        execute();
+        if (is_slice_over())
+            break;
+    }
+
+    m_state.materialize_flags();
+    return m_state.tstates - start;
+}
+
+template <typename Predicate>
+void
+Sm83::run_blocks(const size_t target, Predicate predicate, [[maybe_unused]] const bool native)
+{
+    constexpr bool per_block = is_block_predicate<Predicate>::value;
+    while (m_state.tstates < target && !predicate(std::as_const(m_state))) {
+        const uint16_t pc = m_state.pc;
+        Block* block = find_block(pc);
+
+        // NOTE: Blocks that run past budget are rare enough to leave to instruction table, so
+        // budget is never checked per instruction of block.
+        if (block == nullptr || m_state.tstates + block->mcycles * TSTATES_PER_MCYCLE > target) {
+            execute_table();
+            if (is_slice_over())
+                return;
+            continue;
+        }
+
+        const uint8_t page = cocoa::from_high(pc);
+        const uint8_t* memory = m_block_memory[page];
+#ifdef COCOA_JIT
+        // NOTE: Native code only leaves early after instructions with effects, like below.
+        if (native) {
+            if (JitCode code = native_block(*block, memory)) {
+                if (code(m_state, page, memory) && is_slice_over())
+                    return;
+                continue;
+            }
+        }
+#endif // COCOA_JIT
+
+        for (auto op = block->ops.begin();;) {
+#ifdef COCOA_TRACE
+            m_state.materialize_flags();
+            const TraceEntry entry = {
+                m_state.regs, m_state.tstates, m_state.sp, m_state.pc, op->opcode, op->prefixed
+            };
+            if (!m_trace->push(entry))
+                m_trace_dropped.fetch_add(1, std::memory_order_relaxed);
+#endif // COCOA_TRACE
+
+            m_state.pc = static_cast<uint16_t>(m_state.pc + op->fetch);
+            op->execute(m_state);
+            m_state.mcycles += op->mcycles;
+            m_state.tstates += op->mcycles * TSTATES_PER_MCYCLE;
+
+            // INVARIANT: Slice cannot end after instruction without effects, since IE, IF, IME,
+            // and CPU mode are all left untouched. Neither can any page be remapped, nor can
+            // `BlockPredicate` change.
+            if (op->effects) {
+                if (is_slice_over())
+                    return;
+                if (m_state.bus.read_only_page(page) != memory)
+                    break;
+                if (per_block && predicate(std::as_const(m_state)))
+                    return;
+            }
+            if (++op == block->ops.end())
+                break;
+            if (!per_block && predicate(std::as_const(m_state)))
+                return;
+        }
+    }
+}
 } // namespace cocoa::gb
 
 #endif // COCOA_GB_SM83_TPP
@@ -0,0 +1,277 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <spdlog/logger.h>
+
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/sm83.hpp"
+#include "cocoa/utility.hpp"
+
+// NOTE: Amount of t-states executed per benchmark iteration.
+constexpr size_t SLICE_TSTATES = 70224;
+
+// NOTE: Every workload is entered from cartridge entry point.
+constexpr uint16_t ENTRY_POINT = 0x0100;
+
+/// @brief Synthetic program executed in an endless loop.
+///
+/// Program starts with `DI` followed by prologue, which runs once. Body is repeated back to back
+/// to amortize loop overhead, and closed with a `JP` back to start of body. Address 0x0008 always
+/// holds a `RET`, so `RST $08` can be used to benchmark calls.
+struct Workload final {
+    std::vector<uint8_t> prologue;
+    std::vector<uint8_t> body;
+    size_t repeat;
+};
+
+/// @brief Load workload into memory bus.
+///
+/// @return Address of loop body.
+static uint16_t
+load_workload(cocoa::gb::MemoryBus& bus, const Workload& workload)
+{
+    bus.write_byte(0x0008, 0xC9);
+
+    uint16_t address = ENTRY_POINT;
+    bus.write_byte(address++, 0xF3);
+    for (uint8_t byte : workload.prologue)
+        bus.write_byte(address++, byte);
+
+    const uint16_t loop = address;
+    for (size_t i = 0; i < workload.repeat; ++i) {
+        for (uint8_t byte : workload.body)
+            bus.write_byte(address++, byte);
+    }
+    bus.write_byte(address++, 0xC3);
+    bus.write_word(address, loop);
+    return loop;
+}
+
+/// @brief Remap cartridge area of bus onto read-only copy of itself, like cartridge ROM is.
+///
+/// @param [out] rom Storage for copy, which must outlive mapping.
+static void
+map_rom(cocoa::gb::MemoryBus& bus, std::vector<uint8_t>& rom)
+{
+    rom.resize(0x8000);
+    for (size_t address = 0; address < rom.size(); ++address)
+        rom[address] = bus.read_byte(static_cast<uint16_t>(address));
+    bus.map_pages(0x0000, 0x7FFF, rom.data(), nullptr);
+}
+
+/// @brief Run workload and report MIPS and nanoseconds per instruction.
+///
+/// Amount of instructions per t-state is calibrated by stepping through one loop iteration before
+/// timing starts, so timed loop itself does not count instructions.
+static void
+bm_workload(benchmark::State& state, const Workload& workload,
+    const cocoa::gb::Sm83Dispatch dispatch = cocoa::gb::Sm83Dispatch::Table)
+{
+    cocoa::gb::MemoryBus bus {};
+    std::vector<uint8_t> rom;
+    const uint16_t loop = load_workload(bus, workload);
+    map_rom(bus, rom);
+    cocoa::gb::Sm83 cpu(std::make_shared<spdlog::logger>("bench"), bus);
+    cpu.set_dispatch(dispatch);
+
+    cpu.run_until(SLICE_TSTATES, [loop](const cocoa::gb::Sm83State& cpu_state) {
+        return cpu_state.pc == loop;
+    });
+    const size_t calibrate = cpu.tstates();
+    size_t instructions = 0;
+    do {
+        cpu.step();
+        ++instructions;
+    } while (cpu.state().pc != loop);
+    const double per_tstate
+        = static_cast<double>(instructions) / static_cast<double>(cpu.tstates() - calibrate);
+
+    const size_t start = cpu.tstates();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(cpu.run_for(SLICE_TSTATES));
+
+    const double executed = static_cast<double>(cpu.tstates() - start) * per_tstate;
+    state.counters["MIPS"] = benchmark::Counter(executed / 1e6, benchmark::Counter::kIsRate);
+    state.counters["ns/instr"] = benchmark::Counter(
+        executed * 1e-9, benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+    state.counters["tstates"] = benchmark::Counter(
+        static_cast<double>(cpu.tstates() - start), benchmark::Counter::kIsRate);
+}
+
+// LD B, C / LD C, D / LD D, E / LD E, H / LD H, L / LD L, A / LD A, B / LD B, A
+BENCHMARK_CAPTURE(bm_workload, ld_r_r,
+    Workload { {}, { 0x41, 0x4A, 0x53, 0x5C, 0x65, 0x6F, 0x78, 0x47 }, 16 });
+
+// ADD A, B / ADC A, B / SUB A, B / SBC A, B / AND A, B / XOR A, B / OR A, B / CP A, B
+BENCHMARK_CAPTURE(bm_workload, alu_r,
+    Workload { {}, { 0x80, 0x88, 0x90, 0x98, 0xA0, 0xA8, 0xB0, 0xB8 }, 16 });
+
+// ADD A, n8 / SUB A, n8 / AND A, n8 / XOR A, n8 / OR A, n8 / CP A, n8
+BENCHMARK_CAPTURE(bm_workload, alu_imm8,
+    Workload { {},
+        { 0xC6, 0x01, 0xD6, 0x02, 0xE6, 0xFF, 0xEE, 0x55, 0xF6, 0x0F, 0xFE, 0x10 },
+        16 });
+
+// INC B / DEC C / INC D / DEC E / INC BC / DEC DE / INC HL / DEC HL
+BENCHMARK_CAPTURE(bm_workload, inc_dec,
+    Workload { {}, { 0x04, 0x0D, 0x14, 0x1D, 0x03, 0x1B, 0x23, 0x2B }, 16 });
+
+// RLC B / RRC C / RL D / RR E / SLA B / SRA B / SWAP B / SRL B
+BENCHMARK_CAPTURE(bm_workload, cb_rotate,
+    Workload { {},
+        { 0xCB, 0x00, 0xCB, 0x09, 0xCB, 0x12, 0xCB, 0x1B, 0xCB, 0x20, 0xCB, 0x28, 0xCB, 0x30, 0xCB,
+            0x38 },
+        16 });
+
+// BIT 0, A / SET 0, B / RES 0, B / BIT 7, A
+BENCHMARK_CAPTURE(bm_workload, cb_bit,
+    Workload { {}, { 0xCB, 0x47, 0xCB, 0xC0, 0xCB, 0x80, 0xCB, 0x7F }, 16 });
+
+// JR +0 / JR NZ, +0 / JR Z, +0
+BENCHMARK_CAPTURE(bm_workload, jr,
+    Workload { {}, { 0x18, 0x00, 0x20, 0x00, 0x28, 0x00 }, 16 });
+
+// LD SP, $DFF0 then RST $08 / RET
+BENCHMARK_CAPTURE(bm_workload, call_ret, Workload { { 0x31, 0xF0, 0xDF }, { 0xCF }, 32 });
+
+// LD SP, $DFF0 then PUSH BC / PUSH DE / PUSH HL / PUSH AF / POP AF / POP HL / POP DE / POP BC
+BENCHMARK_CAPTURE(bm_workload, push_pop,
+    Workload { { 0x31, 0xF0, 0xDF }, { 0xC5, 0xD5, 0xE5, 0xF5, 0xF1, 0xE1, 0xD1, 0xC1 }, 16 });
+
+// LD HL, $C000 then LD A, [HL] / LD [HL], A / INC [HL] / DEC [HL]
+BENCHMARK_CAPTURE(bm_workload, indirect_hl,
+    Workload { { 0x21, 0x00, 0xC0 }, { 0x7E, 0x77, 0x34, 0x35 }, 16 });
+
+// Copy 2 KiB from WRAM bank 0 to WRAM bank 1, byte by byte:
+//
+// ```
+// loop: LD HL, $C000
+//       LD DE, $D000
+//       LD BC, $0800
+// copy: LD A, [HL+]
+//       LD [DE], A
+//       INC DE
+//       DEC BC
+//       LD A, B
+//       OR C
+//       JR NZ, copy
+// ```
+BENCHMARK_CAPTURE(bm_workload, mixed_memcpy,
+    Workload { {},
+        { 0x21, 0x00, 0xC0, 0x11, 0x00, 0xD0, 0x01, 0x00, 0x08, 0x2A, 0x12, 0x13, 0x0B, 0x78, 0xB1,
+            0x20, 0xF8 },
+        1 });
+
+// Poll LY register like games waiting on VBlank, which stresses I/O page accesses:
+//
+// ```
+// loop: LDH A, [$44]
+//       CP $90
+//       JR NZ, loop
+// ```
+BENCHMARK_CAPTURE(bm_workload, mixed_poll_ly,
+    Workload { {}, { 0xF0, 0x44, 0xFE, 0x90, 0x20, 0xFA }, 1 });
+
+// Blend of loads, ALU, CB, branches, and stack traffic typical of game logic:
+//
+// ```
+// LD HL, $C000
+// LD SP, $DFF0
+// loop: LD A, $12
+//       ADD A, B
+//       SWAP A
+//       LD [HL], A
+//       INC L
+//       AND $0F
+//       JR NZ, +0
+//       PUSH BC
+//       POP BC
+// ```
+BENCHMARK_CAPTURE(bm_workload, mixed_logic,
+    Workload { { 0x21, 0x00, 0xC0, 0x31, 0xF0, 0xDF },
+        { 0x3E, 0x12, 0x80, 0xCB, 0x37, 0x77, 0x2C, 0xE6, 0x0F, 0x20, 0x00, 0xC5, 0xC1 }, 8 });
+
+// Same as `mixed_logic`, but dispatched through threaded code for comparison.
+BENCHMARK_CAPTURE(bm_workload, mixed_logic_threaded,
+    Workload { { 0x21, 0x00, 0xC0, 0x31, 0xF0, 0xDF },
+        { 0x3E, 0x12, 0x80, 0xCB, 0x37, 0x77, 0x2C, 0xE6, 0x0F, 0x20, 0x00, 0xC5, 0xC1 }, 8 },
+    cocoa::gb::Sm83Dispatch::Threaded);
+
+// Same as `mixed_logic`, but dispatched through pre-decoded basic blocks for comparison.
+BENCHMARK_CAPTURE(bm_workload, mixed_logic_block,
+    Workload { { 0x21, 0x00, 0xC0, 0x31, 0xF0, 0xDF },
+        { 0x3E, 0x12, 0x80, 0xCB, 0x37, 0x77, 0x2C, 0xE6, 0x0F, 0x20, 0x00, 0xC5, 0xC1 }, 8 },
+    cocoa::gb::Sm83Dispatch::Block);
+
+#ifdef COCOA_JIT
+// Same as `mixed_logic`, but with hot blocks translated to native code for comparison.
+BENCHMARK_CAPTURE(bm_workload, mixed_logic_jit,
+    Workload { { 0x21, 0x00, 0xC0, 0x31, 0xF0, 0xDF },
+        { 0x3E, 0x12, 0x80, 0xCB, 0x37, 0x77, 0x2C, 0xE6, 0x0F, 0x20, 0x00, 0xC5, 0xC1 }, 8 },
+    cocoa::gb::Sm83Dispatch::Jit);
+#endif // COCOA_JIT
+
+/// @brief Load tight ALU loop at entry point of cartridge.
+///
+/// ```
+/// 0x0100: INC B
+/// 0x0101: DEC C
+/// 0x0102: LD A, B
+/// 0x0103: XOR C
+/// 0x0104: JP $0100
+/// ```
+static void
+load_alu_loop(cocoa::gb::MemoryBus& bus)
+{
+    constexpr uint8_t program[] = { 0x04, 0x0D, 0x78, 0xA9, 0xC3, 0x00, 0x01 };
+    uint16_t address = ENTRY_POINT;
+    for (uint8_t byte : program)
+        bus.write_byte(address++, byte);
+}
+
+static void
+bm_step(benchmark::State& state)
+{
+    cocoa::gb::MemoryBus bus {};
+    load_alu_loop(bus);
+    cocoa::gb::Sm83 cpu(std::make_shared<spdlog::logger>("bench"), bus);
+
+    for (auto _ : state) {
+        const size_t target = cpu.tstates() + SLICE_TSTATES;
+        while (cpu.tstates() < target)
+            cpu.step();
+    }
+
+    state.counters["tstates"] = benchmark::Counter(
+        static_cast<double>(cpu.tstates()), benchmark::Counter::kIsRate);
+}
+BENCHMARK(bm_step);
+
+static void
+bm_run_for(benchmark::State& state, const cocoa::gb::Sm83Dispatch dispatch)
+{
+    cocoa::gb::MemoryBus bus {};
+    std::vector<uint8_t> rom;
+    load_alu_loop(bus);
+    map_rom(bus, rom);
+    cocoa::gb::Sm83 cpu(std::make_shared<spdlog::logger>("bench"), bus);
+    cpu.set_dispatch(dispatch);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(cpu.run_for(SLICE_TSTATES));
+
+    state.counters["tstates"] = benchmark::Counter(
+        static_cast<double>(cpu.tstates()), benchmark::Counter::kIsRate);
+}
+BENCHMARK_CAPTURE(bm_run_for, table, cocoa::gb::Sm83Dispatch::Table);
+BENCHMARK_CAPTURE(bm_run_for, threaded, cocoa::gb::Sm83Dispatch::Threaded);
+BENCHMARK_CAPTURE(bm_run_for, block, cocoa::gb::Sm83Dispatch::Block);
+#ifdef COCOA_JIT
+BENCHMARK_CAPTURE(bm_run_for, jit, cocoa::gb::Sm83Dispatch::Jit);
+#endif // COCOA_JIT
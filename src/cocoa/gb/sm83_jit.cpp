@@ -0,0 +1,293 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <new>
+#include <vector>
+
+#include <sys/mman.h>
+
+#include "cocoa/gb/interrupt.hpp"
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/sm83.hpp"
+#include "cocoa/gb/sm83_jit.hpp"
+
+namespace cocoa::gb {
+// NOTE: Index into `Sm83State::regs` for each 3-bit register field of an opcode, with -1 for
+// [HL], which needs memory.
+static constexpr std::array<int, 8> REG_INDEX = {
+    Sm83State::B, Sm83State::C, Sm83State::D, Sm83State::E,
+    Sm83State::H, Sm83State::L, -1,           Sm83State::A,
+};
+
+// NOTE: x86-64 register fields for ModRM, and instruction bytes used by every block.
+constexpr uint8_t EAX = 0;
+constexpr uint8_t MODRM_RBX_DISP32 = 0x83;
+constexpr std::initializer_list<uint8_t> PROLOGUE = {
+    0x53,             // push rbx
+    0x41, 0x54,       // push r12
+    0x41, 0x55,       // push r13
+    0x48, 0x89, 0xFB, // mov rbx, rdi
+    0x41, 0x89, 0xF4, // mov r12d, esi
+    0x49, 0x89, 0xD5, // mov r13, rdx
+};
+constexpr std::initializer_list<uint8_t> EPILOGUE = {
+    0x41, 0x5D, // pop r13
+    0x41, 0x5C, // pop r12
+    0x5B,       // pop rbx
+    0xC3,       // ret
+};
+
+/// @brief Check if native code must leave its block.
+///
+/// Same as `Sm83::is_slice_over()`, plus remap check of `Sm83::run_blocks()`.
+static bool
+should_leave(const Sm83State& cpu, const unsigned page, const uint8_t* memory)
+{
+    return cpu.mode != Sm83Mode::Running || (cpu.ime && cpu.interrupts.pending() != 0)
+        || cpu.bus.read_only_page(static_cast<uint8_t>(page)) != memory;
+}
+
+/// @brief Get offset of field into CPU state.
+template <typename T>
+static size_t
+offset_of(const Sm83State& cpu, const T& field)
+{
+    return static_cast<size_t>(
+        reinterpret_cast<const uint8_t*>(&field) - reinterpret_cast<const uint8_t*>(&cpu));
+}
+
+Sm83Jit::Sm83Jit(const Sm83State& cpu)
+    : m_arena(nullptr)
+    , m_used(0)
+    , m_code()
+    , m_regs(offset_of(cpu, cpu.regs))
+    , m_mcycles(offset_of(cpu, cpu.mcycles))
+    , m_tstates(offset_of(cpu, cpu.tstates))
+    , m_sp(offset_of(cpu, cpu.sp))
+    , m_pc(offset_of(cpu, cpu.pc))
+{
+    // NOTE: Arena is only writable while a block is copied in, never writable and executable.
+    void* arena = ::mmap(
+        nullptr, JIT_ARENA_SIZE, PROT_READ | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (arena == MAP_FAILED)
+        throw std::bad_alloc();
+    m_arena = static_cast<uint8_t*>(arena);
+}
+
+Sm83Jit::~Sm83Jit() noexcept
+{
+    ::munmap(m_arena, JIT_ARENA_SIZE);
+}
+
+JitCode
+Sm83Jit::compile(const std::vector<JitOp>& ops)
+{
+    m_code.clear();
+    emit_bytes(PROLOGUE);
+
+    uint16_t pc = 0;
+    size_t mcycles = 0;
+    for (const JitOp& op : ops) {
+        if (emit_native(op, pc)) {
+            mcycles += op.mcycles;
+            continue;
+        }
+
+        // NOTE: Implementation reads immediates through PC, and effects may observe t-states.
+        pc = static_cast<uint16_t>(pc + op.fetch);
+        flush_pc(pc);
+        if (op.effects)
+            flush_cycles(mcycles);
+
+        emit_bytes({ 0x48, 0x89, 0xDF, 0x48, 0xB8 }); // mov rdi, rbx; mov rax, imm64
+        emit_imm(reinterpret_cast<uintptr_t>(op.execute), 8);
+        emit_bytes({ 0xFF, 0xD0 }); // call rax
+        mcycles += op.mcycles;
+        if (!op.effects)
+            continue;
+
+        flush_cycles(mcycles);
+        emit_bytes({ 0x48, 0x89, 0xDF }); // mov rdi, rbx
+        emit_bytes({ 0x44, 0x89, 0xE6 }); // mov esi, r12d
+        emit_bytes({ 0x4C, 0x89, 0xEA }); // mov rdx, r13
+        emit_bytes({ 0x48, 0xB8 });       // mov rax, imm64
+        emit_imm(reinterpret_cast<uintptr_t>(should_leave), 8);
+        emit_bytes({ 0xFF, 0xD0 });             // call rax
+        emit_bytes({ 0x84, 0xC0, 0x74, 0x06 }); // test al, al; jz past epilogue
+        emit_bytes(EPILOGUE);
+    }
+
+    flush_pc(pc);
+    flush_cycles(mcycles);
+    emit_bytes({ 0x31, 0xC0 }); // xor eax, eax
+    emit_bytes(EPILOGUE);
+
+    if (m_used + m_code.size() > JIT_ARENA_SIZE)
+        return nullptr;
+
+    if (::mprotect(m_arena, JIT_ARENA_SIZE, PROT_READ | PROT_WRITE) != 0)
+        throw std::bad_alloc();
+    uint8_t* code = m_arena + m_used;
+    std::memcpy(code, m_code.data(), m_code.size());
+    if (::mprotect(m_arena, JIT_ARENA_SIZE, PROT_READ | PROT_EXEC) != 0)
+        throw std::bad_alloc();
+
+    // NOTE: Keep blocks 16-byte aligned for instruction fetch.
+    m_used = (m_used + m_code.size() + 15) & ~size_t { 15 };
+    return reinterpret_cast<JitCode>(code);
+}
+
+void
+Sm83Jit::clear()
+{
+    m_used = 0;
+}
+
+size_t
+Sm83Jit::used() const
+{
+    return m_used;
+}
+
+bool
+Sm83Jit::emit_native(const JitOp& op, uint16_t& pc)
+{
+    if (op.prefixed)
+        return false;
+
+    // NOTE: Immediates are only read by instructions that have them, which all fit in their page.
+    const uint8_t opcode = op.bytes[0];
+    auto imm16 = [&op]() { return static_cast<uint16_t>(op.bytes[1] | (op.bytes[2] << 8)); };
+    const int dst = REG_INDEX[(opcode >> 3) & 0x07];
+    const int src = REG_INDEX[opcode & 0x07];
+
+    // NOP
+    if (opcode == 0x00) {
+        pc = static_cast<uint16_t>(pc + 1);
+        return true;
+    }
+
+    // LD r8, r8, apart from [HL] operands and HALT in their place.
+    if (opcode >= 0x40 && opcode < 0x80) {
+        if (dst < 0 || src < 0)
+            return false;
+        if (dst != src) {
+            emit_field({ 0x0F, 0xB6 }, EAX, m_regs + static_cast<size_t>(src)); // movzx eax, r8
+            emit_field({ 0x88 }, EAX, m_regs + static_cast<size_t>(dst));       // mov r8, al
+        }
+        pc = static_cast<uint16_t>(pc + 1);
+        return true;
+    }
+
+    // LD r8, n8
+    if ((opcode & 0xC7) == 0x06 && dst >= 0) {
+        emit_field({ 0xC6 }, 0, m_regs + static_cast<size_t>(dst)); // mov r8, imm8
+        emit_imm(op.bytes[1], 1);
+        pc = static_cast<uint16_t>(pc + 2);
+        return true;
+    }
+
+    // NOTE: Pairs are stored high register first, so pair BC, DE, or HL starts at B, D, or H.
+    const size_t pair = m_regs + static_cast<size_t>(Sm83State::B) + ((opcode >> 4) & 0x03) * 2;
+    const bool is_sp = (opcode & 0x30) == 0x30;
+
+    // LD r16, n16
+    if ((opcode & 0xCF) == 0x01) {
+        if (is_sp) {
+            emit_field({ 0x66, 0xC7 }, 0, m_sp); // mov sp, imm16
+            emit_imm(imm16(), 2);
+        } else {
+            emit_field({ 0xC6 }, 0, pair); // mov high, imm8
+            emit_imm(op.bytes[2], 1);
+            emit_field({ 0xC6 }, 0, pair + 1); // mov low, imm8
+            emit_imm(op.bytes[1], 1);
+        }
+        pc = static_cast<uint16_t>(pc + 3);
+        return true;
+    }
+
+    // INC r16 / DEC r16
+    if ((opcode & 0xC7) == 0x03) {
+        const bool dec = (opcode & 0x08) != 0;
+        if (is_sp) {
+            emit_field({ 0x66, 0xFF }, dec ? 1 : 0, m_sp); // inc sp / dec sp
+        } else {
+            // NOTE: Pair is big-endian, so it is swapped into and back out of host order.
+            const uint8_t step = dec ? 0xC8 : 0xC0;
+            emit_field({ 0x66, 0x8B }, EAX, pair);  // mov ax, pair
+            emit_bytes({ 0x66, 0xC1, 0xC0, 0x08 }); // rol ax, 8
+            emit_bytes({ 0x66, 0xFF, step });       // inc ax / dec ax
+            emit_bytes({ 0x66, 0xC1, 0xC0, 0x08 }); // rol ax, 8
+            emit_field({ 0x66, 0x89 }, EAX, pair);  // mov pair, ax
+        }
+        pc = static_cast<uint16_t>(pc + 1);
+        return true;
+    }
+
+    // JR e8, which lands relative to block, so it is folded into pending PC increment.
+    if (opcode == 0x18) {
+        pc = static_cast<uint16_t>(pc + 2 + static_cast<int8_t>(op.bytes[1]));
+        return true;
+    }
+
+    // JP n16
+    if (opcode == 0xC3) {
+        emit_field({ 0x66, 0xC7 }, 0, m_pc); // mov pc, imm16
+        emit_imm(imm16(), 2);
+        pc = 0;
+        return true;
+    }
+
+    return false;
+}
+
+void
+Sm83Jit::flush_pc(uint16_t& pc)
+{
+    if (pc == 0)
+        return;
+
+    emit_field({ 0x66, 0x81 }, 0, m_pc); // add pc, imm16
+    emit_imm(pc, 2);
+    pc = 0;
+}
+
+void
+Sm83Jit::flush_cycles(size_t& mcycles)
+{
+    if (mcycles == 0)
+        return;
+
+    emit_field({ 0x48, 0x81 }, 0, m_mcycles); // add mcycles, imm32
+    emit_imm(mcycles, 4);
+    emit_field({ 0x48, 0x81 }, 0, m_tstates); // add tstates, imm32
+    emit_imm(mcycles * TSTATES_PER_MCYCLE, 4);
+    mcycles = 0;
+}
+
+void
+Sm83Jit::emit_field(std::initializer_list<uint8_t> opcode, const uint8_t reg, const size_t offset)
+{
+    emit_bytes(opcode);
+    m_code.push_back(static_cast<uint8_t>(MODRM_RBX_DISP32 | (reg << 3)));
+    emit_imm(offset, 4);
+}
+
+void
+Sm83Jit::emit_bytes(std::initializer_list<uint8_t> bytes)
+{
+    m_code.insert(m_code.end(), bytes.begin(), bytes.end());
+}
+
+void
+Sm83Jit::emit_imm(const uint64_t value, const size_t size)
+{
+    for (size_t byte = 0; byte < size; ++byte)
+        m_code.push_back(static_cast<uint8_t>(value >> (byte * 8)));
+}
+} // namespace cocoa::gb
@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_GB_SM83_JIT_HPP
+#define COCOA_GB_SM83_JIT_HPP
+
+#if !defined(__x86_64__) || !(defined(__unix__) || defined(__APPLE__))
+#error "COCOA_JIT needs an x86-64 host with System V calling convention"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+namespace cocoa::gb {
+struct Sm83State;
+
+/// @brief Amount of times block is interpreted before it is translated to native code.
+constexpr uint32_t JIT_HOT_RUNS = 16;
+
+/// @brief Size of executable memory that each CPU translates blocks into.
+constexpr size_t JIT_ARENA_SIZE = 4 * 1024 * 1024;
+
+/// @brief Native code translated from one basic block.
+///
+/// Called with CPU state, along with bus page and host memory that block runs from.
+///
+/// @return True if block was left early, because its slice may be over or its page was remapped,
+///         false if it ran to its end.
+using JitCode = bool (*)(Sm83State& cpu, unsigned page, const uint8_t* memory);
+
+/// @brief One instruction of basic block to translate.
+struct JitOp final {
+    void (*execute)(Sm83State&);
+
+    /// Bytes of instruction in host memory, starting at its opcode or 0xCB prefix.
+    const uint8_t* bytes;
+    uint8_t mcycles;
+    uint8_t fetch;
+    bool prefixed;
+    bool effects;
+};
+
+/// @brief Translator of SM83 basic blocks to x86-64 code.
+///
+/// Instructions that only move data between registers, or only move PC, are emitted as native
+/// code working on CPU state in place. Every other instruction becomes a direct call to its
+/// implementation, so flags and memory accesses, which go through fast path of bus, behave
+/// exactly like the interpreter. PC and cycle counts are only written back before a call that
+/// needs them, and at block exits.
+///
+/// After each instruction with effects, native code leaves block if slice may be over or page
+/// was remapped, just like `Sm83Dispatch::Block`. Caller is expected to check slice state.
+///
+/// @warning Instruction implementations must not throw, since native code has no unwind info.
+class Sm83Jit final {
+public:
+    /// @brief Map executable memory for native code.
+    ///
+    /// @param [in] cpu CPU state that native code will run against, used for field offsets.
+    ///
+    /// @throws `std::bad_alloc` if executable memory cannot be mapped.
+    explicit Sm83Jit(const Sm83State& cpu);
+
+    Sm83Jit(const Sm83Jit&) = delete;
+
+    Sm83Jit&
+    operator=(const Sm83Jit&) = delete;
+
+    ~Sm83Jit() noexcept;
+
+    /// @brief Translate basic block to native code.
+    ///
+    /// @param [in] ops Instructions of block in order.
+    /// @return Native code, or null if arena is full and must be cleared first.
+    [[nodiscard]]
+    JitCode
+    compile(const std::vector<JitOp>& ops);
+
+    /// @brief Drop every piece of native code translated so far.
+    void
+    clear();
+
+    /// @brief Get amount of arena taken by native code.
+    [[nodiscard]]
+    size_t
+    used() const;
+
+private:
+    /// @brief Try to emit instruction as native code.
+    ///
+    /// @param [in] op Instruction to emit.
+    /// @param [in,out] pc Pending PC increment, updated past instruction.
+    /// @return True if emitted, false if instruction needs a call to its implementation.
+    bool
+    emit_native(const JitOp& op, uint16_t& pc);
+
+    /// @brief Emit write back of pending PC increment, then clear it.
+    void
+    flush_pc(uint16_t& pc);
+
+    /// @brief Emit write back of pending m-cycles, then clear them.
+    void
+    flush_cycles(size_t& mcycles);
+
+    /// @brief Emit instruction with 32-bit displacement off CPU state.
+    void
+    emit_field(std::initializer_list<uint8_t> opcode, const uint8_t reg, const size_t offset);
+
+    void
+    emit_bytes(std::initializer_list<uint8_t> bytes);
+
+    void
+    emit_imm(const uint64_t value, const size_t size);
+
+    uint8_t* m_arena;
+    size_t m_used;
+    std::vector<uint8_t> m_code;
+
+    /// Offsets of fields of `Sm83State`, which is not standard layout due to its bus reference.
+    size_t m_regs;
+    size_t m_mcycles;
+    size_t m_tstates;
+    size_t m_sp;
+    size_t m_pc;
+};
+} // namespace cocoa::gb
+
+#endif // COCOA_GB_SM83_JIT_HPP
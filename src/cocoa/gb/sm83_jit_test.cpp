@@ -0,0 +1,207 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/logger.h>
+
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/sm83.hpp"
+#include "cocoa/gb/sm83_jit.hpp"
+#include "cocoa/gb/sm83_test.hpp"
+
+/// @brief Differential mode that runs interpreter and JIT in lockstep.
+///
+/// Budget of each slice is drawn at random, so slices end before, inside, and right after blocks.
+/// CPU state of both is compared after every slice.
+static void
+run_lockstep(cocoa::gb::Sm83& interpreter, cocoa::gb::Sm83& jit, uint32_t lcg, size_t slices)
+{
+    interpreter.set_dispatch(cocoa::gb::Sm83Dispatch::Table);
+    jit.set_dispatch(cocoa::gb::Sm83Dispatch::Jit);
+    for (size_t slice = 0; slice < slices; ++slice) {
+        lcg = lcg * 1664525U + 1013904223U;
+        const size_t budget = 4 + (lcg >> 24);
+        REQUIRE(run_for_or_trap(interpreter, budget) == run_for_or_trap(jit, budget));
+        REQUIRE(interpreter.state().regs == jit.state().regs);
+        REQUIRE(interpreter.state().pc == jit.state().pc);
+        REQUIRE(interpreter.state().sp == jit.state().sp);
+        REQUIRE(interpreter.state().ime == jit.state().ime);
+        REQUIRE(interpreter.state().mode == jit.state().mode);
+        REQUIRE(interpreter.mcycles() == jit.mcycles());
+        REQUIRE(interpreter.tstates() == jit.tstates());
+    }
+}
+
+TEST_CASE("cocoa::gb::JitCode cocoa::gb::Sm83Jit::compile(const std::vector<JitOp>&)", "[compile]")
+{
+    // clang-format off
+    const std::vector<uint8_t> program = {
+        0x00,             // NOP
+        0x06, 0x12,       // LD B, 0x12
+        0x03,             // INC BC
+        0x78,             // LD A, B
+        0x31, 0xF0, 0xDF, // LD SP, 0xDFF0
+        0x3B,             // DEC SP
+        0x18, 0xFE,       // JR -2
+    };
+    // clang-format on
+    const std::vector<size_t> lengths = { 1, 2, 1, 1, 3, 1, 2 };
+    const std::vector<uint8_t> mcycles = { 1, 2, 2, 1, 3, 2, 3 };
+
+    std::vector<cocoa::gb::JitOp> ops;
+    size_t offset = 0;
+    for (size_t index = 0; index < lengths.size(); ++index) {
+        ops.push_back({ nullptr, program.data() + offset, mcycles[index], 1, false, false });
+        offset += lengths[index];
+    }
+
+    cocoa::gb::MemoryBus bus {};
+    cocoa::gb::Sm83State cpu(bus);
+    cocoa::gb::Sm83Jit jit(cpu);
+    const cocoa::gb::JitCode code = jit.compile(ops);
+    REQUIRE(code != nullptr);
+    REQUIRE(jit.used() > 0);
+
+    REQUIRE_FALSE(code(cpu, 0x01, nullptr));
+    REQUIRE(cpu.regs[cocoa::gb::Sm83State::B] == 0x12);
+    REQUIRE(cpu.regs[cocoa::gb::Sm83State::C] == 0x14);
+    REQUIRE(cpu.regs[cocoa::gb::Sm83State::A] == 0x12);
+    REQUIRE(cpu.sp == 0xDFEF);
+    REQUIRE(cpu.pc == 0x0109);
+    REQUIRE(cpu.mcycles == 14);
+    REQUIRE(cpu.tstates == 56);
+
+    jit.clear();
+    REQUIRE(jit.used() == 0);
+}
+
+TEST_CASE("void cocoa::gb::Sm83::set_dispatch(const Sm83Dispatch) with JIT", "[set_dispatch]")
+{
+    SECTION("Execute random code identically to interpreter")
+    {
+        for (uint32_t seed = 1; seed <= 32; ++seed) {
+            std::vector<uint8_t> rom(0x8000);
+            cocoa::gb::MemoryBus interpreter_bus {};
+            cocoa::gb::MemoryBus jit_bus {};
+            uint32_t lcg = seed;
+            for (size_t address = 0; address < 0x10000; ++address) {
+                lcg = lcg * 1664525U + 1013904223U;
+                const uint8_t byte = static_cast<uint8_t>(lcg >> 24);
+                if (address < rom.size())
+                    rom[address] = byte;
+                interpreter_bus.write_byte(static_cast<uint16_t>(address), byte);
+                jit_bus.write_byte(static_cast<uint16_t>(address), byte);
+            }
+            interpreter_bus.map_pages(0x0000, 0x7FFF, rom.data(), nullptr);
+            jit_bus.map_pages(0x0000, 0x7FFF, rom.data(), nullptr);
+
+            cocoa::gb::Sm83 interpreter(std::make_shared<spdlog::logger>("test"), interpreter_bus);
+            cocoa::gb::Sm83 jit(std::make_shared<spdlog::logger>("test"), jit_bus);
+            run_lockstep(interpreter, jit, seed, 512);
+
+            for (size_t address = 0; address < 0x10000; ++address) {
+                const uint16_t addr = static_cast<uint16_t>(address);
+                if (interpreter_bus.read_byte(addr) != jit_bus.read_byte(addr))
+                    FAIL("Memory differs at " << address << " with seed " << seed);
+            }
+        }
+    }
+
+    SECTION("Execute hot loop with interrupts identically to interpreter")
+    {
+        // clang-format off
+        const std::vector<uint8_t> program = {
+            0x01, 0x34, 0x12, // LD BC, 0x1234
+            0x21, 0x00, 0xC0, // LD HL, 0xC000
+            0x31, 0xF0, 0xDF, // LD SP, 0xDFF0
+            0x78,             // LD A, B
+            0x81,             // ADD A, C
+            0x22,             // LD [HL+], A
+            0x13,             // INC DE
+            0x0B,             // DEC BC
+            0x5A,             // LD E, D
+            0xC5,             // PUSH BC
+            0xD1,             // POP DE
+            0xCB, 0x11,       // RL C
+            0x26, 0xC0,       // LD H, 0xC0
+            0x20, 0xF2,       // JR NZ, -14
+            0x18, 0xF0,       // JR -16
+        };
+        // clang-format on
+        std::vector<uint8_t> rom(0x8000);
+        std::copy(program.begin(), program.end(), rom.begin() + 0x0100);
+        rom[0x0050] = 0xD9; // RETI
+
+        cocoa::gb::MemoryBus interpreter_bus {};
+        cocoa::gb::MemoryBus jit_bus {};
+        for (cocoa::gb::MemoryBus* bus : { &interpreter_bus, &jit_bus }) {
+            bus->map_pages(0x0000, 0x7FFF, rom.data(), nullptr);
+            bus->write_io_reg(cocoa::gb::IoMap::IE, 0x04);
+        }
+
+        cocoa::gb::Sm83 interpreter(std::make_shared<spdlog::logger>("test"), interpreter_bus);
+        cocoa::gb::Sm83 jit(std::make_shared<spdlog::logger>("test"), jit_bus);
+        for (uint32_t round = 1; round <= 64; ++round) {
+            run_lockstep(interpreter, jit, round, 64);
+            interpreter_bus.write_io_reg(cocoa::gb::IoMap::IF, 0x04);
+            jit_bus.write_io_reg(cocoa::gb::IoMap::IF, 0x04);
+        }
+
+#ifndef COCOA_TRACE
+        // NOTE: Tracing builds never translate, so every trace entry gets recorded.
+        REQUIRE(jit.jit_code_size() > 0);
+#endif // COCOA_TRACE
+        for (size_t address = 0xC000; address < 0xE000; ++address) {
+            const uint16_t addr = static_cast<uint16_t>(address);
+            REQUIRE(interpreter_bus.read_byte(addr) == jit_bus.read_byte(addr));
+        }
+    }
+
+    SECTION("Leave native code once bank of its page is switched")
+    {
+        // clang-format off
+        const std::vector<uint8_t> bank1 = {
+            0xEE, 0x03,       // XOR A, 3
+            0xEA, 0x00, 0x20, // LD [0x2000], A
+            0x04,             // INC B
+            0x18, 0xF7,       // JR -9
+        };
+        const std::vector<uint8_t> bank2 = {
+            0xEE, 0x03,       // XOR A, 3
+            0xEA, 0x00, 0x20, // LD [0x2000], A
+            0x0C,             // INC C
+            0x18, 0xF7,       // JR -9
+        };
+        // clang-format on
+        cocoa::gb::MemoryBus interpreter_bus {};
+        cocoa::gb::MemoryBus jit_bus {};
+        BankedRom interpreter_rom { interpreter_bus, std::vector<uint8_t>(0x10000) };
+        BankedRom jit_rom { jit_bus, std::vector<uint8_t>(0x10000) };
+        for (BankedRom* rom : { &interpreter_rom, &jit_rom }) {
+            rom->banks[0x0100] = 0xC3; // JP 0x4000
+            rom->banks[0x0102] = 0x40;
+            std::copy(bank1.begin(), bank1.end(), rom->banks.begin() + 0x4000);
+            std::copy(bank2.begin(), bank2.end(), rom->banks.begin() + 0x8000);
+            rom->bus.map_pages(0x0000, 0x3FFF, rom->banks.data(), nullptr);
+            rom->bus.map_pages(0x4000, 0x7FFF, rom->banks.data() + 0x4000, nullptr);
+            rom->bus.map_handler(0x2000, 0x3FFF, { nullptr, switch_bank, rom });
+        }
+
+        cocoa::gb::Sm83 interpreter(std::make_shared<spdlog::logger>("test"), interpreter_bus);
+        cocoa::gb::Sm83 jit(std::make_shared<spdlog::logger>("test"), jit_bus);
+        run_lockstep(interpreter, jit, 1, 1024);
+
+#ifndef COCOA_TRACE
+        // NOTE: Tracing builds never translate, so every trace entry gets recorded.
+        REQUIRE(jit.jit_code_size() > 0);
+#endif // COCOA_TRACE
+        REQUIRE(jit.state().regs[cocoa::gb::Sm83State::B] != 0x00);
+        REQUIRE(jit.state().regs[cocoa::gb::Sm83State::C] != 0x13);
+    }
+}
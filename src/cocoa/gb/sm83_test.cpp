@@ -1,13 +1,20 @@
 // SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
 // SPDX-License-Identifier: MIT
 
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <memory>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 #include <spdlog/logger.h>
 
 #include "cocoa/gb/memory.hpp"
 #include "cocoa/gb/sm83.hpp"
+#include "cocoa/gb/sm83_test.hpp"
 
 TEST_CASE("constexpr uint8_t cocoa::gb::Sm83State::load_reg8()", "[load_reg8]")
 {
@@ -288,3 +295,411 @@ TEST_CASE("constexpr bool cocoa::gb::Sm83State::is_condition_set()", "[is_condit
     REQUIRE(cpu.is_condition_set<cocoa::gb::Condition::Z>() == false);
     REQUIRE(cpu.is_condition_set<cocoa::gb::Condition::C>() == false);
 }
+
+TEST_CASE("constexpr void cocoa::gb::Sm83State::record_flags(const uint8_t, const uint8_t, "
+          "const uint8_t, const bool)",
+    "[record_flags]")
+{
+    cocoa::gb::MemoryBus bus;
+    cocoa::gb::Sm83State cpu(bus);
+    cpu.regs[cocoa::gb::Sm83State::RegIndex::F] = 0b01011010;
+
+    SECTION("Derive flags of addition")
+    {
+        cpu.record_flags<cocoa::gb::FlagOp::Add>(0x00, 0xF8, 0x08, true);
+        REQUIRE(cpu.load_flags() == 0b10111010);
+        cpu.record_flags<cocoa::gb::FlagOp::Add>(0x33, 0x11, 0x22);
+        REQUIRE(cpu.load_flags() == 0b00001010);
+    }
+
+    SECTION("Derive flags of subtraction")
+    {
+        cpu.record_flags<cocoa::gb::FlagOp::Sub>(0xFF, 0x00, 0x01, true);
+        REQUIRE(cpu.load_flags() == 0b01111010);
+        cpu.record_flags<cocoa::gb::FlagOp::Sub>(0x00, 0x42, 0x42);
+        REQUIRE(cpu.load_flags() == 0b11001010);
+    }
+
+    SECTION("Derive flags of logic operations")
+    {
+        cpu.record_flags<cocoa::gb::FlagOp::And>(0x00);
+        REQUIRE(cpu.load_flags() == 0b10101010);
+        cpu.record_flags<cocoa::gb::FlagOp::OrXor>(0x01);
+        REQUIRE(cpu.load_flags() == 0b00001010);
+    }
+
+    SECTION("Derive flags of increment, decrement, and shifts")
+    {
+        cpu.record_flags<cocoa::gb::FlagOp::Inc>(0x10, 0x0F, 1, true);
+        REQUIRE(cpu.load_flags() == 0b00111010);
+        cpu.record_flags<cocoa::gb::FlagOp::Dec>(0x00, 0x01, 1, false);
+        REQUIRE(cpu.load_flags() == 0b11001010);
+        cpu.record_flags<cocoa::gb::FlagOp::Shift>(0x80, 0, 0, true);
+        REQUIRE(cpu.load_flags() == 0b00011010);
+    }
+
+    SECTION("Fold pending flags into F register once materialized")
+    {
+        cpu.record_flags<cocoa::gb::FlagOp::Sub>(0x00, 0x42, 0x42);
+        REQUIRE(cpu.regs[cocoa::gb::Sm83State::RegIndex::F] == 0b01011010);
+        REQUIRE(cpu.is_flag_set<cocoa::gb::Flag::Z>() == true);
+        REQUIRE(cpu.is_condition_set<cocoa::gb::Condition::NC>() == true);
+        REQUIRE(cpu.load_reg16_stack<cocoa::gb::Reg16Stack::AF>() == 0x01CA);
+
+        cpu.set_flag<cocoa::gb::Flag::C>();
+        REQUIRE(cpu.flag_op == cocoa::gb::FlagOp::None);
+        REQUIRE(cpu.regs[cocoa::gb::Sm83State::RegIndex::F] == 0b11011010);
+
+        cpu.record_flags<cocoa::gb::FlagOp::And>(0x01);
+        cpu.materialize_flags();
+        REQUIRE(cpu.flag_op == cocoa::gb::FlagOp::None);
+        REQUIRE(cpu.regs[cocoa::gb::Sm83State::RegIndex::F] == 0b00101010);
+    }
+}
+
+TEST_CASE("const cocoa::gb::InstructionInfo& "
+          "cocoa::gb::instruction_info(const uint8_t, const bool)",
+    "[instruction_info]")
+{
+    constexpr uint8_t illegal[]
+        = { 0xD3, 0xDB, 0xDD, 0xE3, 0xE4, 0xEB, 0xEC, 0xED, 0xF4, 0xFC, 0xFD };
+
+    size_t illegal_count = 0;
+    for (size_t opcode = 0; opcode < 256; ++opcode) {
+        const auto& info = cocoa::gb::instruction_info(static_cast<uint8_t>(opcode), false);
+        if (info.mnemonic == "???")
+            ++illegal_count;
+        const auto& prefixed = cocoa::gb::instruction_info(static_cast<uint8_t>(opcode), true);
+        REQUIRE(!prefixed.mnemonic.empty());
+    }
+    REQUIRE(illegal_count == std::size(illegal));
+    for (uint8_t opcode : illegal)
+        REQUIRE(cocoa::gb::instruction_info(opcode, false).mnemonic == "???");
+
+    REQUIRE(cocoa::gb::instruction_info(0x01, false).mnemonic == "LD BC, n16");
+    REQUIRE(cocoa::gb::instruction_info(0x01, false).length == 3);
+    REQUIRE(cocoa::gb::instruction_info(0x10, false).mnemonic == "STOP");
+    REQUIRE(cocoa::gb::instruction_info(0x1F, false).mnemonic == "RRA");
+    REQUIRE(cocoa::gb::instruction_info(0x47, false).mnemonic == "LD B, A");
+    REQUIRE(cocoa::gb::instruction_info(0xDC, false).mnemonic.substr(0, 6) == "CALL C");
+    REQUIRE(cocoa::gb::instruction_info(0xFB, false).mnemonic == "EI");
+    REQUIRE(cocoa::gb::instruction_info(0xCB, false).mnemonic.empty());
+    REQUIRE(cocoa::gb::instruction_info(0x37, true).mnemonic == "SWAP A");
+    REQUIRE(cocoa::gb::instruction_info(0x37, true).length == 2);
+}
+
+TEST_CASE("void cocoa::gb::Sm83::step()", "[step]")
+{
+    constexpr uint8_t jr = 0x18;
+    constexpr uint8_t jr_z = 0x28;
+
+    cocoa::gb::MemoryBus bus {};
+    cocoa::gb::Sm83 cpu(std::make_shared<spdlog::logger>("test"), bus);
+
+    SECTION("Jump relative backwards across page boundary")
+    {
+        bus.write_byte(0x0100, jr);
+        bus.write_byte(0x0101, 0xF0);
+        cpu.step();
+        REQUIRE(cpu.state().pc == 0x00F2);
+        REQUIRE(cpu.tstates() == 12);
+    }
+
+    SECTION("Jump relative forwards across page boundary")
+    {
+        bus.write_byte(0x0100, jr);
+        bus.write_byte(0x0101, 0x7F);
+        cpu.step();
+        REQUIRE(cpu.state().pc == 0x0181);
+
+        bus.write_byte(0x0181, jr_z);
+        bus.write_byte(0x0182, 0x7F);
+        cpu.step();
+        REQUIRE(cpu.state().pc == 0x0202);
+    }
+
+    SECTION("Decode opcodes at their documented encoding")
+    {
+        // LD BC, $1234 / ADD HL, DE / DEC SP / RRA / EI / SBC A, $01 / ADD SP, -2 / RST $18
+        constexpr uint8_t program[]
+            = { 0x01, 0x34, 0x12, 0x19, 0x3B, 0x1F, 0xFB, 0xDE, 0x01, 0xE8, 0xFE, 0xDF };
+        uint16_t address = 0x0100;
+        for (uint8_t byte : program)
+            bus.write_byte(address++, byte);
+
+        cpu.step();
+        REQUIRE(cpu.state().regs[cocoa::gb::Sm83State::B] == 0x12);
+        REQUIRE(cpu.state().regs[cocoa::gb::Sm83State::C] == 0x34);
+        REQUIRE(cpu.tstates() == 12);
+
+        cpu.step();
+        REQUIRE(cpu.state().regs[cocoa::gb::Sm83State::H] == 0x02);
+        REQUIRE(cpu.state().regs[cocoa::gb::Sm83State::L] == 0x25);
+
+        cpu.step();
+        REQUIRE(cpu.state().sp == 0xFFFD);
+
+        cpu.step();
+        REQUIRE(cpu.state().regs[cocoa::gb::Sm83State::A] == 0x80);
+
+        cpu.step();
+        REQUIRE(cpu.state().ime == true);
+
+        cpu.step();
+        REQUIRE(cpu.state().pc == 0x0109);
+
+        const size_t before = cpu.tstates();
+        cpu.step();
+        REQUIRE(cpu.state().sp == 0xFFFB);
+        REQUIRE(cpu.tstates() - before == 16);
+
+        cpu.step();
+        REQUIRE(cpu.state().pc == 0x0018);
+    }
+
+    SECTION("Leave F register up to date after ALU instructions")
+    {
+        // LD A, $0F / ADD A, $01 / PUSH AF / POP BC / CP A, $10 / JR NZ, -2 / DEC A / DAA
+        constexpr uint8_t program[]
+            = { 0x3E, 0x0F, 0xC6, 0x01, 0xF5, 0xC1, 0xFE, 0x10, 0x20, 0xFE, 0x3D, 0x27 };
+        uint16_t address = 0x0100;
+        for (uint8_t byte : program)
+            bus.write_byte(address++, byte);
+
+        cpu.step();
+        cpu.step();
+        REQUIRE(cpu.state().regs[cocoa::gb::Sm83State::F] == 0x20);
+        cpu.step();
+        cpu.step();
+        REQUIRE(cpu.state().regs[cocoa::gb::Sm83State::C] == 0x20);
+
+        cpu.step();
+        REQUIRE(cpu.state().regs[cocoa::gb::Sm83State::F] == 0xC0);
+        cpu.step();
+        REQUIRE(cpu.state().pc == 0x010A);
+
+        cpu.step();
+        REQUIRE(cpu.state().regs[cocoa::gb::Sm83State::F] == 0x60);
+        cpu.step();
+        REQUIRE(cpu.state().regs[cocoa::gb::Sm83State::A] == 0x09);
+        REQUIRE(cpu.state().regs[cocoa::gb::Sm83State::F] == 0x40);
+    }
+}
+
+TEST_CASE("size_t cocoa::gb::Sm83::run_for(size_t)", "[run_for]")
+{
+    constexpr uint8_t halt = 0x76;
+
+    cocoa::gb::MemoryBus bus {};
+    cocoa::gb::Sm83 cpu(std::make_shared<spdlog::logger>("test"), bus);
+
+    REQUIRE(cpu.run_for(40) == 40);
+    REQUIRE(cpu.tstates() == 40);
+    REQUIRE(cpu.state().pc == 0x010A);
+
+    bus.write_byte(0x010C, halt);
+    REQUIRE(cpu.run_for(100) == 12);
+    REQUIRE(cpu.state().mode == cocoa::gb::Sm83Mode::Halted);
+    REQUIRE(cpu.run_for(100) == 100);
+    REQUIRE(cpu.state().pc == 0x010D);
+
+    bus.write_io_reg(cocoa::gb::IoMap::IE, 0x01);
+    bus.write_io_reg(cocoa::gb::IoMap::IF, 0x01);
+    REQUIRE(cpu.run_for(4) == 20);
+    REQUIRE(cpu.state().mode == cocoa::gb::Sm83Mode::Running);
+    REQUIRE(cpu.state().pc == 0x0040);
+    REQUIRE(cpu.state().ime == false);
+    REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::IF) == 0x00);
+}
+
+TEST_CASE("size_t cocoa::gb::Sm83::run_until(size_t, Predicate)", "[run_until]")
+{
+    cocoa::gb::MemoryBus bus {};
+    cocoa::gb::Sm83 cpu(std::make_shared<spdlog::logger>("test"), bus);
+
+    auto at_pc = [](const cocoa::gb::Sm83State& state) { return state.pc == 0x0104; };
+    REQUIRE(cpu.run_until(100, at_pc) == 16);
+    REQUIRE(cpu.state().pc == 0x0104);
+    REQUIRE(cpu.run_until(8, [](const cocoa::gb::Sm83State&) { return false; }) == 8);
+}
+
+TEST_CASE("void cocoa::gb::Sm83::set_dispatch(const Sm83Dispatch)", "[set_dispatch]")
+{
+    SECTION("Execute identically with either strategy")
+    {
+        // NOTE: PC stays past illegal opcodes, so random code can keep running after one.
+        for (uint32_t seed = 1; seed <= 32; ++seed) {
+            cocoa::gb::MemoryBus table_bus {};
+            cocoa::gb::MemoryBus threaded_bus {};
+            uint32_t lcg = seed;
+            for (size_t address = 0; address < 0x10000; ++address) {
+                lcg = lcg * 1664525U + 1013904223U;
+                const uint8_t byte = static_cast<uint8_t>(lcg >> 24);
+                table_bus.write_byte(static_cast<uint16_t>(address), byte);
+                threaded_bus.write_byte(static_cast<uint16_t>(address), byte);
+            }
+
+            cocoa::gb::Sm83 table(std::make_shared<spdlog::logger>("test"), table_bus);
+            cocoa::gb::Sm83 threaded(std::make_shared<spdlog::logger>("test"), threaded_bus);
+            table.set_dispatch(cocoa::gb::Sm83Dispatch::Table);
+            threaded.set_dispatch(cocoa::gb::Sm83Dispatch::Threaded);
+            REQUIRE(table.dispatch() == cocoa::gb::Sm83Dispatch::Table);
+            REQUIRE(threaded.dispatch() == cocoa::gb::Sm83Dispatch::Threaded);
+
+            for (size_t slice = 0; slice < 512; ++slice) {
+                REQUIRE(run_for_or_trap(table, 64) == run_for_or_trap(threaded, 64));
+                REQUIRE(table.state().regs == threaded.state().regs);
+                REQUIRE(table.state().pc == threaded.state().pc);
+                REQUIRE(table.state().sp == threaded.state().sp);
+                REQUIRE(table.state().ime == threaded.state().ime);
+                REQUIRE(table.state().mode == threaded.state().mode);
+                REQUIRE(table.tstates() == threaded.tstates());
+            }
+
+            for (size_t address = 0; address < 0x10000; ++address) {
+                const uint16_t addr = static_cast<uint16_t>(address);
+                if (table_bus.read_byte(addr) != threaded_bus.read_byte(addr))
+                    FAIL("Memory differs at " << address << " with seed " << seed);
+            }
+        }
+    }
+
+    SECTION("Execute identically from read-only memory through blocks")
+    {
+        for (uint32_t seed = 1; seed <= 32; ++seed) {
+            std::vector<uint8_t> rom(0x8000);
+            cocoa::gb::MemoryBus table_bus {};
+            cocoa::gb::MemoryBus block_bus {};
+            uint32_t lcg = seed;
+            for (size_t address = 0; address < 0x10000; ++address) {
+                lcg = lcg * 1664525U + 1013904223U;
+                const uint8_t byte = static_cast<uint8_t>(lcg >> 24);
+                if (address < rom.size())
+                    rom[address] = byte;
+                table_bus.write_byte(static_cast<uint16_t>(address), byte);
+                block_bus.write_byte(static_cast<uint16_t>(address), byte);
+            }
+            table_bus.map_pages(0x0000, 0x7FFF, rom.data(), nullptr);
+            block_bus.map_pages(0x0000, 0x7FFF, rom.data(), nullptr);
+
+            cocoa::gb::Sm83 table(std::make_shared<spdlog::logger>("test"), table_bus);
+            cocoa::gb::Sm83 block(std::make_shared<spdlog::logger>("test"), block_bus);
+            block.set_dispatch(cocoa::gb::Sm83Dispatch::Block);
+            REQUIRE(block.dispatch() == cocoa::gb::Sm83Dispatch::Block);
+
+            for (size_t slice = 0; slice < 512; ++slice) {
+                REQUIRE(run_for_or_trap(table, 64) == run_for_or_trap(block, 64));
+                REQUIRE(table.state().regs == block.state().regs);
+                REQUIRE(table.state().pc == block.state().pc);
+                REQUIRE(table.state().sp == block.state().sp);
+                REQUIRE(table.state().ime == block.state().ime);
+                REQUIRE(table.state().mode == block.state().mode);
+                REQUIRE(table.tstates() == block.tstates());
+            }
+
+            for (size_t address = 0; address < 0x10000; ++address) {
+                const uint16_t addr = static_cast<uint16_t>(address);
+                if (table_bus.read_byte(addr) != block_bus.read_byte(addr))
+                    FAIL("Memory differs at " << address << " with seed " << seed);
+            }
+        }
+    }
+
+    SECTION("Leave block once bank of its page is switched, and decode again once flushed")
+    {
+        cocoa::gb::MemoryBus bus {};
+        BankedRom rom { bus, std::vector<uint8_t>(0x10000) };
+        // clang-format off
+        const std::vector<uint8_t> bank1 = {
+            0x3E, 0x02,       // LD A, 2
+            0xEA, 0x00, 0x20, // LD [0x2000], A
+            0x04,             // INC B
+            0x18, 0xFE,       // JR -2
+        };
+        const std::vector<uint8_t> bank2 = {
+            0x0C,             // INC C
+            0x18, 0xFE,       // JR -2
+        };
+        // clang-format on
+        rom.banks[0x0100] = 0xC3; // JP 0x4000
+        rom.banks[0x0102] = 0x40;
+        std::copy(bank1.begin(), bank1.end(), rom.banks.begin() + 0x4000);
+        std::copy(bank2.begin(), bank2.end(), rom.banks.begin() + 0x8005);
+        bus.map_pages(0x0000, 0x3FFF, rom.banks.data(), nullptr);
+        bus.map_pages(0x4000, 0x7FFF, rom.banks.data() + 0x4000, nullptr);
+        bus.map_handler(0x2000, 0x3FFF, { nullptr, switch_bank, &rom });
+
+        cocoa::gb::Sm83 cpu(std::make_shared<spdlog::logger>("test"), bus);
+        cpu.set_dispatch(cocoa::gb::Sm83Dispatch::Block);
+        cocoa::gb::Sm83Snapshot start {};
+        cpu.save_state(start);
+        cpu.run_for(128);
+        REQUIRE(cpu.state().regs[cocoa::gb::Sm83State::B] == 0x00);
+        REQUIRE(cpu.state().regs[cocoa::gb::Sm83State::C] == 0x14);
+        REQUIRE(cpu.state().pc == 0x4006);
+
+        rom.banks[0x8005] = 0x00; // NOP
+        bus.map_pages(0x4000, 0x7FFF, rom.banks.data() + 0x4000, nullptr);
+        cpu.flush_blocks();
+        cpu.load_state(start);
+        cpu.run_for(128);
+        REQUIRE(cpu.state().regs[cocoa::gb::Sm83State::C] == 0x13);
+    }
+
+    SECTION("End blocks in front of breakpoints, so they are only checked at block entry")
+    {
+        std::vector<uint8_t> rom(0x8000);
+        // clang-format off
+        const std::vector<uint8_t> program = {
+            0x04,       // INC B
+            0x0C,       // INC C
+            0x14,       // INC D
+            0x18, 0xFB, // JR -5
+        };
+        // clang-format on
+        std::copy(program.begin(), program.end(), rom.begin() + 0x0100);
+        cocoa::gb::MemoryBus bus {};
+        bus.map_pages(0x0000, 0x7FFF, rom.data(), nullptr);
+
+        cocoa::gb::Sm83 cpu(std::make_shared<spdlog::logger>("test"), bus);
+        cpu.set_dispatch(cocoa::gb::Sm83Dispatch::Block);
+        cpu.run_for(64);
+
+        std::bitset<cocoa::gb::MEMORY_BUS_SIZE> breakpoints;
+        breakpoints.set(0x0102);
+        cpu.set_breakpoints(&breakpoints);
+        auto at_breakpoint = [&breakpoints](const cocoa::gb::Sm83State& state) {
+            return breakpoints[state.pc];
+        };
+        cpu.run_until(72, cocoa::gb::block_predicate(at_breakpoint));
+        REQUIRE(cpu.state().pc == 0x0102);
+        cpu.set_breakpoints(nullptr);
+    }
+
+    SECTION("Throw on illegal opcode with either strategy")
+    {
+        cocoa::gb::MemoryBus bus {};
+        cocoa::gb::Sm83 cpu(std::make_shared<spdlog::logger>("test"), bus);
+        bus.write_byte(0x0100, 0xD3);
+        bus.write_byte(0x0101, 0xD3);
+        bus.write_byte(0x0102, 0xD3);
+        cpu.set_dispatch(cocoa::gb::Sm83Dispatch::Table);
+        REQUIRE_THROWS_AS(cpu.step(), cocoa::gb::IllegalOpcode);
+        cpu.set_dispatch(cocoa::gb::Sm83Dispatch::Threaded);
+        REQUIRE_THROWS_AS(cpu.run_for(4), cocoa::gb::IllegalOpcode);
+        cpu.set_dispatch(cocoa::gb::Sm83Dispatch::Block);
+        REQUIRE_THROWS_AS(cpu.run_for(4), cocoa::gb::IllegalOpcode);
+    }
+}
+
+#ifdef COCOA_TRACE
+TEST_CASE("size_t cocoa::gb::Sm83::drain_trace()", "[drain_trace]")
+{
+    cocoa::gb::MemoryBus bus {};
+    cocoa::gb::Sm83 cpu(std::make_shared<spdlog::logger>("test"), bus);
+
+    REQUIRE(cpu.run_for(16) == 16);
+    REQUIRE(cpu.drain_trace() == 4);
+    REQUIRE(cpu.drain_trace() == 0);
+}
+#endif // COCOA_TRACE
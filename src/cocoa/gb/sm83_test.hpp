@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_GB_SM83_TEST_HPP
+#define COCOA_GB_SM83_TEST_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/sm83.hpp"
+
+/// @brief Run CPU for given budget, treating illegal opcodes as a result rather than an error.
+///
+/// @return True if an illegal opcode was hit, false otherwise.
+inline bool
+run_for_or_trap(cocoa::gb::Sm83& cpu, const size_t tstates)
+{
+    try {
+        cpu.run_for(tstates);
+    } catch (const cocoa::gb::IllegalOpcode&) {
+        return true;
+    }
+    return false;
+}
+
+/// @brief Banked ROM whose bank is switched by any write to 0x2000-0x3FFF.
+struct BankedRom final {
+    cocoa::gb::MemoryBus& bus;
+    std::vector<uint8_t> banks;
+};
+
+inline void
+switch_bank(void* context, uint16_t, uint8_t value)
+{
+    BankedRom* rom = static_cast<BankedRom*>(context);
+    rom->bus.map_pages(0x4000, 0x7FFF, rom->banks.data() + value * 0x4000, nullptr);
+}
+
+#endif // COCOA_GB_SM83_TEST_HPP
@@ -0,0 +1,281 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#define COCOA_HAS_MMAP 1
+#endif
+
+#include <fmt/format.h>
+
+#include "cocoa/gb/snapshot.hpp"
+#include "cocoa/utility.hpp"
+
+namespace cocoa::gb {
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__,
+    "Snapshot sections are raw little-endian images of host structs");
+#endif
+
+static_assert(sizeof(SnapshotHeader) == 24 + 16 * SNAPSHOT_SECTION_COUNT);
+
+// NOTE: Source of padding between sections.
+static constexpr std::array<uint8_t, SNAPSHOT_ALIGNMENT> PADDING = {};
+
+static constexpr size_t
+align_up(const size_t offset)
+{
+    return (offset + SNAPSHOT_ALIGNMENT - 1) & ~(SNAPSHOT_ALIGNMENT - 1);
+}
+
+/// @brief Order sections by table index and compute their offsets.
+///
+/// @throws `SnapshotError` if a section is missing or given twice.
+static SnapshotHeader
+layout(const std::array<SnapshotChunk, SNAPSHOT_SECTION_COUNT>& chunks,
+    std::array<const SnapshotChunk*, SNAPSHOT_SECTION_COUNT>& ordered)
+{
+    ordered = {};
+    for (const SnapshotChunk& chunk : chunks) {
+        const size_t index = from_enum(chunk.section);
+        if (index >= SNAPSHOT_SECTION_COUNT || ordered[index] != nullptr)
+            throw SnapshotError(fmt::format("Snapshot section {0} is invalid", index));
+        ordered[index] = &chunk;
+    }
+
+    SnapshotHeader header = {};
+    header.magic = SNAPSHOT_MAGIC;
+    header.version = SNAPSHOT_VERSION;
+    header.section_count = SNAPSHOT_SECTION_COUNT;
+    size_t offset = align_up(sizeof(SnapshotHeader));
+    for (size_t i = 0; i < SNAPSHOT_SECTION_COUNT; ++i) {
+        header.sections[i] = { offset, ordered[i]->size };
+        offset = align_up(offset + ordered[i]->size);
+    }
+    header.size = offset;
+    return header;
+}
+
+void
+write_snapshot(const std::filesystem::path& path,
+    const std::array<SnapshotChunk, SNAPSHOT_SECTION_COUNT>& chunks)
+{
+    std::array<const SnapshotChunk*, SNAPSHOT_SECTION_COUNT> ordered = {};
+    const SnapshotHeader header = layout(chunks, ordered);
+
+    const std::filesystem::path staging = path.string() + ".tmp";
+#ifdef COCOA_HAS_MMAP
+    // INVARIANT: Every section is preceded by padding up to its offset, hence two entries each.
+    std::array<struct iovec, 2 * SNAPSHOT_SECTION_COUNT + 2> iov = {};
+    size_t count = 0;
+    size_t written = 0;
+    auto push = [&](const void* data, const size_t size) {
+        if (size == 0)
+            return;
+        iov[count++] = { const_cast<void*>(data), size };
+        written += size;
+    };
+
+    push(&header, sizeof(header));
+    for (size_t i = 0; i < SNAPSHOT_SECTION_COUNT; ++i) {
+        push(PADDING.data(), header.sections[i].offset - written);
+        push(ordered[i]->data, ordered[i]->size);
+    }
+    push(PADDING.data(), header.size - written);
+
+    int fd = ::open(staging.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0)
+        throw SnapshotError(fmt::format("Cannot create snapshot '{0}'", staging.string()));
+
+    const ssize_t result = ::writev(fd, iov.data(), static_cast<int>(count));
+    const bool failed = ::close(fd) != 0 || result < 0 || static_cast<size_t>(result) != written;
+    if (failed) {
+        ::unlink(staging.c_str());
+        throw SnapshotError(fmt::format("Cannot write snapshot '{0}'", staging.string()));
+    }
+#else
+    {
+        std::ofstream file(staging, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        size_t written = sizeof(header);
+        for (size_t i = 0; i < SNAPSHOT_SECTION_COUNT; ++i) {
+            const size_t padding = header.sections[i].offset - written;
+            file.write(reinterpret_cast<const char*>(PADDING.data()),
+                static_cast<std::streamsize>(padding));
+            file.write(static_cast<const char*>(ordered[i]->data),
+                static_cast<std::streamsize>(ordered[i]->size));
+            written += padding + ordered[i]->size;
+        }
+        file.write(reinterpret_cast<const char*>(PADDING.data()),
+            static_cast<std::streamsize>(header.size - written));
+        if (!file)
+            throw SnapshotError(fmt::format("Cannot write snapshot '{0}'", staging.string()));
+    }
+#endif // COCOA_HAS_MMAP
+
+    std::error_code error;
+    std::filesystem::rename(staging, path, error);
+    if (error)
+        throw SnapshotError(fmt::format("Cannot replace snapshot '{0}'", path.string()));
+}
+
+void
+pack_snapshot(const std::array<SnapshotChunk, SNAPSHOT_SECTION_COUNT>& chunks,
+    std::vector<uint8_t>& out)
+{
+    std::array<const SnapshotChunk*, SNAPSHOT_SECTION_COUNT> ordered = {};
+    const SnapshotHeader header = layout(chunks, ordered);
+
+    // NOTE: Padding is zeroed once on resize and never written afterwards.
+    if (out.size() != header.size)
+        out.assign(header.size, 0);
+    std::memcpy(out.data(), &header, sizeof(header));
+    for (size_t i = 0; i < SNAPSHOT_SECTION_COUNT; ++i) {
+        if (ordered[i]->size != 0) {
+            std::memcpy(
+                out.data() + header.sections[i].offset, ordered[i]->data, ordered[i]->size);
+        }
+    }
+}
+
+SnapshotFile::SnapshotFile(const std::filesystem::path& path)
+    : m_data(nullptr)
+    , m_size(0)
+    , m_header {}
+    , m_fallback()
+    , m_mapped(false)
+{
+#ifdef COCOA_HAS_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        throw SnapshotError(fmt::format("Cannot open snapshot '{0}'", path.string()));
+
+    struct stat info = {};
+    if (::fstat(fd, &info) != 0 || info.st_size < 0) {
+        ::close(fd);
+        throw SnapshotError(fmt::format("Cannot stat snapshot '{0}'", path.string()));
+    }
+
+    m_size = static_cast<size_t>(info.st_size);
+    if (m_size >= sizeof(SnapshotHeader)) {
+        void* mapping = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            ::close(fd);
+            throw SnapshotError(fmt::format("Cannot map snapshot '{0}'", path.string()));
+        }
+        m_data = static_cast<const uint8_t*>(mapping);
+        m_mapped = true;
+    }
+    ::close(fd);
+#else
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        throw SnapshotError(fmt::format("Cannot open snapshot '{0}'", path.string()));
+    m_fallback.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    m_data = m_fallback.data();
+    m_size = m_fallback.size();
+#endif // COCOA_HAS_MMAP
+
+    try {
+        validate(path.string());
+    } catch (...) {
+        release();
+        throw;
+    }
+}
+
+SnapshotFile::SnapshotFile(const uint8_t* data, const size_t size)
+    : m_data(data)
+    , m_size(size)
+    , m_header {}
+    , m_fallback()
+    , m_mapped(false)
+{
+    validate("<memory>");
+}
+
+SnapshotFile::~SnapshotFile() noexcept
+{
+    release();
+}
+
+const uint8_t*
+SnapshotFile::data(const SnapshotSection section) const
+{
+    return m_data + m_header.sections[from_enum(section)].offset;
+}
+
+size_t
+SnapshotFile::size(const SnapshotSection section) const
+{
+    return m_header.sections[from_enum(section)].size;
+}
+
+void
+SnapshotFile::expect_size(const SnapshotSection section, const size_t size) const
+{
+    if (this->size(section) != size) {
+        throw SnapshotError(fmt::format("Snapshot section {0} holds {1} bytes, expected {2}",
+            from_enum(section), this->size(section), size));
+    }
+}
+
+void
+SnapshotFile::validate(const std::string& name)
+{
+    if (m_size < sizeof(SnapshotHeader))
+        throw SnapshotError(fmt::format("Snapshot '{0}' is truncated", name));
+
+    std::memcpy(&m_header, m_data, sizeof(SnapshotHeader));
+    if (m_header.magic != SNAPSHOT_MAGIC)
+        throw SnapshotError(fmt::format("'{0}' is not a snapshot", name));
+    if (m_header.version != SNAPSHOT_VERSION) {
+        throw SnapshotError(fmt::format("Snapshot '{0}' has version {1}, expected {2}", name,
+            m_header.version, SNAPSHOT_VERSION));
+    }
+    if (m_header.section_count != SNAPSHOT_SECTION_COUNT || m_header.size != m_size)
+        throw SnapshotError(fmt::format("Snapshot '{0}' is malformed", name));
+
+    for (const SnapshotEntry& entry : m_header.sections) {
+        if (entry.offset % SNAPSHOT_ALIGNMENT != 0 || entry.offset > m_size
+            || entry.size > m_size - entry.offset)
+            throw SnapshotError(fmt::format("Snapshot '{0}' is malformed", name));
+    }
+}
+
+void
+SnapshotFile::release() noexcept
+{
+#ifdef COCOA_HAS_MMAP
+    if (m_mapped)
+        ::munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif // COCOA_HAS_MMAP
+    m_mapped = false;
+}
+
+SnapshotError::SnapshotError(std::string message)
+    : m_message(message)
+{
+}
+
+const char*
+SnapshotError::what() const noexcept
+{
+    return m_message.c_str();
+}
+} // namespace cocoa::gb
@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_GB_SNAPSHOT_HPP
+#define COCOA_GB_SNAPSHOT_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace cocoa::gb {
+/// @brief Version of snapshot layout.
+///
+/// @invariant Must be bumped whenever layout of header or any section changes.
+constexpr uint32_t SNAPSHOT_VERSION = 4;
+
+/// @brief Magic bytes identifying snapshot files.
+constexpr std::array<char, 8> SNAPSHOT_MAGIC = { 'C', 'O', 'C', 'O', 'A', 'S', 'A', 'V' };
+
+/// @brief Alignment of every section inside snapshot file.
+///
+/// Sections of a mapped snapshot can thus be read in place without unaligned access.
+constexpr size_t SNAPSHOT_ALIGNMENT = 64;
+
+/// @brief Sections of snapshot file.
+///
+/// Values index section table of snapshot header.
+enum class SnapshotSection : uint32_t {
+    System = 0,
+    Cpu = 1,
+    Bus = 2,
+    Ppu = 3,
+    Timer = 4,
+    Scheduler = 5,
+    Mapper = 6,
+    MapperRam = 7,
+    Apu = 8,
+    Dma = 9,
+};
+
+/// @brief Amount of sections in snapshot file.
+constexpr size_t SNAPSHOT_SECTION_COUNT = 10;
+
+/// @brief Location of one section inside snapshot file.
+struct SnapshotEntry final {
+    uint64_t offset;
+    uint64_t size;
+};
+
+/// @brief Header at start of snapshot file.
+///
+/// Snapshot files are little-endian throughout. Header is followed by every section in table
+/// order, each starting at a multiple of `SNAPSHOT_ALIGNMENT`. Sections are raw images of plain
+/// structs with fixed-width fields, so restoring one is a bounds check plus a `memcpy`.
+struct SnapshotHeader final {
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t section_count;
+    uint64_t size;
+    std::array<SnapshotEntry, SNAPSHOT_SECTION_COUNT> sections;
+};
+
+/// @brief Contiguous piece of state stored as one section.
+struct SnapshotChunk final {
+    SnapshotSection section;
+    const void* data;
+    size_t size;
+};
+
+/// @brief Write snapshot file.
+///
+/// Header, sections, and padding between them go out through one gathered write straight from
+/// where they live in memory, so no staging buffer is built. File is written beside target
+/// first, then renamed over it, so an interrupted save never clobbers an older snapshot.
+///
+/// @param [in] path Path to snapshot file.
+/// @param [in] chunks Every section, in any order.
+///
+/// @throws `SnapshotError` if a section is missing, or file cannot be written.
+void
+write_snapshot(const std::filesystem::path& path,
+    const std::array<SnapshotChunk, SNAPSHOT_SECTION_COUNT>& chunks);
+
+/// @brief Pack snapshot into memory with exactly the same layout as a snapshot file.
+///
+/// Buffer is only resized when layout changes, so packing into the same buffer repeatedly does
+/// not allocate.
+///
+/// @param [in] chunks Every section, in any order.
+/// @param [out] out Buffer to pack into.
+///
+/// @throws `SnapshotError` if a section is missing.
+void
+pack_snapshot(const std::array<SnapshotChunk, SNAPSHOT_SECTION_COUNT>& chunks,
+    std::vector<uint8_t>& out);
+
+/// @brief Read-only view of snapshot file.
+///
+/// File is memory mapped where available, so only sections actually restored get paged in.
+/// Snapshots packed into memory can be viewed the same way.
+class SnapshotFile final {
+public:
+    /// @brief Open snapshot file and validate its header.
+    ///
+    /// @param [in] path Path to snapshot file.
+    ///
+    /// @throws `SnapshotError` if file cannot be read, is not a snapshot, has another version, or
+    ///         has a section table pointing outside of file.
+    explicit SnapshotFile(const std::filesystem::path& path);
+
+    /// @brief View snapshot packed into memory and validate its header.
+    ///
+    /// @param [in] data Start of packed snapshot, which must outlive view.
+    /// @param [in] size Size of packed snapshot in bytes.
+    ///
+    /// @throws `SnapshotError` if data is not a snapshot, has another version, or has a section
+    ///         table pointing outside of data.
+    SnapshotFile(const uint8_t* data, const size_t size);
+
+    SnapshotFile(const SnapshotFile&) = delete;
+
+    SnapshotFile&
+    operator=(const SnapshotFile&) = delete;
+
+    ~SnapshotFile() noexcept;
+
+    /// @brief Get start of section.
+    [[nodiscard]]
+    const uint8_t*
+    data(const SnapshotSection section) const;
+
+    /// @brief Get size of section in bytes.
+    [[nodiscard]]
+    size_t
+    size(const SnapshotSection section) const;
+
+    /// @brief Check that section holds exactly given amount of bytes.
+    ///
+    /// @throws `SnapshotError` if section size differs.
+    void
+    expect_size(const SnapshotSection section, const size_t size) const;
+
+    /// @brief Copy section into plain struct.
+    ///
+    /// @throws `SnapshotError` if section size differs from size of struct.
+    template <typename T>
+    void
+    read(const SnapshotSection section, T& out) const;
+
+private:
+    /// @brief Validate header against size of data.
+    ///
+    /// @param [in] name Name of snapshot used in error messages.
+    ///
+    /// @throws `SnapshotError` if header is invalid.
+    void
+    validate(const std::string& name);
+
+    void
+    release() noexcept;
+
+    const uint8_t* m_data;
+    size_t m_size;
+    SnapshotHeader m_header;
+    std::vector<uint8_t> m_fallback;
+    bool m_mapped;
+};
+
+class SnapshotError final : public std::exception {
+public:
+    explicit SnapshotError(std::string message);
+
+    const char*
+    what() const noexcept;
+
+private:
+    std::string m_message;
+};
+} // namespace cocoa::gb
+
+#include "cocoa/gb/snapshot.tpp"
+
+#endif // COCOA_GB_SNAPSHOT_HPP
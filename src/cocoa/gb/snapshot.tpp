@@ -0,0 +1,21 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_GB_SNAPSHOT_TPP
+#define COCOA_GB_SNAPSHOT_TPP
+
+#include <cstring>
+#include <type_traits>
+
+namespace cocoa::gb {
+template <typename T>
+void
+SnapshotFile::read(const SnapshotSection section, T& out) const
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Sections must be plain structs");
+    expect_size(section, sizeof(T));
+    std::memcpy(&out, data(section), sizeof(T));
+}
+} // namespace cocoa::gb
+
+#endif // COCOA_GB_SNAPSHOT_TPP
@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "cocoa/gb/snapshot.hpp"
+#include "cocoa/utility.hpp"
+
+/// @brief Write snapshot whose sections hold distinct byte patterns of growing size.
+static std::filesystem::path
+write_patterns(const char* name, std::vector<std::vector<uint8_t>>& sections)
+{
+    std::array<cocoa::gb::SnapshotChunk, cocoa::gb::SNAPSHOT_SECTION_COUNT> chunks = {};
+    sections.resize(cocoa::gb::SNAPSHOT_SECTION_COUNT);
+    for (size_t i = 0; i < cocoa::gb::SNAPSHOT_SECTION_COUNT; ++i) {
+        sections[i].assign(i * 37, static_cast<uint8_t>(0xA0 + i));
+        const size_t reversed = cocoa::gb::SNAPSHOT_SECTION_COUNT - 1 - i;
+        chunks[reversed] = { static_cast<cocoa::gb::SnapshotSection>(i), sections[i].data(),
+            sections[i].size() };
+    }
+
+    std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    cocoa::gb::write_snapshot(path, chunks);
+    return path;
+}
+
+/// @brief Overwrite bytes of file in place.
+static void
+patch(const std::filesystem::path& path, const size_t offset, const void* data, const size_t size)
+{
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(static_cast<std::streamoff>(offset));
+    file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+}
+
+TEST_CASE("void cocoa::gb::write_snapshot(const std::filesystem::path&, "
+          "const std::array<SnapshotChunk, SNAPSHOT_SECTION_COUNT>&)",
+    "[write_snapshot]")
+{
+    std::vector<std::vector<uint8_t>> sections;
+    std::filesystem::path path = write_patterns("cocoa_snapshot_write.sav", sections);
+
+    SECTION("Lay out aligned sections in table order")
+    {
+        cocoa::gb::SnapshotFile file(path);
+        for (size_t i = 0; i < cocoa::gb::SNAPSHOT_SECTION_COUNT; ++i) {
+            const auto section = static_cast<cocoa::gb::SnapshotSection>(i);
+            REQUIRE(file.size(section) == sections[i].size());
+            REQUIRE(reinterpret_cast<uintptr_t>(file.data(section))
+                    % cocoa::gb::SNAPSHOT_ALIGNMENT
+                == 0);
+            REQUIRE(std::equal(sections[i].begin(), sections[i].end(), file.data(section)));
+        }
+        REQUIRE(!std::filesystem::exists(path.string() + ".tmp"));
+    }
+
+    SECTION("Reject duplicate section")
+    {
+        std::array<cocoa::gb::SnapshotChunk, cocoa::gb::SNAPSHOT_SECTION_COUNT> chunks = {};
+        REQUIRE_THROWS_AS(cocoa::gb::write_snapshot(path, chunks), cocoa::gb::SnapshotError);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("cocoa::gb::SnapshotFile::SnapshotFile(const std::filesystem::path&)", "[snapshot]")
+{
+    std::vector<std::vector<uint8_t>> sections;
+    std::filesystem::path path = write_patterns("cocoa_snapshot_read.sav", sections);
+
+    SECTION("Read section into plain struct")
+    {
+        cocoa::gb::SnapshotFile file(path);
+        std::array<uint8_t, 37> out = {};
+        file.read(cocoa::gb::SnapshotSection::Cpu, out);
+        REQUIRE(out[0] == 0xA1);
+        REQUIRE(out[36] == 0xA1);
+
+        uint32_t wrong = 0;
+        REQUIRE_THROWS_AS(
+            file.read(cocoa::gb::SnapshotSection::Cpu, wrong), cocoa::gb::SnapshotError);
+    }
+
+    SECTION("Reject bad magic")
+    {
+        patch(path, 0, "COCOAROM", 8);
+        REQUIRE_THROWS_AS(cocoa::gb::SnapshotFile(path), cocoa::gb::SnapshotError);
+    }
+
+    SECTION("Reject other version")
+    {
+        const uint32_t version = cocoa::gb::SNAPSHOT_VERSION + 1;
+        patch(path, offsetof(cocoa::gb::SnapshotHeader, version), &version, sizeof(version));
+        REQUIRE_THROWS_AS(cocoa::gb::SnapshotFile(path), cocoa::gb::SnapshotError);
+    }
+
+    SECTION("Reject section outside of file")
+    {
+        const uint64_t size = 1 << 20;
+        const size_t offset = offsetof(cocoa::gb::SnapshotHeader, sections)
+            + cocoa::gb::SNAPSHOT_SECTION_COUNT * sizeof(cocoa::gb::SnapshotEntry) - sizeof(size);
+        patch(path, offset, &size, sizeof(size));
+        REQUIRE_THROWS_AS(cocoa::gb::SnapshotFile(path), cocoa::gb::SnapshotError);
+    }
+
+    SECTION("Reject truncated file")
+    {
+        std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+        REQUIRE_THROWS_AS(cocoa::gb::SnapshotFile(path), cocoa::gb::SnapshotError);
+        std::filesystem::resize_file(path, 16);
+        REQUIRE_THROWS_AS(cocoa::gb::SnapshotFile(path), cocoa::gb::SnapshotError);
+    }
+
+    std::filesystem::remove(path);
+}
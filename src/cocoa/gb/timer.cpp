@@ -0,0 +1,221 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "cocoa/gb/interrupt.hpp"
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/scheduler.hpp"
+#include "cocoa/gb/timer.hpp"
+#include "cocoa/utility.hpp"
+
+namespace cocoa::gb {
+// NOTE: TIMA period is 2^n t-states, indexed by clock select bits of TAC. Counter bit watched for
+// falling edges is thus bit n - 1.
+constexpr std::array<size_t, 4> TIMA_PERIOD_SHIFT = { 10, 4, 6, 8 };
+
+/// @brief Get log2 of TIMA period in t-states.
+static constexpr size_t
+period_shift(const uint8_t tac)
+{
+    return TIMA_PERIOD_SHIFT[tac & 0x03];
+}
+
+Timer::Timer(MemoryBus& bus, Scheduler& scheduler)
+    : m_bus(bus)
+    , m_scheduler(scheduler)
+    , m_div_base(scheduler.now())
+    , m_synced(scheduler.now())
+    , m_reload_at(NO_DEADLINE)
+    , m_tima(0)
+    , m_tma(0)
+    , m_tac(0)
+{
+    m_bus.map_io_handler(IoMap::DIV, { on_read_div, on_write_div, this });
+    m_bus.map_io_handler(IoMap::TIMA, { on_read_tima, on_write_tima, this });
+    m_bus.map_io_handler(IoMap::TMA, { nullptr, on_write_tma, this });
+    m_bus.map_io_handler(IoMap::TAC, { nullptr, on_write_tac, this });
+    m_bus.poke(from_enum(IoMap::TMA), m_tma);
+    m_bus.poke(from_enum(IoMap::TAC), static_cast<uint8_t>(m_tac | 0xF8));
+    m_scheduler.attach(EventKind::Timer, { on_overflow, this });
+}
+
+uint16_t
+Timer::system_counter() const
+{
+    return static_cast<uint16_t>(counter_at(m_scheduler.now()));
+}
+
+void
+Timer::save_state(TimerSnapshot& out) const
+{
+    out = {};
+    out.div_base = m_div_base;
+    out.synced = m_synced;
+    out.reload_at = m_reload_at;
+    out.tima = m_tima;
+    out.tma = m_tma;
+    out.tac = m_tac;
+}
+
+void
+Timer::load_state(const TimerSnapshot& snapshot)
+{
+    m_div_base = snapshot.div_base;
+    m_synced = snapshot.synced;
+    m_reload_at = snapshot.reload_at;
+    m_tima = snapshot.tima;
+    m_tma = snapshot.tma;
+    m_tac = snapshot.tac;
+}
+
+uint8_t
+Timer::on_read_div(void* context, uint16_t)
+{
+    const Timer* timer = static_cast<const Timer*>(context);
+    return static_cast<uint8_t>(timer->system_counter() >> 8);
+}
+
+void
+Timer::on_write_div(void* context, uint16_t, uint8_t)
+{
+    Timer* timer = static_cast<Timer*>(context);
+    timer->sync();
+    if (timer->is_signal_high(timer->m_tac, timer->m_synced))
+        timer->tick_now();
+    timer->m_div_base = timer->m_synced;
+    timer->schedule_overflow();
+}
+
+uint8_t
+Timer::on_read_tima(void* context, uint16_t)
+{
+    Timer* timer = static_cast<Timer*>(context);
+    timer->sync();
+    return timer->m_tima;
+}
+
+void
+Timer::on_write_tima(void* context, uint16_t, uint8_t value)
+{
+    Timer* timer = static_cast<Timer*>(context);
+    timer->sync();
+
+    // NOTE: Writing TIMA between overflow and reload cancels reload and its interrupt.
+    timer->m_reload_at = NO_DEADLINE;
+    timer->m_tima = value;
+    timer->schedule_overflow();
+}
+
+void
+Timer::on_write_tma(void* context, uint16_t address, uint8_t value)
+{
+    Timer* timer = static_cast<Timer*>(context);
+    timer->sync();
+    timer->m_tma = value;
+    timer->m_bus.poke(address, value);
+}
+
+void
+Timer::on_write_tac(void* context, uint16_t address, uint8_t value)
+{
+    Timer* timer = static_cast<Timer*>(context);
+    timer->sync();
+
+    const uint8_t tac = value & 0x07;
+    const bool was_high = timer->is_signal_high(timer->m_tac, timer->m_synced);
+    timer->m_tac = tac;
+    if (was_high && !timer->is_signal_high(tac, timer->m_synced))
+        timer->tick_now();
+
+    timer->m_bus.poke(address, static_cast<uint8_t>(tac | 0xF8));
+    timer->schedule_overflow();
+}
+
+void
+Timer::on_overflow(void* context, size_t)
+{
+    Timer* timer = static_cast<Timer*>(context);
+    timer->sync();
+    timer->schedule_overflow();
+}
+
+size_t
+Timer::counter_at(const size_t time) const
+{
+    return time - m_div_base;
+}
+
+bool
+Timer::is_signal_high(const uint8_t tac, const size_t time) const
+{
+    if (!is_bit_set<uint8_t, 2>(tac))
+        return false;
+    return ((counter_at(time) >> (period_shift(tac) - 1)) & 1) != 0;
+}
+
+void
+Timer::sync()
+{
+    const size_t now = m_scheduler.now();
+    for (;;) {
+        if (m_reload_at <= now) {
+            m_tima = m_tma;
+            request_interrupt<Interrupt::Timer>(m_bus);
+            m_synced = m_reload_at;
+            m_reload_at = NO_DEADLINE;
+        }
+
+        if (!is_bit_set<uint8_t, 2>(m_tac))
+            break;
+
+        // INVARIANT: No falling edge fits between overflow and reload, since shortest period is
+        // longer than reload delay. Counting edges from overflow onwards is thus always safe.
+        const size_t shift = period_shift(m_tac);
+        const size_t edges_then = counter_at(m_synced) >> shift;
+        const size_t edges = (counter_at(now) >> shift) - edges_then;
+        if (m_tima + edges <= 0xFF) {
+            m_tima = static_cast<uint8_t>(m_tima + edges);
+            break;
+        }
+
+        const size_t overflow = m_div_base + ((edges_then + (0x100 - m_tima)) << shift);
+        m_tima = 0;
+        m_synced = overflow;
+        m_reload_at = overflow + TIMA_RELOAD_DELAY;
+    }
+    m_synced = now;
+}
+
+void
+Timer::tick_now()
+{
+    if (m_tima == 0xFF) {
+        m_tima = 0;
+        m_reload_at = m_synced + TIMA_RELOAD_DELAY;
+    } else {
+        ++m_tima;
+    }
+}
+
+void
+Timer::schedule_overflow()
+{
+    if (m_reload_at != NO_DEADLINE) {
+        m_scheduler.schedule(EventKind::Timer, m_reload_at);
+        return;
+    }
+
+    if (!is_bit_set<uint8_t, 2>(m_tac)) {
+        m_scheduler.cancel(EventKind::Timer);
+        return;
+    }
+
+    const size_t shift = period_shift(m_tac);
+    const size_t overflow
+        = m_div_base + (((counter_at(m_synced) >> shift) + (0x100 - m_tima)) << shift);
+    m_scheduler.schedule(EventKind::Timer, overflow + TIMA_RELOAD_DELAY);
+}
+} // namespace cocoa::gb
@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_GB_TIMER_HPP
+#define COCOA_GB_TIMER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/scheduler.hpp"
+
+namespace cocoa::gb {
+/// @brief Amount of t-states between TIMA overflow and reload of TMA into TIMA.
+constexpr size_t TIMA_RELOAD_DELAY = 4;
+
+/// @brief Plain image of timer state stored in save states.
+///
+/// @invariant Fields are fixed width and explicitly padded, so layout is identical across builds.
+struct TimerSnapshot final {
+    uint64_t div_base;
+    uint64_t synced;
+    uint64_t reload_at;
+    uint8_t tima;
+    uint8_t tma;
+    uint8_t tac;
+    std::array<uint8_t, 5> reserved;
+};
+
+static_assert(sizeof(TimerSnapshot) == 32);
+
+/// @brief GameBoy DIV and TIMA timer.
+///
+/// Hardware drives both registers from one 16-bit system counter that increments every t-state.
+/// DIV is the high byte of that counter, and TIMA increments on every falling edge of a counter
+/// bit selected by TAC. Nothing here counts t-states one by one. Instead, the system counter is
+/// derived from global time, and TIMA catches up by counting falling edges in closed form
+/// whenever it is accessed. Only the predicted overflow is posted to scheduler, so a running
+/// timer costs one event per overflow.
+///
+/// Falling edge quirks are modeled. Resetting DIV or changing TAC increments TIMA if the
+/// selected counter bit drops from high to low. Overflow leaves TIMA at zero for
+/// `TIMA_RELOAD_DELAY` t-states before TMA is reloaded and the timer interrupt is requested, and
+/// writing TIMA in that window cancels both.
+///
+/// @see https://gbdev.io/pandocs/Timer_and_Divider_Registers.html
+/// @see https://gbdev.io/pandocs/Timer_Obscure_Behaviour.html
+class Timer final {
+public:
+    /// @brief Attach timer to DIV, TIMA, TMA, and TAC registers of memory bus.
+    ///
+    /// @param [in] bus Memory bus to attach to.
+    /// @param [in] scheduler Scheduler to post predicted overflows to, and to read time from.
+    Timer(MemoryBus& bus, Scheduler& scheduler);
+
+    Timer(const Timer&) = delete;
+
+    Timer&
+    operator=(const Timer&) = delete;
+
+    ~Timer() noexcept = default;
+
+    /// @brief Get current value of 16-bit system counter.
+    [[nodiscard]]
+    uint16_t
+    system_counter() const;
+
+    /// @brief Capture timer state for save state.
+    ///
+    /// @param [out] out Snapshot to fill.
+    void
+    save_state(TimerSnapshot& out) const;
+
+    /// @brief Restore timer state from save state.
+    ///
+    /// Pending overflow event is not posted here, because it is restored along with scheduler.
+    ///
+    /// @param [in] snapshot Snapshot to restore from.
+    void
+    load_state(const TimerSnapshot& snapshot);
+
+private:
+    static uint8_t
+    on_read_div(void* context, uint16_t address);
+
+    static void
+    on_write_div(void* context, uint16_t address, uint8_t value);
+
+    static uint8_t
+    on_read_tima(void* context, uint16_t address);
+
+    static void
+    on_write_tima(void* context, uint16_t address, uint8_t value);
+
+    static void
+    on_write_tma(void* context, uint16_t address, uint8_t value);
+
+    static void
+    on_write_tac(void* context, uint16_t address, uint8_t value);
+
+    static void
+    on_overflow(void* context, size_t deadline);
+
+    /// @brief Get unwrapped system counter at given time.
+    [[nodiscard]]
+    size_t
+    counter_at(const size_t time) const;
+
+    /// @brief Check if counter bit selected by TAC is high and timer is enabled.
+    [[nodiscard]]
+    bool
+    is_signal_high(const uint8_t tac, const size_t time) const;
+
+    /// @brief Catch TIMA up with current time, firing any overflow and reload in between.
+    void
+    sync();
+
+    /// @brief Increment TIMA once at current time due to a falling edge quirk.
+    void
+    tick_now();
+
+    /// @brief Post event for next point at which TIMA reloads from TMA.
+    void
+    schedule_overflow();
+
+    MemoryBus& m_bus;
+    Scheduler& m_scheduler;
+
+    /// Time at which system counter was last zero.
+    size_t m_div_base;
+
+    /// Time up to which TIMA is accurate.
+    size_t m_synced;
+
+    /// Time of pending TMA reload, or `NO_DEADLINE` if none.
+    size_t m_reload_at;
+    uint8_t m_tima;
+    uint8_t m_tma;
+    uint8_t m_tac;
+};
+} // namespace cocoa::gb
+
+#endif // COCOA_GB_TIMER_HPP
@@ -0,0 +1,196 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "cocoa/gb/memory.hpp"
+#include "cocoa/gb/scheduler.hpp"
+#include "cocoa/gb/timer.hpp"
+#include "cocoa/utility.hpp"
+
+/// @brief Timer that ticks every t-state, as a reference for lazy evaluation.
+struct ReferenceTimer final {
+    uint16_t counter = 0;
+    uint8_t tima = 0;
+    uint8_t tma = 0;
+    uint8_t tac = 0;
+    size_t time = 0;
+    size_t reload_at = cocoa::gb::NO_DEADLINE;
+    bool irq = false;
+
+    [[nodiscard]]
+    bool
+    signal() const
+    {
+        constexpr std::array<size_t, 4> bits = { 9, 3, 5, 7 };
+        return ((tac & 0x04) != 0) && ((counter >> bits[tac & 0x03]) & 1) != 0;
+    }
+
+    void
+    increment()
+    {
+        if (tima == 0xFF) {
+            tima = 0;
+            reload_at = time + cocoa::gb::TIMA_RELOAD_DELAY;
+        } else {
+            ++tima;
+        }
+    }
+
+    void
+    tick()
+    {
+        const bool before = signal();
+        ++counter;
+        ++time;
+        if (before && !signal())
+            increment();
+        if (reload_at == time) {
+            tima = tma;
+            irq = true;
+            reload_at = cocoa::gb::NO_DEADLINE;
+        }
+    }
+};
+
+TEST_CASE("cocoa::gb::Timer::Timer(MemoryBus&, Scheduler&)", "[timer]")
+{
+    size_t clock = 0;
+    cocoa::gb::MemoryBus bus {};
+    cocoa::gb::Scheduler scheduler(clock);
+    cocoa::gb::Timer timer(bus, scheduler);
+
+    SECTION("Derive DIV from global time")
+    {
+        clock = 0x1FF;
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::DIV) == 0x01);
+        REQUIRE(timer.system_counter() == 0x01FF);
+
+        bus.write_io_reg(cocoa::gb::IoMap::DIV, 0x42);
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::DIV) == 0x00);
+        clock += 0x100;
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::DIV) == 0x01);
+    }
+
+    SECTION("Count TIMA only while enabled")
+    {
+        clock = 1000;
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::TIMA) == 0);
+        REQUIRE(!scheduler.is_scheduled(cocoa::gb::EventKind::Timer));
+
+        bus.write_io_reg(cocoa::gb::IoMap::TAC, 0x05);
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::TAC) == 0xFD);
+        clock += 160;
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::TIMA) == 10);
+    }
+
+    SECTION("Reload TMA and request interrupt after overflow delay")
+    {
+        bus.write_io_reg(cocoa::gb::IoMap::TMA, 0xF0);
+        bus.write_io_reg(cocoa::gb::IoMap::TIMA, 0xFF);
+        bus.write_io_reg(cocoa::gb::IoMap::TAC, 0x05);
+        REQUIRE(scheduler.deadline(cocoa::gb::EventKind::Timer) == 16 + 4);
+
+        clock = 17;
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::TIMA) == 0x00);
+        REQUIRE(!cocoa::is_bit_set<uint8_t, 2>(bus.read_io_reg(cocoa::gb::IoMap::IF)));
+
+        clock = 20;
+        REQUIRE(scheduler.dispatch() == 1);
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::TIMA) == 0xF0);
+        REQUIRE(cocoa::is_bit_set<uint8_t, 2>(bus.read_io_reg(cocoa::gb::IoMap::IF)));
+        REQUIRE(scheduler.deadline(cocoa::gb::EventKind::Timer) == 276);
+    }
+
+    SECTION("Cancel reload by writing TIMA after overflow")
+    {
+        bus.write_io_reg(cocoa::gb::IoMap::TIMA, 0xFF);
+        bus.write_io_reg(cocoa::gb::IoMap::TAC, 0x05);
+        clock = 18;
+        bus.write_io_reg(cocoa::gb::IoMap::TIMA, 0x80);
+        clock = 24;
+        scheduler.dispatch();
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::TIMA) == 0x80);
+        REQUIRE(!cocoa::is_bit_set<uint8_t, 2>(bus.read_io_reg(cocoa::gb::IoMap::IF)));
+    }
+
+    SECTION("Increment TIMA on falling edge caused by DIV reset")
+    {
+        bus.write_io_reg(cocoa::gb::IoMap::TAC, 0x05);
+        clock = 8;
+        bus.write_io_reg(cocoa::gb::IoMap::DIV, 0x00);
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::TIMA) == 1);
+        clock = 8 + 15;
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::TIMA) == 1);
+        clock = 8 + 16;
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::TIMA) == 2);
+    }
+
+    SECTION("Increment TIMA on falling edge caused by TAC change")
+    {
+        bus.write_io_reg(cocoa::gb::IoMap::TAC, 0x05);
+        clock = 8;
+        bus.write_io_reg(cocoa::gb::IoMap::TAC, 0x00);
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::TIMA) == 1);
+        clock = 4096;
+        REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::TIMA) == 1);
+    }
+
+    SECTION("Match per t-state reference model")
+    {
+        ReferenceTimer reference {};
+        uint32_t lcg = 7;
+        auto next = [&lcg](const uint32_t bound) {
+            lcg = lcg * 1664525U + 1013904223U;
+            return (lcg >> 8) % bound;
+        };
+
+        for (size_t op = 0; op < 20000; ++op) {
+            const size_t advance = next(4) == 0 ? next(2048) : next(24);
+            for (size_t i = 0; i < advance; ++i)
+                reference.tick();
+            clock += advance;
+            scheduler.dispatch();
+
+            const uint8_t value = static_cast<uint8_t>(next(256));
+            switch (next(6)) {
+            case 0:
+                if (reference.signal())
+                    reference.increment();
+                reference.counter = 0;
+                bus.write_io_reg(cocoa::gb::IoMap::DIV, value);
+                break;
+            case 1: {
+                const bool before = reference.signal();
+                reference.tac = value & 0x07;
+                if (before && !reference.signal())
+                    reference.increment();
+                bus.write_io_reg(cocoa::gb::IoMap::TAC, value);
+                break;
+            }
+            case 2:
+                reference.tima = value;
+                reference.reload_at = cocoa::gb::NO_DEADLINE;
+                bus.write_io_reg(cocoa::gb::IoMap::TIMA, value);
+                break;
+            case 3:
+                reference.tma = value;
+                bus.write_io_reg(cocoa::gb::IoMap::TMA, value);
+                break;
+            default:
+                break;
+            }
+
+            REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::TIMA) == reference.tima);
+            REQUIRE(bus.read_io_reg(cocoa::gb::IoMap::DIV) == (reference.counter >> 8));
+            const bool irq = cocoa::is_bit_set<uint8_t, 2>(bus.read_io_reg(cocoa::gb::IoMap::IF));
+            REQUIRE(irq == reference.irq);
+            bus.write_io_reg(cocoa::gb::IoMap::IF, 0x00);
+            reference.irq = false;
+        }
+    }
+}
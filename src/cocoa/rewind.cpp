@@ -0,0 +1,235 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include "cocoa/rewind.hpp"
+
+namespace cocoa {
+// NOTE: Unchanged stretches shorter than this are cheaper to carry inside a literal than to split
+// the literal into two tokens.
+constexpr size_t MIN_SKIP = 4;
+
+// NOTE: Delta buffers of dropped frames kept around for reuse, so steady capture never allocates.
+constexpr size_t SPARE_LIMIT = 8;
+
+static void
+put_varint(std::vector<uint8_t>& out, size_t value)
+{
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+static size_t
+get_varint(const uint8_t*& in)
+{
+    size_t value = 0;
+    for (size_t shift = 0;; shift += 7) {
+        const uint8_t byte = *in++;
+        value |= static_cast<size_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+            return value;
+    }
+}
+
+static uint8_t
+diff_at(const uint8_t* current, const uint8_t* previous, const size_t index)
+{
+    return (previous == nullptr) ? current[index]
+                                 : static_cast<uint8_t>(current[index] ^ previous[index]);
+}
+
+/// @brief Count unchanged bytes starting at index, a word at a time where possible.
+static size_t
+skip_unchanged(const uint8_t* current, const uint8_t* previous, size_t index, const size_t size)
+{
+    const size_t start = index;
+    while (index + sizeof(uint64_t) <= size) {
+        uint64_t lhs = 0;
+        uint64_t rhs = 0;
+        std::memcpy(&lhs, current + index, sizeof(lhs));
+        if (previous != nullptr)
+            std::memcpy(&rhs, previous + index, sizeof(rhs));
+        if ((lhs ^ rhs) != 0)
+            break;
+        index += sizeof(uint64_t);
+    }
+
+    while (index < size && diff_at(current, previous, index) == 0)
+        ++index;
+    return index - start;
+}
+
+void
+encode_delta(const uint8_t* current, const uint8_t* previous, const size_t size,
+    std::vector<uint8_t>& out)
+{
+    out.clear();
+    size_t index = 0;
+    while (index < size) {
+        const size_t skip = skip_unchanged(current, previous, index, size);
+        index += skip;
+        if (index == size)
+            break;
+
+        // INVARIANT: Literal starts and ends on a changed byte.
+        size_t end = index + 1;
+        for (size_t probe = end; probe < size && probe - end < MIN_SKIP; ++probe) {
+            if (diff_at(current, previous, probe) != 0)
+                end = probe + 1;
+        }
+
+        put_varint(out, skip);
+        put_varint(out, end - index);
+        for (; index < end; ++index)
+            out.push_back(diff_at(current, previous, index));
+    }
+}
+
+void
+apply_delta(const std::vector<uint8_t>& delta, std::vector<uint8_t>& image)
+{
+    const uint8_t* in = delta.data();
+    const uint8_t* end = in + delta.size();
+    uint8_t* out = image.data();
+    while (in < end) {
+        out += get_varint(in);
+        const size_t length = get_varint(in);
+        for (size_t i = 0; i < length; ++i)
+            out[i] ^= in[i];
+        out += length;
+        in += length;
+    }
+}
+
+RewindBuffer::RewindBuffer(const size_t budget, const size_t keyframe_interval)
+    : m_frames()
+    , m_spare()
+    , m_newest()
+    , m_budget(budget)
+    , m_interval(std::max<size_t>(keyframe_interval, 1))
+    , m_since_key(0)
+    , m_keyframes(0)
+    , m_memory(0)
+{
+}
+
+void
+RewindBuffer::push(const std::vector<uint8_t>& image)
+{
+    if (!m_frames.empty() && image.size() != m_newest.size())
+        clear();
+
+    Frame frame = {};
+    if (!m_spare.empty()) {
+        frame.delta = std::move(m_spare.back());
+        m_spare.pop_back();
+    }
+
+    frame.key = m_frames.empty() || m_since_key >= m_interval;
+    encode_delta(image.data(), frame.key ? nullptr : m_newest.data(), image.size(), frame.delta);
+    m_since_key = frame.key ? 1 : m_since_key + 1;
+    m_keyframes += frame.key ? 1 : 0;
+    m_memory += frame.delta.capacity();
+    m_frames.push_back(std::move(frame));
+    m_newest = image;
+
+    while (m_memory + m_newest.size() > m_budget && m_keyframes > 1)
+        drop_oldest_group();
+}
+
+bool
+RewindBuffer::pop(std::vector<uint8_t>& image)
+{
+    if (m_frames.empty())
+        return false;
+
+    image = m_newest;
+    Frame& frame = m_frames.back();
+    const bool key = frame.key;
+    if (!key)
+        apply_delta(frame.delta, m_newest);
+    recycle(frame);
+    m_frames.pop_back();
+
+    if (!key) {
+        --m_since_key;
+    } else {
+        --m_keyframes;
+        replay_newest_group();
+    }
+
+    return true;
+}
+
+void
+RewindBuffer::clear()
+{
+    while (!m_frames.empty()) {
+        recycle(m_frames.back());
+        m_frames.pop_back();
+    }
+    m_newest.clear();
+    m_since_key = 0;
+    m_keyframes = 0;
+    m_memory = 0;
+}
+
+size_t
+RewindBuffer::size() const
+{
+    return m_frames.size();
+}
+
+size_t
+RewindBuffer::memory() const
+{
+    return m_memory + m_newest.size();
+}
+
+void
+RewindBuffer::drop_oldest_group()
+{
+    do {
+        recycle(m_frames.front());
+        m_frames.pop_front();
+    } while (!m_frames.front().key);
+    --m_keyframes;
+}
+
+void
+RewindBuffer::replay_newest_group()
+{
+    if (m_frames.empty()) {
+        m_newest.clear();
+        m_since_key = 0;
+        return;
+    }
+
+    size_t key = m_frames.size() - 1;
+    while (!m_frames[key].key)
+        --key;
+
+    std::fill(m_newest.begin(), m_newest.end(), 0);
+    for (size_t i = key; i < m_frames.size(); ++i)
+        apply_delta(m_frames[i].delta, m_newest);
+    m_since_key = m_frames.size() - key;
+}
+
+void
+RewindBuffer::recycle(Frame& frame)
+{
+    m_memory -= frame.delta.capacity();
+    if (m_spare.size() < SPARE_LIMIT)
+        m_spare.push_back(std::move(frame.delta));
+}
+} // namespace cocoa
@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_REWIND_HPP
+#define COCOA_REWIND_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace cocoa {
+/// @brief Encode XOR delta between two equally sized images.
+///
+/// Delta is a sequence of tokens, each holding a LEB128 count of unchanged bytes to skip, a
+/// LEB128 count of changed bytes, and the XOR of those changed bytes. Trailing unchanged bytes
+/// are not encoded at all. Unchanged stretches are scanned a machine word at a time, so encoding
+/// costs little more than reading both images once.
+///
+/// @param [in] current Image to encode.
+/// @param [in] previous Image to encode against, or null to encode against all zeroes.
+/// @param [in] size Size of both images in bytes.
+/// @param [out] out Encoded delta, replacing previous contents.
+void
+encode_delta(const uint8_t* current, const uint8_t* previous, const size_t size,
+    std::vector<uint8_t>& out);
+
+/// @brief Apply XOR delta onto image in place.
+///
+/// XOR is its own inverse, so applying delta turns either image it was encoded from into the
+/// other one.
+///
+/// @pre Delta was encoded from images of given size.
+///
+/// @param [in] delta Encoded delta.
+/// @param [in,out] image Image to apply delta onto.
+void
+apply_delta(const std::vector<uint8_t>& delta, std::vector<uint8_t>& image);
+
+/// @brief Bounded history of emulator state images for rewinding.
+///
+/// Images are captured once per frame. Every `keyframe_interval` frames one keyframe is stored
+/// as delta against all zeroes, and every frame in between as delta against the frame before
+/// it. Consecutive frames differ in a tiny part of memory, so most frames cost a few hundred
+/// bytes instead of a whole image.
+///
+/// Newest image is always kept decoded. Rewinding one frame thus applies a single delta onto
+/// it, except when crossing a keyframe, where the group before it is replayed from its own
+/// keyframe once.
+///
+/// Once memory held exceeds budget, oldest group of frames, i.e., a keyframe and the deltas
+/// depending on it, is dropped as a whole. Each frame is dropped at most once, so capture stays
+/// O(1) amortized in the amount of frames held.
+class RewindBuffer final {
+public:
+    /// @brief Construct empty history.
+    ///
+    /// @param [in] budget Upper bound of bytes held, though newest group of frames is always
+    ///                    kept.
+    /// @param [in] keyframe_interval Amount of frames per keyframe, at least one.
+    RewindBuffer(const size_t budget, const size_t keyframe_interval);
+
+    RewindBuffer(const RewindBuffer&) = delete;
+
+    RewindBuffer&
+    operator=(const RewindBuffer&) = delete;
+
+    ~RewindBuffer() noexcept = default;
+
+    /// @brief Capture image as newest frame.
+    ///
+    /// History is cleared first if image size differs from that of previous frames.
+    ///
+    /// @param [in] image Image to capture.
+    void
+    push(const std::vector<uint8_t>& image);
+
+    /// @brief Take newest frame out of history.
+    ///
+    /// @param [out] image Image of newest frame.
+    /// @return True if a frame was taken, false if history is empty.
+    bool
+    pop(std::vector<uint8_t>& image);
+
+    /// @brief Drop every frame.
+    void
+    clear();
+
+    /// @brief Get amount of frames held.
+    [[nodiscard]]
+    size_t
+    size() const;
+
+    /// @brief Get amount of bytes held by encoded frames and decoded newest image.
+    [[nodiscard]]
+    size_t
+    memory() const;
+
+private:
+    struct Frame final {
+        std::vector<uint8_t> delta;
+        bool key;
+    };
+
+    /// @brief Drop oldest keyframe and every delta depending on it.
+    void
+    drop_oldest_group();
+
+    /// @brief Decode newest image by replaying newest group from its keyframe.
+    void
+    replay_newest_group();
+
+    /// @brief Hand delta buffer of dropped frame back for reuse.
+    void
+    recycle(Frame& frame);
+
+    std::deque<Frame> m_frames;
+    std::vector<std::vector<uint8_t>> m_spare;
+    std::vector<uint8_t> m_newest;
+    size_t m_budget;
+    size_t m_interval;
+
+    /// Amount of frames in newest group, including its keyframe.
+    size_t m_since_key;
+
+    /// Amount of keyframes held.
+    size_t m_keyframes;
+
+    /// Bytes held by encoded frames.
+    size_t m_memory;
+};
+} // namespace cocoa
+
+#endif // COCOA_REWIND_HPP
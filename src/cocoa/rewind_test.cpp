@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "cocoa/rewind.hpp"
+
+/// @brief Generate history of images where each frame changes a few scattered bytes.
+static std::vector<std::vector<uint8_t>>
+make_history(const size_t frames, const size_t size)
+{
+    std::vector<std::vector<uint8_t>> history;
+    std::vector<uint8_t> image(size, 0);
+    uint32_t lcg = 1;
+    for (size_t frame = 0; frame < frames; ++frame) {
+        for (size_t i = 0; i < 16; ++i) {
+            lcg = lcg * 1664525U + 1013904223U;
+            image[(lcg >> 8) % size] = static_cast<uint8_t>(lcg >> 24);
+        }
+        image[frame % size] = static_cast<uint8_t>(frame);
+        history.push_back(image);
+    }
+    return history;
+}
+
+TEST_CASE("void cocoa::apply_delta(const std::vector<uint8_t>&, std::vector<uint8_t>&)",
+    "[apply_delta]")
+{
+    std::vector<uint8_t> previous(4096, 0x11);
+    std::vector<uint8_t> current = previous;
+    current[0] = 0x00;
+    current[5] = 0x42;
+    current[7] = 0x43;
+    current[4095] = 0xFF;
+    std::vector<uint8_t> delta;
+
+    SECTION("Turn previous image into current image and back")
+    {
+        cocoa::encode_delta(current.data(), previous.data(), current.size(), delta);
+        REQUIRE(delta.size() < 16);
+
+        std::vector<uint8_t> image = previous;
+        cocoa::apply_delta(delta, image);
+        REQUIRE(image == current);
+        cocoa::apply_delta(delta, image);
+        REQUIRE(image == previous);
+    }
+
+    SECTION("Encode keyframe against all zeroes")
+    {
+        std::vector<uint8_t> sparse(65536, 0);
+        sparse[300] = 1;
+        sparse[40000] = 2;
+        cocoa::encode_delta(sparse.data(), nullptr, sparse.size(), delta);
+        REQUIRE(delta.size() < 16);
+
+        std::vector<uint8_t> image(sparse.size(), 0);
+        cocoa::apply_delta(delta, image);
+        REQUIRE(image == sparse);
+    }
+
+    SECTION("Encode identical images as empty delta")
+    {
+        cocoa::encode_delta(previous.data(), previous.data(), previous.size(), delta);
+        REQUIRE(delta.empty());
+    }
+}
+
+TEST_CASE("bool cocoa::RewindBuffer::pop(std::vector<uint8_t>&)", "[pop]")
+{
+    const std::vector<std::vector<uint8_t>> history = make_history(100, 8192);
+    std::vector<uint8_t> image;
+
+    SECTION("Rewind every frame in reverse order across keyframes")
+    {
+        cocoa::RewindBuffer rewind(SIZE_MAX, 7);
+        for (const std::vector<uint8_t>& frame : history)
+            rewind.push(frame);
+        REQUIRE(rewind.size() == history.size());
+        REQUIRE(rewind.memory() < history.size() * 1024);
+
+        for (size_t i = history.size(); i-- > 0;) {
+            REQUIRE(rewind.pop(image));
+            REQUIRE(image == history[i]);
+        }
+        REQUIRE(!rewind.pop(image));
+    }
+
+    SECTION("Resume capture after rewinding")
+    {
+        cocoa::RewindBuffer rewind(SIZE_MAX, 4);
+        for (size_t i = 0; i < 10; ++i)
+            rewind.push(history[i]);
+        for (size_t i = 0; i < 5; ++i)
+            rewind.pop(image);
+        for (size_t i = 50; i < 60; ++i)
+            rewind.push(history[i]);
+
+        for (size_t i = 60; i-- > 50;) {
+            REQUIRE(rewind.pop(image));
+            REQUIRE(image == history[i]);
+        }
+        for (size_t i = 5; i-- > 0;) {
+            REQUIRE(rewind.pop(image));
+            REQUIRE(image == history[i]);
+        }
+    }
+
+    SECTION("Drop oldest groups to stay within budget")
+    {
+        const size_t budget = 3 * history.front().size();
+        cocoa::RewindBuffer rewind(budget, 10);
+        for (const std::vector<uint8_t>& frame : history) {
+            rewind.push(frame);
+            REQUIRE(rewind.memory() <= budget);
+        }
+        REQUIRE(rewind.size() < history.size());
+        REQUIRE(rewind.size() % 10 == 0);
+
+        const size_t kept = rewind.size();
+        for (size_t i = history.size(); i-- > history.size() - kept;) {
+            REQUIRE(rewind.pop(image));
+            REQUIRE(image == history[i]);
+        }
+        REQUIRE(rewind.size() == 0);
+        REQUIRE(rewind.memory() == 0);
+    }
+}
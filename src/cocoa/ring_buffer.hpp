@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_RING_BUFFER_HPP
+#define COCOA_RING_BUFFER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace cocoa {
+/// @brief Lock-free single-producer single-consumer ring buffer.
+///
+/// One thread may push while another thread pops without any locking. Pushing into a full buffer
+/// fails instead of blocking or overwriting, so the producer never waits on the consumer.
+///
+/// @pre Capacity must be a power of two.
+/// @pre Given element type must be trivially copyable.
+template <typename T, size_t Capacity>
+class RingBuffer final {
+public:
+    RingBuffer() = default;
+
+    ~RingBuffer() noexcept = default;
+
+    /// @brief Push element into buffer.
+    ///
+    /// @note Must only be called by producer thread.
+    ///
+    /// @param [in] value Element to push.
+    /// @return True if element was pushed, false if buffer is full.
+    bool
+    push(const T& value);
+
+    /// @brief Pop oldest element from buffer.
+    ///
+    /// @note Must only be called by consumer thread.
+    ///
+    /// @param [out] value Element popped.
+    /// @return True if element was popped, false if buffer is empty.
+    bool
+    pop(T& value);
+
+    /// @brief Get amount of elements in buffer.
+    ///
+    /// @note Result is only a snapshot when producer or consumer are active.
+    ///
+    /// @return Amount of elements.
+    [[nodiscard]]
+    size_t
+    size() const;
+
+    /// @brief Get maximum amount of elements buffer can hold.
+    ///
+    /// @return Capacity of buffer.
+    [[nodiscard]]
+    static constexpr size_t
+    capacity();
+
+private:
+    // INVARIANT: Keep producer and consumer indices on separate cache lines to avoid false sharing.
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    std::array<T, Capacity> m_buffer;
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_head { 0 };
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_tail { 0 };
+};
+} // namespace cocoa
+
+#include "cocoa/ring_buffer.tpp"
+
+#endif // COCOA_RING_BUFFER_HPP
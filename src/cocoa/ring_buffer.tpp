@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_RING_BUFFER_TPP
+#define COCOA_RING_BUFFER_TPP
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace cocoa {
+template <typename T, size_t Capacity>
+bool
+RingBuffer<T, Capacity>::push(const T& value)
+{
+    static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0,
+        "capacity is not power of two");
+    static_assert(std::is_trivially_copyable<T>::value == true, "type is not trivially copyable");
+
+    const size_t head = m_head.load(std::memory_order_relaxed);
+    if (head - m_tail.load(std::memory_order_acquire) == Capacity)
+        return false;
+
+    m_buffer[head & (Capacity - 1)] = value;
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T, size_t Capacity>
+bool
+RingBuffer<T, Capacity>::pop(T& value)
+{
+    const size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail == m_head.load(std::memory_order_acquire))
+        return false;
+
+    value = m_buffer[tail & (Capacity - 1)];
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T, size_t Capacity>
+size_t
+RingBuffer<T, Capacity>::size() const
+{
+    return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+}
+
+template <typename T, size_t Capacity>
+constexpr size_t
+RingBuffer<T, Capacity>::capacity()
+{
+    return Capacity;
+}
+} // namespace cocoa
+
+#endif // COCOA_RING_BUFFER_TPP
@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "cocoa/ring_buffer.hpp"
+
+TEST_CASE("bool cocoa::RingBuffer<T, Capacity>::push(const T&)", "[push]")
+{
+    cocoa::RingBuffer<uint32_t, 4> buffer;
+    REQUIRE(buffer.push(1) == true);
+    REQUIRE(buffer.push(2) == true);
+    REQUIRE(buffer.push(3) == true);
+    REQUIRE(buffer.push(4) == true);
+    REQUIRE(buffer.push(5) == false);
+    REQUIRE(buffer.size() == 4);
+}
+
+TEST_CASE("bool cocoa::RingBuffer<T, Capacity>::pop(T&)", "[pop]")
+{
+    cocoa::RingBuffer<uint32_t, 4> buffer;
+    uint32_t value = 0;
+    REQUIRE(buffer.pop(value) == false);
+
+    // INVARIANT: Indices must wrap around capacity while preserving FIFO order.
+    for (uint32_t i = 0; i < 10; ++i) {
+        REQUIRE(buffer.push(i) == true);
+        REQUIRE(buffer.pop(value) == true);
+        REQUIRE(value == i);
+    }
+
+    REQUIRE(buffer.size() == 0);
+}
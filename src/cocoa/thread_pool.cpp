@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "cocoa/thread_pool.hpp"
+
+namespace cocoa {
+ThreadPool::ThreadPool(size_t threads)
+    : m_queues()
+    , m_threads()
+    , m_lock()
+    , m_wake()
+    , m_idle()
+    , m_next(0)
+    , m_queued(0)
+    , m_pending(0)
+    , m_stop(false)
+{
+    if (threads == 0)
+        threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+    for (size_t i = 0; i < threads; ++i)
+        m_queues.push_back(std::make_unique<Queue>());
+    for (size_t i = 0; i < threads; ++i)
+        m_threads.emplace_back(&ThreadPool::work, this, i);
+}
+
+ThreadPool::~ThreadPool() noexcept
+{
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& thread : m_threads)
+        thread.join();
+}
+
+void
+ThreadPool::submit(std::function<void()> job)
+{
+    // INVARIANT: Counted before it is queued, so a worker taking it at once never drops counts
+    // below zero, nor reports pool idle while it is still running.
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        ++m_queued;
+        ++m_pending;
+    }
+
+    Queue& queue = *m_queues[m_next.fetch_add(1, std::memory_order_relaxed) % m_queues.size()];
+    {
+        std::lock_guard<std::mutex> guard(queue.lock);
+        queue.jobs.push_back(std::move(job));
+    }
+    m_wake.notify_one();
+}
+
+void
+ThreadPool::wait()
+{
+    std::unique_lock<std::mutex> guard(m_lock);
+    m_idle.wait(guard, [this] { return m_pending == 0; });
+}
+
+size_t
+ThreadPool::size() const
+{
+    return m_threads.size();
+}
+
+void
+ThreadPool::work(const size_t index)
+{
+    for (;;) {
+        std::function<void()> job;
+        if (take(index, job)) {
+            job();
+            std::lock_guard<std::mutex> guard(m_lock);
+            if (--m_pending == 0)
+                m_idle.notify_all();
+            continue;
+        }
+
+        // INVARIANT: Queued count only drops once a job is taken, so no submission is missed.
+        std::unique_lock<std::mutex> guard(m_lock);
+        m_wake.wait(guard, [this] { return m_stop || m_queued != 0; });
+        if (m_stop && m_queued == 0)
+            return;
+    }
+}
+
+bool
+ThreadPool::take(const size_t index, std::function<void()>& job)
+{
+    for (size_t i = 0; i < m_queues.size(); ++i) {
+        Queue& queue = *m_queues[(index + i) % m_queues.size()];
+        std::lock_guard<std::mutex> guard(queue.lock);
+        if (queue.jobs.empty())
+            continue;
+
+        // NOTE: Own queue is used as a stack for locality, other queues are robbed oldest first.
+        if (i == 0) {
+            job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+        } else {
+            job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+        }
+
+        std::lock_guard<std::mutex> count_guard(m_lock);
+        --m_queued;
+        return true;
+    }
+
+    return false;
+}
+} // namespace cocoa
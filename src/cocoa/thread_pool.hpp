@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef COCOA_THREAD_POOL_HPP
+#define COCOA_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cocoa {
+/// @brief Work-stealing thread pool.
+///
+/// Every worker owns a queue of jobs. Submitted jobs are dealt round robin into those queues. A
+/// worker takes jobs from the back of its own queue, and once that runs dry, steals from the front
+/// of other queues. Thus uneven jobs, e.g., ROMs that run for very different amounts of time, are
+/// still spread evenly over all workers.
+///
+/// Meant for coarse jobs. Each queue is guarded by its own mutex, which is negligible next to a
+/// job that runs a whole emulator instance.
+class ThreadPool final {
+public:
+    /// @brief Start worker threads.
+    ///
+    /// @param [in] threads Amount of workers, where zero means one per hardware thread.
+    explicit ThreadPool(size_t threads = 0);
+
+    ThreadPool(const ThreadPool&) = delete;
+
+    ThreadPool&
+    operator=(const ThreadPool&) = delete;
+
+    /// @brief Finish every submitted job, then join worker threads.
+    ~ThreadPool() noexcept;
+
+    /// @brief Queue job for execution.
+    ///
+    /// @pre Job must not throw.
+    ///
+    /// @param [in] job Job to run on some worker thread.
+    void
+    submit(std::function<void()> job);
+
+    /// @brief Block until every submitted job finished.
+    void
+    wait();
+
+    /// @brief Get amount of worker threads.
+    [[nodiscard]]
+    size_t
+    size() const;
+
+private:
+    struct Queue final {
+        std::mutex lock;
+        std::deque<std::function<void()>> jobs;
+    };
+
+    void
+    work(const size_t index);
+
+    bool
+    take(const size_t index, std::function<void()>& job);
+
+    std::vector<std::unique_ptr<Queue>> m_queues;
+    std::vector<std::thread> m_threads;
+    std::mutex m_lock;
+    std::condition_variable m_wake;
+    std::condition_variable m_idle;
+    std::atomic<size_t> m_next;
+    size_t m_queued;
+    size_t m_pending;
+    bool m_stop;
+};
+} // namespace cocoa
+
+#endif // COCOA_THREAD_POOL_HPP
@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2025 Jason Pena <jasonpena@awkless.com>
+// SPDX-License-Identifier: MIT
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "cocoa/thread_pool.hpp"
+
+TEST_CASE("void cocoa::ThreadPool::wait()", "[wait]")
+{
+    cocoa::ThreadPool pool(4);
+    REQUIRE(pool.size() == 4);
+
+    std::atomic<size_t> sum { 0 };
+    for (size_t i = 1; i <= 1000; ++i)
+        pool.submit([&sum, i] { sum.fetch_add(i, std::memory_order_relaxed); });
+    pool.wait();
+    REQUIRE(sum.load() == 500500);
+
+    pool.submit([&sum] { sum.store(0); });
+    pool.wait();
+    REQUIRE(sum.load() == 0);
+}
+
+TEST_CASE("void cocoa::ThreadPool::submit(std::function<void()>)", "[submit]")
+{
+    cocoa::ThreadPool pool(2);
+    std::mutex lock;
+    std::set<std::thread::id> slow_workers;
+
+    // Slow jobs are all dealt into first queue, so second worker has to steal some of them.
+    for (size_t i = 0; i < 16; ++i) {
+        pool.submit([&, i] {
+            if (i % 2 != 0)
+                return;
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            std::lock_guard<std::mutex> guard(lock);
+            slow_workers.insert(std::this_thread::get_id());
+        });
+    }
+    pool.wait();
+    REQUIRE(slow_workers.size() == 2);
+}
+
+TEST_CASE("cocoa::ThreadPool::~ThreadPool()", "[destructor]")
+{
+    std::atomic<size_t> done { 0 };
+    {
+        cocoa::ThreadPool pool(3);
+        for (size_t i = 0; i < 64; ++i)
+            pool.submit([&done] { done.fetch_add(1, std::memory_order_relaxed); });
+    }
+    REQUIRE(done.load() == 64);
+}
@@ -102,6 +102,31 @@ from_high(V value);
 template <typename T = uint8_t, typename V = uint16_t>
 constexpr T
 from_low(V value);
+
+/// @brief Count zero bits below lowest set bit, like C++20 `std::countr_zero()`.
+///
+/// @pre Given variable must be an unsigned integral type no wider than `unsigned int`.
+///
+/// @param [in] value Value to count trailing zero bits of.
+/// @return Amount of trailing zero bits, or total number of bits of type if value is zero.
+template <typename T>
+constexpr int
+countr_zero(T value);
+
+/// @brief Offset basis of 64-bit FNV-1a, i.e., hash of no bytes at all.
+constexpr uint64_t FNV1A_BASIS = 0xCBF29CE484222325;
+
+/// @brief Hash bytes with 64-bit FNV-1a.
+///
+/// Not cryptographic. Meant for cheap fingerprints of emulator output, e.g., framebuffers.
+///
+/// @param [in] data Bytes to hash.
+/// @param [in] size Amount of bytes to hash.
+/// @param [in] hash Hash to continue from, so output produced piece by piece can be hashed as
+///                  it comes.
+/// @return 64-bit FNV-1a hash of bytes.
+constexpr uint64_t
+fnv1a(const uint8_t* data, size_t size, uint64_t hash = FNV1A_BASIS);
 } // namespace cocoa
 
 #include "cocoa/utility.tpp"
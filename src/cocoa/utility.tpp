@@ -96,6 +96,34 @@ from_low(V value)
     constexpr V mask = (V(1) << shift) - V(1);
     return static_cast<T>(value & mask);
 }
+
+template <typename T>
+constexpr int
+countr_zero(T value)
+{
+    static_assert(std::is_unsigned_v<T> && sizeof(T) <= sizeof(unsigned int),
+        "countr_zero needs an unsigned type no wider than unsigned int");
+    if (value == 0)
+        return std::numeric_limits<T>::digits;
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(value);
+#else
+    int count = 0;
+    for (; (value & 1) == 0; value = static_cast<T>(value >> 1))
+        ++count;
+    return count;
+#endif
+}
+
+constexpr uint64_t
+fnv1a(const uint8_t* data, size_t size, uint64_t hash)
+{
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 0x100000001B3;
+    }
+    return hash;
+}
 } // namespace cocoa
 
 #endif // COCOA_UTILITY_TPP
@@ -89,3 +89,22 @@ TEST_CASE("constexpr T cocoa::from_low(V)", "[from_low]")
     uint16_t expect2 = cocoa::from_low<uint16_t, uint32_t>(0xDEADBEEF);
     REQUIRE(expect2 == 0xBEEF);
 }
+
+TEST_CASE("constexpr uint64_t cocoa::fnv1a(const uint8_t*, size_t, uint64_t)", "[fnv1a]")
+{
+    REQUIRE(cocoa::fnv1a(nullptr, 0) == 0xCBF29CE484222325);
+
+    const uint8_t data[] = { 'a', 'b', 'c' };
+    REQUIRE(cocoa::fnv1a(data, 1) == 0xAF63DC4C8601EC8C);
+    REQUIRE(cocoa::fnv1a(data + 1, 2, cocoa::fnv1a(data, 1)) == cocoa::fnv1a(data, sizeof(data)));
+}
+
+TEST_CASE("constexpr int cocoa::countr_zero(T)", "[countr_zero]")
+{
+    REQUIRE(cocoa::countr_zero<uint8_t>(0x01) == 0);
+    REQUIRE(cocoa::countr_zero<uint8_t>(0x18) == 3);
+    REQUIRE(cocoa::countr_zero<uint8_t>(0x80) == 7);
+    REQUIRE(cocoa::countr_zero<uint8_t>(0x00) == 8);
+    REQUIRE(cocoa::countr_zero<uint16_t>(0x0000) == 16);
+    REQUIRE(cocoa::countr_zero<uint32_t>(0x80000000) == 31);
+}